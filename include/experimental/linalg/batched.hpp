@@ -0,0 +1,542 @@
+//==================================================================================================
+//  File:       batched.hpp
+//
+//  Summary:    This header defines operations applied across a batch of small matrices or vectors:
+//              batch_layout
+//              dr_matrix_batch< T, R, C >
+//              dr_vector_batch< T, N >
+//              batch_pack( first, last, batch )
+//              batch_unpack( batch, first )
+//              batch_transpose( a, at )
+//              batch_matrix_product( a, b, c )
+//              batch_matrix_vector_product( a, x, y )
+//              batch_inverse( a, inv )
+//              batch_cholesky( a, l )
+//
+//              A batch is a tensor whose first index selects the batch item. When stored with
+//              batch_layout, the same element of consecutive batch items is contiguous in memory
+//              (a structure-of-arrays interleaving) so the innermost loop of every kernel runs
+//              across batch items rather than within one small matrix.
+//==================================================================================================
+//
+#ifndef LINEAR_ALGEBRA_BATCHED_HPP
+#define LINEAR_ALGEBRA_BATCHED_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_BEGIN // linalg namespace
+
+//----------------
+//  Batch Layout
+//----------------
+
+// With the batch index first, layout_left places the batch index in the unit stride dimension.
+using batch_layout = ::std::layout_left;
+
+// Alias for a dynamically sized batch of R x C matrices
+template < class T,
+           auto  R,
+           auto  C,
+           class Allocator      = ::std::allocator< T >,
+           class AccessorPolicy = ::std::default_accessor< T > >
+using dr_matrix_batch = dr_tensor< T,
+                                   ::std::extents< ::std::size_t, ::std::dynamic_extent, static_cast< ::std::size_t >(R), static_cast< ::std::size_t >(C) >,
+                                   batch_layout,
+                                   ::std::extents< ::std::size_t, ::std::dynamic_extent, static_cast< ::std::size_t >(R), static_cast< ::std::size_t >(C) >,
+                                   Allocator,
+                                   AccessorPolicy >;
+
+// Alias for a dynamically sized batch of vectors of length N
+template < class T,
+           auto  N,
+           class Allocator      = ::std::allocator< T >,
+           class AccessorPolicy = ::std::default_accessor< T > >
+using dr_vector_batch = dr_tensor< T,
+                                   ::std::extents< ::std::size_t, ::std::dynamic_extent, static_cast< ::std::size_t >(N) >,
+                                   batch_layout,
+                                   ::std::extents< ::std::size_t, ::std::dynamic_extent, static_cast< ::std::size_t >(N) >,
+                                   Allocator,
+                                   AccessorPolicy >;
+
+//------------------------
+//  Batch Pack / Unpack
+//------------------------
+
+/// @brief Copies a range of matrices (or vectors) into a batch
+/// @tparam InputIt iterator to a matrix or vector type
+/// @tparam Batch batch with rank one larger than the iterated type
+/// @param first begin iterator
+/// @param last end iterator
+/// @param batch batch to be populated
+#ifdef LINALG_ENABLE_CONCEPTS
+template < ::std::input_iterator InputIt, class Batch >
+  requires ( LINALG_CONCEPTS::writable_tensor< Batch > &&
+             LINALG_CONCEPTS::tensor_expression< typename ::std::iterator_traits< InputIt >::value_type > &&
+             ( Batch::rank() == ::std::iterator_traits< InputIt >::value_type::rank() + 1 ) &&
+             ( ( Batch::rank() == 2 ) || ( Batch::rank() == 3 ) ) )
+#else
+template < class InputIt, class Batch,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::writable_tensor_v< Batch > &&
+                                          LINALG_CONCEPTS::tensor_expression_v< typename ::std::iterator_traits< InputIt >::value_type > &&
+                                          ( Batch::rank() == ::std::iterator_traits< InputIt >::value_type::rank() + 1 ) &&
+                                          ( ( Batch::rank() == 2 ) || ( Batch::rank() == 3 ) ) > >
+#endif
+constexpr void batch_pack( InputIt first, InputIt last, Batch& batch )
+{
+  using index_type = typename Batch::index_type;
+  if ( static_cast< index_type >( ::std::distance( first, last ) ) != batch.extent(0) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Batch extents are incompatable." );
+  }
+  index_type n = 0;
+  for ( ; first != last; ++first, ++n )
+  {
+    const auto& item = *first;
+    if constexpr ( Batch::rank() == 3 )
+    {
+      if ( ( static_cast< index_type >( item.extent(0) ) != batch.extent(1) ) ||
+           ( static_cast< index_type >( item.extent(1) ) != batch.extent(2) ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Batch extents are incompatable." );
+      }
+      for ( index_type i = 0; i < batch.extent(1); ++i )
+      {
+        for ( index_type j = 0; j < batch.extent(2); ++j )
+        {
+          LINALG_DETAIL::access( batch, n, i, j ) = LINALG_DETAIL::access( item, i, j );
+        }
+      }
+    }
+    else
+    {
+      if ( static_cast< index_type >( item.extent(0) ) != batch.extent(1) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Batch extents are incompatable." );
+      }
+      for ( index_type i = 0; i < batch.extent(1); ++i )
+      {
+        LINALG_DETAIL::access( batch, n, i ) = LINALG_DETAIL::access( item, i );
+      }
+    }
+  }
+}
+
+/// @brief Copies each item of a batch into a range of matrices (or vectors)
+/// @tparam Batch batch with rank one larger than the iterated type
+/// @tparam OutputIt iterator to a writable matrix or vector
+/// @param batch batch to be copied
+/// @param first begin iterator of a range of at least batch.extent(0) items with matching extents
+/// @return iterator one past the last item written
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Batch, class OutputIt >
+  requires ( LINALG_CONCEPTS::tensor_expression< Batch > &&
+             ( ( Batch::rank() == 2 ) || ( Batch::rank() == 3 ) ) )
+#else
+template < class Batch, class OutputIt,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Batch > &&
+                                          ( ( Batch::rank() == 2 ) || ( Batch::rank() == 3 ) ) > >
+#endif
+constexpr OutputIt batch_unpack( const Batch& batch, OutputIt first )
+{
+  using index_type = typename Batch::index_type;
+  for ( index_type n = 0; n < batch.extent(0); ++n, ++first )
+  {
+    auto& item = *first;
+    if constexpr ( Batch::rank() == 3 )
+    {
+      if ( ( static_cast< index_type >( item.extent(0) ) != batch.extent(1) ) ||
+           ( static_cast< index_type >( item.extent(1) ) != batch.extent(2) ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Batch extents are incompatable." );
+      }
+      for ( index_type i = 0; i < batch.extent(1); ++i )
+      {
+        for ( index_type j = 0; j < batch.extent(2); ++j )
+        {
+          LINALG_DETAIL::access( item, i, j ) = LINALG_DETAIL::access( batch, n, i, j );
+        }
+      }
+    }
+    else
+    {
+      if ( static_cast< index_type >( item.extent(0) ) != batch.extent(1) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Batch extents are incompatable." );
+      }
+      for ( index_type i = 0; i < batch.extent(1); ++i )
+      {
+        LINALG_DETAIL::access( item, i ) = LINALG_DETAIL::access( batch, n, i );
+      }
+    }
+  }
+  return first;
+}
+
+//-------------------
+//  Batch Transpose
+//-------------------
+
+/// @brief Transposes every matrix in the batch: at[n,j,i] = a[n,i,j]
+/// @param a batch of R x C matrices
+/// @param at batch of C x R matrices to be assigned
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class InputBatch, class OutputBatch >
+  requires ( LINALG_CONCEPTS::tensor_expression< InputBatch > &&
+             LINALG_CONCEPTS::writable_tensor< OutputBatch > &&
+             ( InputBatch::rank() == 3 ) && ( OutputBatch::rank() == 3 ) )
+#else
+template < class InputBatch, class OutputBatch,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< InputBatch > &&
+                                          LINALG_CONCEPTS::writable_tensor_v< OutputBatch > &&
+                                          ( InputBatch::rank() == 3 ) && ( OutputBatch::rank() == 3 ) > >
+#endif
+constexpr void batch_transpose( const InputBatch& a, OutputBatch& at )
+{
+  using index_type = typename OutputBatch::index_type;
+  if ( ( static_cast< index_type >( a.extent(0) ) != at.extent(0) ) ||
+       ( static_cast< index_type >( a.extent(1) ) != at.extent(2) ) ||
+       ( static_cast< index_type >( a.extent(2) ) != at.extent(1) ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Batch extents are incompatable." );
+  }
+  const index_type batch = at.extent(0);
+  for ( index_type i = 0; i < at.extent(2); ++i )
+  {
+    for ( index_type j = 0; j < at.extent(1); ++j )
+    {
+      for ( index_type n = 0; n < batch; ++n )
+      {
+        LINALG_DETAIL::access( at, n, j, i ) = LINALG_DETAIL::access( a, n, i, j );
+      }
+    }
+  }
+}
+
+//------------------------
+//  Batch Matrix Product
+//------------------------
+
+/// @brief Multiplies every pair of matrices in the batches: c[n] = a[n] * b[n]
+/// @param a batch of R x K matrices
+/// @param b batch of K x C matrices
+/// @param c batch of R x C matrices to be assigned; must not alias a or b
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class FirstBatch, class SecondBatch, class OutputBatch >
+  requires ( LINALG_CONCEPTS::tensor_expression< FirstBatch > &&
+             LINALG_CONCEPTS::tensor_expression< SecondBatch > &&
+             LINALG_CONCEPTS::writable_tensor< OutputBatch > &&
+             ( FirstBatch::rank() == 3 ) && ( SecondBatch::rank() == 3 ) && ( OutputBatch::rank() == 3 ) )
+#else
+template < class FirstBatch, class SecondBatch, class OutputBatch,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< FirstBatch > &&
+                                          LINALG_CONCEPTS::tensor_expression_v< SecondBatch > &&
+                                          LINALG_CONCEPTS::writable_tensor_v< OutputBatch > &&
+                                          ( FirstBatch::rank() == 3 ) && ( SecondBatch::rank() == 3 ) && ( OutputBatch::rank() == 3 ) > >
+#endif
+constexpr void batch_matrix_product( const FirstBatch& a, const SecondBatch& b, OutputBatch& c )
+{
+  using index_type = typename OutputBatch::index_type;
+  using value_type = typename OutputBatch::value_type;
+  if ( ( static_cast< index_type >( a.extent(0) ) != c.extent(0) ) ||
+       ( static_cast< index_type >( b.extent(0) ) != c.extent(0) ) ||
+       ( static_cast< index_type >( a.extent(1) ) != c.extent(1) ) ||
+       ( static_cast< index_type >( b.extent(2) ) != c.extent(2) ) ||
+       ( static_cast< index_type >( a.extent(2) ) != static_cast< index_type >( b.extent(1) ) ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Batch extents are incompatable." );
+  }
+  const index_type batch = c.extent(0);
+  const index_type inner = static_cast< index_type >( a.extent(2) );
+  for ( index_type i = 0; i < c.extent(1); ++i )
+  {
+    for ( index_type j = 0; j < c.extent(2); ++j )
+    {
+      for ( index_type n = 0; n < batch; ++n )
+      {
+        LINALG_DETAIL::access( c, n, i, j ) = value_type( 0 );
+      }
+      for ( index_type k = 0; k < inner; ++k )
+      {
+        // Innermost loop runs across batch items which are unit stride under batch_layout
+        for ( index_type n = 0; n < batch; ++n )
+        {
+          LINALG_DETAIL::access( c, n, i, j ) += LINALG_DETAIL::access( a, n, i, k ) * LINALG_DETAIL::access( b, n, k, j );
+        }
+      }
+    }
+  }
+}
+
+//-------------------------------
+//  Batch Matrix Vector Product
+//-------------------------------
+
+/// @brief Multiplies every matrix by the corresponding vector: y[n] = a[n] * x[n]
+/// @param a batch of R x C matrices
+/// @param x batch of vectors of length C
+/// @param y batch of vectors of length R to be assigned; must not alias x
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class MatrixBatch, class VectorBatch, class OutputBatch >
+  requires ( LINALG_CONCEPTS::tensor_expression< MatrixBatch > &&
+             LINALG_CONCEPTS::tensor_expression< VectorBatch > &&
+             LINALG_CONCEPTS::writable_tensor< OutputBatch > &&
+             ( MatrixBatch::rank() == 3 ) && ( VectorBatch::rank() == 2 ) && ( OutputBatch::rank() == 2 ) )
+#else
+template < class MatrixBatch, class VectorBatch, class OutputBatch,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< MatrixBatch > &&
+                                          LINALG_CONCEPTS::tensor_expression_v< VectorBatch > &&
+                                          LINALG_CONCEPTS::writable_tensor_v< OutputBatch > &&
+                                          ( MatrixBatch::rank() == 3 ) && ( VectorBatch::rank() == 2 ) && ( OutputBatch::rank() == 2 ) > >
+#endif
+constexpr void batch_matrix_vector_product( const MatrixBatch& a, const VectorBatch& x, OutputBatch& y )
+{
+  using index_type = typename OutputBatch::index_type;
+  using value_type = typename OutputBatch::value_type;
+  if ( ( static_cast< index_type >( a.extent(0) ) != y.extent(0) ) ||
+       ( static_cast< index_type >( x.extent(0) ) != y.extent(0) ) ||
+       ( static_cast< index_type >( a.extent(1) ) != y.extent(1) ) ||
+       ( static_cast< index_type >( a.extent(2) ) != static_cast< index_type >( x.extent(1) ) ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Batch extents are incompatable." );
+  }
+  const index_type batch = y.extent(0);
+  const index_type inner = static_cast< index_type >( a.extent(2) );
+  for ( index_type i = 0; i < y.extent(1); ++i )
+  {
+    for ( index_type n = 0; n < batch; ++n )
+    {
+      LINALG_DETAIL::access( y, n, i ) = value_type( 0 );
+    }
+    for ( index_type k = 0; k < inner; ++k )
+    {
+      for ( index_type n = 0; n < batch; ++n )
+      {
+        LINALG_DETAIL::access( y, n, i ) += LINALG_DETAIL::access( a, n, i, k ) * LINALG_DETAIL::access( x, n, k );
+      }
+    }
+  }
+}
+
+//-----------------
+//  Batch Inverse
+//-----------------
+
+/// @brief Inverts every square matrix in the batch using Gauss-Jordan elimination with partial pivoting
+/// @param a batch of N x N matrices
+/// @param inv batch of N x N matrices to be assigned; may be the same object as a
+/// @throw domain_error if any matrix in the batch is singular
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class InputBatch, class OutputBatch >
+  requires ( LINALG_CONCEPTS::tensor_expression< InputBatch > &&
+             LINALG_CONCEPTS::writable_tensor< OutputBatch > &&
+             ( InputBatch::rank() == 3 ) && ( OutputBatch::rank() == 3 ) )
+#else
+template < class InputBatch, class OutputBatch,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< InputBatch > &&
+                                          LINALG_CONCEPTS::writable_tensor_v< OutputBatch > &&
+                                          ( InputBatch::rank() == 3 ) && ( OutputBatch::rank() == 3 ) > >
+#endif
+void batch_inverse( const InputBatch& a, OutputBatch& inv )
+{
+  using index_type = typename OutputBatch::index_type;
+  using value_type = typename OutputBatch::value_type;
+  if ( ( static_cast< index_type >( a.extent(0) ) != inv.extent(0) ) ||
+       ( static_cast< index_type >( a.extent(1) ) != inv.extent(1) ) ||
+       ( static_cast< index_type >( a.extent(2) ) != inv.extent(2) ) ||
+       ( inv.extent(1) != inv.extent(2) ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Batch extents are incompatable." );
+  }
+  const index_type batch = inv.extent(0);
+  const index_type dim   = inv.extent(1);
+  // Invert in place within the output
+  if ( static_cast< const void* >( ::std::addressof( a ) ) != static_cast< const void* >( ::std::addressof( inv ) ) )
+  {
+    for ( index_type i = 0; i < dim; ++i )
+    {
+      for ( index_type j = 0; j < dim; ++j )
+      {
+        for ( index_type n = 0; n < batch; ++n )
+        {
+          LINALG_DETAIL::access( inv, n, i, j ) = LINALG_DETAIL::access( a, n, i, j );
+        }
+      }
+    }
+  }
+  // Pivot rows chosen for each column of each batch item
+  ::std::vector< index_type > pivots( static_cast< ::std::size_t >( batch * dim ) );
+  ::std::vector< value_type > factors( static_cast< ::std::size_t >( batch ) );
+  for ( index_type k = 0; k < dim; ++k )
+  {
+    // Pivot selection differs per batch item, so swap rows item by item
+    for ( index_type n = 0; n < batch; ++n )
+    {
+      index_type pivot = k;
+      auto       max   = ::std::abs( LINALG_DETAIL::access( inv, n, k, k ) );
+      for ( index_type i = k + 1; i < dim; ++i )
+      {
+        auto mag = ::std::abs( LINALG_DETAIL::access( inv, n, i, k ) );
+        if ( mag > max )
+        {
+          max   = mag;
+          pivot = i;
+        }
+      }
+      if ( max == decltype( max )( 0 ) ) LINALG_UNLIKELY
+      {
+        throw ::std::domain_error( "Matrix is singular." );
+      }
+      pivots[ static_cast< ::std::size_t >( k * batch + n ) ] = pivot;
+      if ( pivot != k )
+      {
+        for ( index_type j = 0; j < dim; ++j )
+        {
+          ::std::swap( LINALG_DETAIL::access( inv, n, k, j ), LINALG_DETAIL::access( inv, n, pivot, j ) );
+        }
+      }
+    }
+    // Scale the pivot row
+    for ( index_type n = 0; n < batch; ++n )
+    {
+      factors[ static_cast< ::std::size_t >( n ) ] = value_type( 1 ) / LINALG_DETAIL::access( inv, n, k, k );
+      LINALG_DETAIL::access( inv, n, k, k ) = value_type( 1 );
+    }
+    for ( index_type j = 0; j < dim; ++j )
+    {
+      for ( index_type n = 0; n < batch; ++n )
+      {
+        LINALG_DETAIL::access( inv, n, k, j ) *= factors[ static_cast< ::std::size_t >( n ) ];
+      }
+    }
+    // Eliminate column k from every other row
+    for ( index_type i = 0; i < dim; ++i )
+    {
+      if ( i == k )
+      {
+        continue;
+      }
+      for ( index_type n = 0; n < batch; ++n )
+      {
+        factors[ static_cast< ::std::size_t >( n ) ] = LINALG_DETAIL::access( inv, n, i, k );
+        LINALG_DETAIL::access( inv, n, i, k ) = value_type( 0 );
+      }
+      for ( index_type j = 0; j < dim; ++j )
+      {
+        for ( index_type n = 0; n < batch; ++n )
+        {
+          LINALG_DETAIL::access( inv, n, i, j ) -= factors[ static_cast< ::std::size_t >( n ) ] * LINALG_DETAIL::access( inv, n, k, j );
+        }
+      }
+    }
+  }
+  // Undo the row interchanges by swapping columns in reverse order
+  for ( index_type k = dim; k-- > 0; )
+  {
+    for ( index_type n = 0; n < batch; ++n )
+    {
+      const index_type pivot = pivots[ static_cast< ::std::size_t >( k * batch + n ) ];
+      if ( pivot != k )
+      {
+        for ( index_type i = 0; i < dim; ++i )
+        {
+          ::std::swap( LINALG_DETAIL::access( inv, n, i, k ), LINALG_DETAIL::access( inv, n, i, pivot ) );
+        }
+      }
+    }
+  }
+}
+
+//------------------
+//  Batch Cholesky
+//------------------
+
+/// @brief Factors every Hermitian positive definite matrix in the batch as A = L L^H
+/// @param a batch of N x N matrices, of which only the lower triangles are read
+/// @param l batch of N x N matrices to be assigned L, with zeros above the diagonal; may be the same object as a
+/// @throw domain_error if any matrix in the batch is not positive definite
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class InputBatch, class OutputBatch >
+  requires ( LINALG_CONCEPTS::tensor_expression< InputBatch > &&
+             LINALG_CONCEPTS::writable_tensor< OutputBatch > &&
+             ( InputBatch::rank() == 3 ) && ( OutputBatch::rank() == 3 ) )
+#else
+template < class InputBatch, class OutputBatch,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< InputBatch > &&
+                                          LINALG_CONCEPTS::writable_tensor_v< OutputBatch > &&
+                                          ( InputBatch::rank() == 3 ) && ( OutputBatch::rank() == 3 ) > >
+#endif
+void batch_cholesky( const InputBatch& a, OutputBatch& l )
+{
+  using index_type = typename OutputBatch::index_type;
+  using value_type = typename OutputBatch::value_type;
+  using real_type  = decltype( ::std::abs( ::std::declval< value_type >() ) );
+  if ( ( static_cast< index_type >( a.extent(0) ) != l.extent(0) ) ||
+       ( static_cast< index_type >( a.extent(1) ) != l.extent(1) ) ||
+       ( static_cast< index_type >( a.extent(2) ) != l.extent(2) ) ||
+       ( l.extent(1) != l.extent(2) ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Batch extents are incompatable." );
+  }
+  const index_type batch = l.extent(0);
+  const index_type dim   = l.extent(1);
+  // Factor in place within the output
+  if ( static_cast< const void* >( ::std::addressof( a ) ) != static_cast< const void* >( ::std::addressof( l ) ) )
+  {
+    for ( index_type i = 0; i < dim; ++i )
+    {
+      for ( index_type j = 0; j <= i; ++j )
+      {
+        for ( index_type n = 0; n < batch; ++n )
+        {
+          LINALG_DETAIL::access( l, n, i, j ) = LINALG_DETAIL::access( a, n, i, j );
+        }
+      }
+    }
+  }
+  // Reciprocal of the diagonal of L in column j for each batch item
+  ::std::vector< real_type > factors( static_cast< ::std::size_t >( batch ) );
+  for ( index_type j = 0; j < dim; ++j )
+  {
+    for ( index_type n = 0; n < batch; ++n )
+    {
+      factors[ static_cast< ::std::size_t >( n ) ] = ::std::real( LINALG_DETAIL::access( l, n, j, j ) );
+    }
+    for ( index_type k = 0; k < j; ++k )
+    {
+      for ( index_type n = 0; n < batch; ++n )
+      {
+        factors[ static_cast< ::std::size_t >( n ) ] -= ::std::norm( LINALG_DETAIL::access( l, n, j, k ) );
+      }
+    }
+    for ( index_type n = 0; n < batch; ++n )
+    {
+      real_type& d = factors[ static_cast< ::std::size_t >( n ) ];
+      if ( !( d > real_type( 0 ) ) ) LINALG_UNLIKELY
+      {
+        throw ::std::domain_error( "Matrix is not positive definite." );
+      }
+      d = ::std::sqrt( d );
+      LINALG_DETAIL::access( l, n, j, j ) = value_type( d );
+      d = real_type( 1 ) / d;
+    }
+    for ( index_type i = j + 1; i < dim; ++i )
+    {
+      for ( index_type k = 0; k < j; ++k )
+      {
+        for ( index_type n = 0; n < batch; ++n )
+        {
+          LINALG_DETAIL::access( l, n, i, j ) -= LINALG_DETAIL::access( l, n, i, k ) * LINALG_EXPRESSIONS_DETAIL::conjugate_value( LINALG_DETAIL::access( l, n, j, k ) );
+        }
+      }
+      for ( index_type n = 0; n < batch; ++n )
+      {
+        LINALG_DETAIL::access( l, n, i, j ) *= factors[ static_cast< ::std::size_t >( n ) ];
+        LINALG_DETAIL::access( l, n, j, i ) = value_type( 0 );
+      }
+    }
+  }
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_BATCHED_HPP
@@ -0,0 +1,344 @@
+//==================================================================================================
+//  File:       cholesky.hpp
+//
+//  Summary:    This header defines the Cholesky factorization of Hermitian positive definite matrices:
+//              cholesky_factorization< Matrix >
+//              cholesky( Matrix&& a )
+//
+//              The factorization overwrites the lower triangle of the matrix with L, where A = L L^H;
+//              the strict upper triangle is neither read nor written. Panels of cholesky_block_extent
+//              columns are factored, then only the lower triangle of the trailing matrix is updated,
+//              with blocks of its rows updated in parallel for large matrices.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_CHOLESKY_HPP
+#define LINEAR_ALGEBRA_CHOLESKY_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//-------------------------
+//  Blocked Factorization
+//-------------------------
+
+// Columns of the panel factored before the trailing matrix is updated
+inline constexpr ::std::size_t cholesky_block_extent = 64;
+
+/// @brief Factors columns [first, first + width) of a, whose updates from earlier panels are complete
+/// @return false if the matrix is not positive definite
+template < class Matrix >
+[[nodiscard]] bool cholesky_panel( Matrix& a, ::std::size_t first, ::std::size_t width )
+{
+  using value_type = typename Matrix::value_type;
+  using real_type  = decltype( ::std::abs( ::std::declval< value_type >() ) );
+  const ::std::size_t rows = static_cast< ::std::size_t >( a.extent(0) );
+  for ( ::std::size_t j = first; j < first + width; ++j )
+  {
+    real_type d = ::std::real( LINALG_DETAIL::access( a, j, j ) );
+    for ( ::std::size_t k = first; k < j; ++k )
+    {
+      d -= ::std::norm( LINALG_DETAIL::access( a, j, k ) );
+    }
+    if ( !( d > real_type( 0 ) ) ) LINALG_UNLIKELY
+    {
+      return false;
+    }
+    const real_type l_jj = ::std::sqrt( d );
+    LINALG_DETAIL::access( a, j, j ) = value_type( l_jj );
+    for ( ::std::size_t i = j + 1; i < rows; ++i )
+    {
+      value_type l_ij = LINALG_DETAIL::access( a, i, j );
+      for ( ::std::size_t k = first; k < j; ++k )
+      {
+        l_ij -= LINALG_DETAIL::access( a, i, k ) * LINALG_EXPRESSIONS_DETAIL::conjugate_value( LINALG_DETAIL::access( a, j, k ) );
+      }
+      LINALG_DETAIL::access( a, i, j ) = l_ij / l_jj;
+    }
+  }
+  return true;
+}
+
+/// @brief Subtracts the product of the panel [first, first + width) and its adjoint from the lower
+///        triangle of the trailing matrix
+template < class Matrix >
+void cholesky_trailing_update( Matrix& a, ::std::size_t first, ::std::size_t width )
+{
+  using value_type = typename Matrix::value_type;
+  const ::std::size_t rows     = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t trailing = first + width;
+  if ( trailing >= rows )
+  {
+    return;
+  }
+  ::std::vector< ::std::size_t > tiles( ( rows - trailing + parallel_tile_extent - 1 ) / parallel_tile_extent );
+  ::std::iota( tiles.begin(), tiles.end(), ::std::size_t( 0 ) );
+  // Cache the last exception to be thrown
+  ::std::exception_ptr eptr;
+  const auto update_tile = [&]( ::std::size_t tile ) noexcept
+  {
+    try
+    {
+      const ::std::size_t last_row = ::std::min( rows, trailing + ( tile + 1 ) * parallel_tile_extent );
+      for ( ::std::size_t i = trailing + tile * parallel_tile_extent; i < last_row; ++i )
+      {
+        for ( ::std::size_t k = first; k < trailing; ++k )
+        {
+          const value_type l_ik = LINALG_DETAIL::access( a, i, k );
+          for ( ::std::size_t j = trailing; j <= i; ++j )
+          {
+            LINALG_DETAIL::access( a, i, j ) -= l_ik * LINALG_EXPRESSIONS_DETAIL::conjugate_value( LINALG_DETAIL::access( a, j, k ) );
+          }
+        }
+      }
+    }
+    catch ( ... ) { eptr = ::std::current_exception(); }
+  };
+  // Half of the trailing matrix is updated
+  if ( ( rows - trailing ) * ( rows - trailing ) * width < 2 * parallel_product_threshold )
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_SEQ, tiles.begin(), tiles.end(), update_tile );
+  }
+  else
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR, tiles.begin(), tiles.end(), update_tile );
+  }
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+}
+
+/// @brief Right looking blocked factorization of the lower triangle of a in place
+/// @return false if the matrix is not positive definite
+template < class Matrix >
+[[nodiscard]] bool blocked_cholesky( Matrix& a )
+{
+  const ::std::size_t rows = static_cast< ::std::size_t >( a.extent(0) );
+  for ( ::std::size_t j = 0; j < rows; j += cholesky_block_extent )
+  {
+    const ::std::size_t width = ::std::min( cholesky_block_extent, rows - j );
+    if ( !cholesky_panel( a, j, width ) )
+    {
+      return false;
+    }
+    cholesky_trailing_update( a, j, width );
+  }
+  return true;
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//--------------------------
+//  Cholesky Factorization
+//--------------------------
+
+/// @brief Cholesky factorization A = L L^H, stored in the lower triangle of the factored matrix
+/// @tparam Matrix factored matrix type; an lvalue reference when an lvalue was factored in place
+template < class Matrix >
+class cholesky_factorization
+{
+  public:
+    //- Aliases
+    using matrix_type  = ::std::decay_t< Matrix >;
+    using value_type   = ::std::remove_cv_t< typename matrix_type::value_type >;
+    using real_type    = decltype( ::std::abs( ::std::declval< value_type >() ) );
+    using extents_type = typename matrix_type::extents_type;
+
+    //- Constructors
+    /// @brief Factors the matrix in place
+    /// @throw length_error if the matrix is not square
+    /// @throw domain_error if the matrix is not positive definite
+    explicit cholesky_factorization( Matrix&& a ) :
+      factors_( ::std::forward< Matrix >( a ) )
+    {
+      if ( this->factors_.extent(0) != this->factors_.extent(1) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Tensor extents are incompatable." );
+      }
+      if ( !LINALG_DETAIL::blocked_cholesky( this->factors_ ) ) LINALG_UNLIKELY
+      {
+        throw ::std::domain_error( "Matrix is not positive definite." );
+      }
+    }
+
+    //- Factors
+    /// @brief Returns the factored matrix, holding L in its lower triangle
+    [[nodiscard]] constexpr const matrix_type& factors() const noexcept { return this->factors_; }
+
+    //- Operations
+    /// @brief Returns the natural logarithm of the determinant, 2 sum( log( L_ii ) )
+    [[nodiscard]] real_type log_det() const
+    {
+      real_type sum = real_type( 0 );
+      for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( this->factors_.extent(0) ); ++i )
+      {
+        sum += ::std::log( ::std::real( LINALG_DETAIL::access( this->factors_, i, i ) ) );
+      }
+      return real_type( 2 ) * sum;
+    }
+
+    /// @brief Returns y solving L y = b for a vector or a matrix of right hand sides
+    /// @throw length_error if b has the wrong number of rows
+#ifdef LINALG_ENABLE_CONCEPTS
+    template < class Rhs >
+      requires ( LINALG_CONCEPTS::tensor_expression< Rhs > && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) )
+#else
+    template < class Rhs,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Rhs > && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) > >
+#endif
+    [[nodiscard]] auto forward_substitution( const Rhs& b ) const
+    {
+      auto y = this->make_solution( b );
+      LINALG_DETAIL::lower_solve( LINALG_DETAIL::make_block( this->factors_ ), LINALG_DETAIL::make_block( y ) );
+      return y;
+    }
+
+    /// @brief Returns x solving L^H x = y for a vector or a matrix of right hand sides
+    /// @throw length_error if y has the wrong number of rows
+#ifdef LINALG_ENABLE_CONCEPTS
+    template < class Rhs >
+      requires ( LINALG_CONCEPTS::tensor_expression< Rhs > && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) )
+#else
+    template < class Rhs,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Rhs > && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) > >
+#endif
+    [[nodiscard]] auto back_substitution( const Rhs& y ) const
+    {
+      auto x = this->make_solution( y );
+      LINALG_DETAIL::lower_adjoint_solve( LINALG_DETAIL::make_block( this->factors_ ), LINALG_DETAIL::make_block( x ) );
+      return x;
+    }
+
+    /// @brief Returns x solving A x = b for a vector or a matrix of right hand sides
+    /// @throw length_error if b has the wrong number of rows
+#ifdef LINALG_ENABLE_CONCEPTS
+    template < class Rhs >
+      requires ( LINALG_CONCEPTS::tensor_expression< Rhs > && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) )
+#else
+    template < class Rhs,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Rhs > && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) > >
+#endif
+    [[nodiscard]] auto solve( const Rhs& b ) const
+    {
+      auto x = this->make_solution( b );
+      this->solve_in_place( x );
+      return x;
+    }
+
+    /// @brief Overwrites x, a writable vector or matrix of right hand sides, with the solution of A x = b
+    template < class Solution >
+    void solve_in_place( Solution& x ) const
+    {
+      const auto l  = LINALG_DETAIL::make_block( this->factors_ );
+      const auto xb = LINALG_DETAIL::make_block( x );
+      LINALG_DETAIL::lower_solve( l, xb );
+      LINALG_DETAIL::lower_adjoint_solve( l, xb );
+    }
+
+    /// @brief Updates the factorization to that of A + x x^H
+    /// @throw length_error if x has the wrong length
+#ifdef LINALG_ENABLE_CONCEPTS
+    template < class Vector >
+      requires ( LINALG_CONCEPTS::tensor_expression< Vector > && ( Vector::rank() == 1 ) )
+#else
+    template < class Vector,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Vector > && ( Vector::rank() == 1 ) > >
+#endif
+    void update( const Vector& x )
+    {
+      this->rank_one_modification( x, real_type( 1 ) );
+    }
+
+    /// @brief Downdates the factorization to that of A - x x^H
+    /// @throw length_error if x has the wrong length
+    /// @throw domain_error if A - x x^H is not positive definite, leaving the factorization unspecified
+#ifdef LINALG_ENABLE_CONCEPTS
+    template < class Vector >
+      requires ( LINALG_CONCEPTS::tensor_expression< Vector > && ( Vector::rank() == 1 ) )
+#else
+    template < class Vector,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Vector > && ( Vector::rank() == 1 ) > >
+#endif
+    void downdate( const Vector& x )
+    {
+      this->rank_one_modification( x, real_type( -1 ) );
+    }
+
+  private:
+    //- Implementation
+    template < class Rhs >
+    [[nodiscard]] auto make_solution( const Rhs& b ) const
+    {
+      if ( static_cast< ::std::size_t >( b.extent(0) ) != static_cast< ::std::size_t >( this->factors_.extent(0) ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Tensor extents are incompatable." );
+      }
+      return LINALG_DETAIL::make_solution< value_type >( b );
+    }
+    // Rotates L column by column so that L L^H gains sign * x x^H
+    template < class Vector >
+    void rank_one_modification( const Vector& v, real_type sign )
+    {
+      const ::std::size_t n = static_cast< ::std::size_t >( this->factors_.extent(0) );
+      if ( static_cast< ::std::size_t >( v.extent(0) ) != n ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Tensor extents are incompatable." );
+      }
+      ::std::vector< value_type > x( n );
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        x[i] = static_cast< value_type >( LINALG_DETAIL::access( v, i ) );
+      }
+      for ( ::std::size_t k = 0; k < n; ++k )
+      {
+        const real_type l_kk = ::std::real( LINALG_DETAIL::access( this->factors_, k, k ) );
+        const real_type d    = l_kk * l_kk + sign * ::std::norm( x[k] );
+        if ( !( d > real_type( 0 ) ) ) LINALG_UNLIKELY
+        {
+          throw ::std::domain_error( "Matrix is not positive definite." );
+        }
+        const real_type  r = ::std::sqrt( d );
+        const real_type  c = r / l_kk;
+        const value_type s = x[k] / l_kk;
+        LINALG_DETAIL::access( this->factors_, k, k ) = value_type( r );
+        for ( ::std::size_t i = k + 1; i < n; ++i )
+        {
+          auto& l_ik = LINALG_DETAIL::access( this->factors_, i, k );
+          l_ik = ( l_ik + sign * LINALG_EXPRESSIONS_DETAIL::conjugate_value( s ) * x[i] ) / c;
+          x[i] = c * x[i] - s * l_ik;
+        }
+      }
+    }
+
+    //- Data
+    Matrix factors_;
+};
+
+/// @brief Factors a Hermitian positive definite matrix in place as A = L L^H from its lower triangle
+/// @param a writable square matrix, such as a dr_tensor, fs_tensor or a view returned by submatrix
+/// @return factorization referring to a if a is an lvalue, or holding a otherwise
+/// @throw length_error if the matrix is not square
+/// @throw domain_error if the matrix is not positive definite
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::writable_tensor< ::std::remove_cvref_t< Matrix > > &&
+             !::std::is_const_v< ::std::remove_reference_t< Matrix > > &&
+             ( ::std::remove_cvref_t< Matrix >::rank() == 2 ) )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::writable_tensor_v< ::std::decay_t< Matrix > > &&
+                                          !::std::is_const_v< ::std::remove_reference_t< Matrix > > &&
+                                          ( ::std::decay_t< Matrix >::rank() == 2 ) > >
+#endif
+[[nodiscard]] cholesky_factorization< Matrix > cholesky( Matrix&& a )
+{
+  return cholesky_factorization< Matrix >( ::std::forward< Matrix >( a ) );
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_CHOLESKY_HPP
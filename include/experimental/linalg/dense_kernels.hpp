@@ -0,0 +1,368 @@
+//==================================================================================================
+//  File:       dense_kernels.hpp
+//
+//  Summary:    This header defines the kernels the dense factorizations are built from:
+//              LINALG_DETAIL::matrix_block< Matrix >
+//              LINALG_DETAIL::make_block( Matrix& m )
+//              LINALG_DETAIL::solution_type_t< T, Rhs >
+//              LINALG_DETAIL::make_solution< T >( const Rhs& b )
+//              LINALG_DETAIL::block_operand< Block, Adjoint, Scalar >
+//              LINALG_DETAIL::block_product< First, Second >
+//              LINALG_DETAIL::packed_block_product_update< Adjoint >( c, a, b, alpha )
+//              LINALG_DETAIL::block_product_update( c, a, b, alpha )
+//              LINALG_DETAIL::block_adjoint_product_update( c, a, b, alpha )
+//              LINALG_DETAIL::unit_lower_solve( l, b )
+//              LINALG_DETAIL::upper_solve( u, b )
+//              LINALG_DETAIL::lower_solve( l, b )
+//              LINALG_DETAIL::lower_adjoint_solve( l, b )
+//
+//              The factorizations work in place on any writable matrix, including dr_tensor,
+//              fs_tensor and the views returned by submatrix, so the kernels address rectangular
+//              blocks of a matrix through its first row and column rather than through a view type.
+//              Large block products, the trailing updates of the blocked factorizations, are handed to
+//              the packed parallel product kernel with the blocks as its operands.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_DENSE_KERNELS_HPP
+#define LINEAR_ALGEBRA_DENSE_KERNELS_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//----------------
+//  Matrix Block
+//----------------
+
+/// @brief Rectangular block of a matrix, addressed relative to its first row and column
+/// @tparam Matrix matrix type, const qualified for a read only block
+template < class Matrix >
+class matrix_block
+{
+  public:
+    //- Aliases
+    using value_type = ::std::remove_cv_t< typename ::std::remove_reference_t< Matrix >::value_type >;
+
+    //- Constructors
+    constexpr matrix_block( Matrix& m, ::std::size_t row, ::std::size_t column, ::std::size_t rows, ::std::size_t columns ) noexcept :
+      m_( m ), row_( row ), column_( column ), rows_( rows ), columns_( columns ) { }
+
+    //- Extents
+    [[nodiscard]] static constexpr ::std::size_t rank() noexcept { return 2; }
+    [[nodiscard]] constexpr ::std::size_t extent( ::std::size_t n ) const noexcept { return ( n == 0 ) ? this->rows_ : this->columns_; }
+
+    //- Access
+    [[nodiscard]] constexpr decltype(auto) operator()( ::std::size_t i, [[maybe_unused]] ::std::size_t j ) const
+    {
+      if constexpr ( ::std::decay_t< Matrix >::rank() == 1 )
+      {
+        return LINALG_DETAIL::access( this->m_, this->row_ + i );
+      }
+      else
+      {
+        return LINALG_DETAIL::access( this->m_, this->row_ + i, this->column_ + j );
+      }
+    }
+    #if LINALG_USE_BRACKET_OPERATOR
+    [[nodiscard]] constexpr decltype(auto) operator[]( ::std::size_t i, ::std::size_t j ) const { return ( *this )( i, j ); }
+    #endif
+    /// @brief Returns a block of this block
+    [[nodiscard]] constexpr matrix_block block( ::std::size_t row, ::std::size_t column, ::std::size_t rows, ::std::size_t columns ) const noexcept
+    {
+      return matrix_block( this->m_, this->row_ + row, this->column_ + column, rows, columns );
+    }
+
+  private:
+    //- Data
+    Matrix&       m_;
+    ::std::size_t row_;
+    ::std::size_t column_;
+    ::std::size_t rows_;
+    ::std::size_t columns_;
+};
+
+/// @brief Returns the block covering a whole matrix, or a vector viewed as a single column
+template < class Matrix >
+[[nodiscard]] constexpr matrix_block< Matrix > make_block( Matrix& m ) noexcept
+{
+  if constexpr ( ::std::decay_t< Matrix >::rank() == 1 )
+  {
+    return matrix_block< Matrix >( m, 0, 0, static_cast< ::std::size_t >( m.extent(0) ), 1 );
+  }
+  else
+  {
+    return matrix_block< Matrix >( m, 0, 0, static_cast< ::std::size_t >( m.extent(0) ), static_cast< ::std::size_t >( m.extent(1) ) );
+  }
+}
+
+//-------------
+//  Solutions
+//-------------
+
+// Owning tensor with the given extents: fixed size if they are all static, dynamic otherwise
+template < class T, class Extents, bool = ( Extents::rank_dynamic() == 0 ), class = ::std::make_index_sequence< Extents::rank() > >
+struct solution_type
+{
+  using type = LINALG::dyn_tensor< T, Extents::rank() >;
+};
+
+template < class T, class Extents, ::std::size_t ... Indices >
+struct solution_type< T, Extents, true, ::std::index_sequence< Indices ... > >
+{
+  using type = LINALG::fs_tensor< T, ::std::extents< typename Extents::index_type, Extents::static_extent( Indices ) ... > >;
+};
+
+template < class T, class Rhs >
+using solution_type_t = typename solution_type< T, typename ::std::decay_t< Rhs >::extents_type >::type;
+
+/// @brief Returns an owning copy of the right hand side to be solved in place
+template < class T, class Rhs >
+[[nodiscard]] solution_type_t< T, Rhs > make_solution( const Rhs& b )
+{
+  using result_type  = solution_type_t< T, Rhs >;
+  using extents_type = typename result_type::extents_type;
+  result_type x = [&]()
+  {
+    if constexpr ( extents_type::rank_dynamic() == 0 )
+    {
+      return result_type();
+    }
+    else if constexpr ( Rhs::rank() == 1 )
+    {
+      return result_type( extents_type( b.extent(0) ) );
+    }
+    else
+    {
+      return result_type( extents_type( b.extent(0), b.extent(1) ) );
+    }
+  }();
+  if constexpr ( Rhs::rank() == 1 )
+  {
+    for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( b.extent(0) ); ++i )
+    {
+      LINALG_DETAIL::access( x, i ) = static_cast< T >( LINALG_DETAIL::access( b, i ) );
+    }
+  }
+  else
+  {
+    for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( b.extent(0) ); ++i )
+    {
+      for ( ::std::size_t j = 0; j < static_cast< ::std::size_t >( b.extent(1) ); ++j )
+      {
+        LINALG_DETAIL::access( x, i, j ) = static_cast< T >( LINALG_DETAIL::access( b, i, j ) );
+      }
+    }
+  }
+  return x;
+}
+
+//------------------------
+//  Block Product Update
+//------------------------
+
+/// @brief Block read by the packed product kernel as a scaled operand, conjugate transposed if Adjoint
+template < class Block, bool Adjoint, class Scalar >
+struct block_operand
+{
+  const Block& block;
+  Scalar       alpha;
+  [[nodiscard]] static constexpr ::std::size_t rank() noexcept { return 2; }
+  [[nodiscard]] constexpr ::std::size_t extent( ::std::size_t n ) const noexcept { return this->block.extent( Adjoint ? 1 - n : n ); }
+};
+
+/// @brief Product of two block operands, as the packed product kernel reads a product expression
+template < class First, class Second >
+struct block_product
+{
+  First  first_;
+  Second second_;
+  [[nodiscard]] constexpr const First&  first() const noexcept { return this->first_; }
+  [[nodiscard]] constexpr const Second& second() const noexcept { return this->second_; }
+};
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
+
+// Block operand, read through its block with the scaling applied once to each accumulated element
+template < class Block, bool Adjoint, class Scalar >
+struct product_operand< LINALG_DETAIL::block_operand< Block, Adjoint, Scalar > >
+{
+  using leaf_type = Block;
+  static constexpr bool transposed = Adjoint;
+  static constexpr bool conjugated = Adjoint;
+  static constexpr bool scaled     = true;
+  [[nodiscard]] static constexpr const leaf_type& leaf( const LINALG_DETAIL::block_operand< Block, Adjoint, Scalar >& op ) noexcept { return op.block; }
+  template < class Alpha >
+  [[nodiscard]] static constexpr Alpha alpha( const LINALG_DETAIL::block_operand< Block, Adjoint, Scalar >& op ) { return Alpha( op.alpha ); }
+};
+
+LINALG_EXPRESSIONS_DETAIL_END // expressions detail namespace
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+/// @brief c += alpha * op( a ) * b over blocks by the packed parallel product kernel, op( a ) = conj( trans( a ) ) if Adjoint
+template < bool Adjoint, class C, class A, class B, class Scalar >
+void packed_block_product_update( const matrix_block< C >& c, const matrix_block< A >& a, const matrix_block< B >& b, const Scalar& alpha )
+{
+  using value_type = typename matrix_block< C >::value_type;
+  using first_type = block_operand< matrix_block< A >, Adjoint, value_type >;
+  using second_type = block_operand< matrix_block< B >, false, value_type >;
+  const ::std::size_t inner   = Adjoint ? a.extent(0) : a.extent(1);
+  const ::std::size_t workers = ::std::max( ::std::size_t( ::std::thread::hardware_concurrency() ), ::std::size_t( 1 ) );
+  const block_product< first_type, second_type > product { first_type { a, static_cast< value_type >( alpha ) }, second_type { b, value_type( 1 ) } };
+  parallel_matrix_product< value_type, true >( c, product, partition_product( c.extent(0), c.extent(1), inner, workers ) );
+}
+
+/// @brief c += alpha * a * b over blocks, by the packed parallel product kernel for large products
+template < class C, class A, class B, class Scalar >
+void block_product_update( const matrix_block< C >& c, const matrix_block< A >& a, const matrix_block< B >& b, const Scalar& alpha )
+{
+  using value_type = typename matrix_block< C >::value_type;
+  const ::std::size_t rows    = c.extent(0);
+  const ::std::size_t columns = c.extent(1);
+  const ::std::size_t inner   = a.extent(1);
+  if ( ( rows == 0 ) || ( columns == 0 ) || ( inner == 0 ) )
+  {
+    return;
+  }
+  if ( rows * columns * inner >= parallel_product_threshold )
+  {
+    packed_block_product_update< false >( c, a, b, alpha );
+    return;
+  }
+  for ( ::std::size_t i = 0; i < rows; ++i )
+  {
+    for ( ::std::size_t k = 0; k < inner; ++k )
+    {
+      const value_type a_ik = static_cast< value_type >( alpha * a( i, k ) );
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        c( i, j ) += a_ik * b( k, j );
+      }
+    }
+  }
+}
+
+/// @brief c += alpha * conj( trans( a ) ) * b over blocks, by the packed parallel product kernel for large products
+/// a is read along its rows, so it is never transposed.
+template < class C, class A, class B, class Scalar >
+void block_adjoint_product_update( const matrix_block< C >& c, const matrix_block< A >& a, const matrix_block< B >& b, const Scalar& alpha )
+{
+  using value_type = typename matrix_block< C >::value_type;
+  const ::std::size_t rows    = c.extent(0);
+  const ::std::size_t columns = c.extent(1);
+  const ::std::size_t inner   = a.extent(0);
+  if ( ( rows == 0 ) || ( columns == 0 ) || ( inner == 0 ) )
+  {
+    return;
+  }
+  if ( rows * columns * inner >= parallel_product_threshold )
+  {
+    packed_block_product_update< true >( c, a, b, alpha );
+    return;
+  }
+  for ( ::std::size_t k = 0; k < inner; ++k )
+  {
+    for ( ::std::size_t i = 0; i < rows; ++i )
+    {
+      const value_type a_ki = static_cast< value_type >( alpha * LINALG_EXPRESSIONS_DETAIL::conjugate_value( a( k, i ) ) );
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        c( i, j ) += a_ki * b( k, j );
+      }
+    }
+  }
+}
+
+//---------------------------
+//  Triangular Block Solves
+//---------------------------
+
+/// @brief b = inverse( l ) * b for the unit lower triangle of l
+template < class L, class B >
+void unit_lower_solve( const matrix_block< L >& l, const matrix_block< B >& b )
+{
+  for ( ::std::size_t i = 1; i < l.extent(0); ++i )
+  {
+    for ( ::std::size_t k = 0; k < i; ++k )
+    {
+      const auto l_ik = l( i, k );
+      for ( ::std::size_t j = 0; j < b.extent(1); ++j )
+      {
+        b( i, j ) -= l_ik * b( k, j );
+      }
+    }
+  }
+}
+
+/// @brief b = inverse( u ) * b for the upper triangle of u
+template < class U, class B >
+void upper_solve( const matrix_block< U >& u, const matrix_block< B >& b )
+{
+  for ( ::std::size_t i = u.extent(0); i-- > 0; )
+  {
+    for ( ::std::size_t k = i + 1; k < u.extent(0); ++k )
+    {
+      const auto u_ik = u( i, k );
+      for ( ::std::size_t j = 0; j < b.extent(1); ++j )
+      {
+        b( i, j ) -= u_ik * b( k, j );
+      }
+    }
+    const auto u_ii = u( i, i );
+    for ( ::std::size_t j = 0; j < b.extent(1); ++j )
+    {
+      b( i, j ) /= u_ii;
+    }
+  }
+}
+
+/// @brief b = inverse( l ) * b for the lower triangle of l
+template < class L, class B >
+void lower_solve( const matrix_block< L >& l, const matrix_block< B >& b )
+{
+  for ( ::std::size_t i = 0; i < l.extent(0); ++i )
+  {
+    for ( ::std::size_t k = 0; k < i; ++k )
+    {
+      const auto l_ik = l( i, k );
+      for ( ::std::size_t j = 0; j < b.extent(1); ++j )
+      {
+        b( i, j ) -= l_ik * b( k, j );
+      }
+    }
+    const auto l_ii = l( i, i );
+    for ( ::std::size_t j = 0; j < b.extent(1); ++j )
+    {
+      b( i, j ) /= l_ii;
+    }
+  }
+}
+
+/// @brief b = inverse( conj( trans( l ) ) ) * b for the lower triangle of l
+template < class L, class B >
+void lower_adjoint_solve( const matrix_block< L >& l, const matrix_block< B >& b )
+{
+  for ( ::std::size_t i = l.extent(0); i-- > 0; )
+  {
+    const auto l_ii = LINALG_EXPRESSIONS_DETAIL::conjugate_value( l( i, i ) );
+    for ( ::std::size_t j = 0; j < b.extent(1); ++j )
+    {
+      b( i, j ) /= l_ii;
+    }
+    // Column i of l is row i of its adjoint, so eliminate x_i from the rows above
+    for ( ::std::size_t k = 0; k < i; ++k )
+    {
+      const auto l_ik = LINALG_EXPRESSIONS_DETAIL::conjugate_value( l( i, k ) );
+      for ( ::std::size_t j = 0; j < b.extent(1); ++j )
+      {
+        b( k, j ) -= l_ik * b( i, j );
+      }
+    }
+  }
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+#endif  //- LINEAR_ALGEBRA_DENSE_KERNELS_HPP
@@ -838,6 +838,31 @@ constexpr dr_tensor<T,Extents,LayoutPolicy,CapExtents,Allocator,AccessorPolicy>:
   size_map_( this->cap_map_ ),
   tm_( alloc, this->cap_map_ )
 {
+  #ifdef LINALG_ENABLE_CONCEPTS
+  if constexpr ( LINALG_CONCEPTS::unevaluated_tensor_expression< ::std::remove_reference_t< Tensor > > )
+  #else
+  if constexpr ( LINALG_CONCEPTS::unevaluated_tensor_expression_v< ::std::remove_reference_t< Tensor > > )
+  #endif
+  {
+    if constexpr ( ::std::is_trivially_default_constructible_v< element_type > && ::std::is_trivially_copy_assignable_v< element_type > )
+    {
+      // Elements need no construction, so an equivalent expression tree may be assigned as by operator =
+      if ( rewritten_assignment< self_type, ::std::decay_t< Tensor > >::apply( *this, t ) )
+      {
+        return;
+      }
+    }
+    else if ( !LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      // Default construct all elements, so an equivalent expression tree may be assigned as by operator =
+      this->construct_all();
+      if ( !rewritten_assignment< self_type, ::std::decay_t< Tensor > >::apply( *this, t ) )
+      {
+        LINALG_DETAIL::copy_view( *this, t );
+      }
+      return;
+    }
+  }
   // Construct all elements from tensor expression
   auto tensor_ctor = [this,&t]( auto ... indices ) constexpr noexcept( ::std::is_nothrow_copy_constructible_v<element_type> )
   {
@@ -967,29 +992,40 @@ dr_tensor<T,Extents,LayoutPolicy,CapExtents,Allocator,AccessorPolicy>::operator
   if constexpr ( LINALG_CONCEPTS::unevaluated_tensor_expression_v< ::std::remove_reference_t< Tensor > > )
   #endif
   {
+    // An equivalent expression tree may be cheaper to evaluate
+    if ( rewritten_assignment< self_type, ::std::decay_t< Tensor > >::apply( *this, rhs ) )
+    {
+      return *this;
+    }
     if constexpr ( ! is_alias_assignable_v< Tensor > )
     {
-      self_type temp { rhs };
-      this->move( ::std::move( temp ) );
+      // Only operands sharing storage with this tensor require evaluation into a temporary
+      if ( LINALG_DETAIL::overlaps( rhs, *this ) )
+      {
+        if ( in_place_assignment< self_type, ::std::decay_t< Tensor > >::apply( *this, rhs ) )
+        {
+          return *this;
+        }
+        self_type temp { rhs };
+        this->move( ::std::move( temp ) );
+        return *this;
+      }
+    }
+    if ( this->extents() == rhs.extents() )
+    {
+      // Copy construct all elements
+      LINALG_DETAIL::copy_view( *this, rhs );
     }
     else
     {
-      if ( this->extents() == rhs.extents() )
+      if ( LINALG_DETAIL::sufficient_extents( this->cap_map_.extents(), rhs.extents() ) )
       {
-        // Copy construct all elements
-        LINALG_DETAIL::copy_view( *this, rhs );
+        this->assign( rhs );
       }
       else
       {
-        if ( LINALG_DETAIL::sufficient_extents( this->cap_map_.extents(), rhs.extents() ) )
-        {
-          this->assign( rhs );
-        }
-        else
-        {
-          self_type temp { rhs };
-          this->move( ::std::move( temp ) );
-        }
+        self_type temp { rhs };
+        this->move( ::std::move( temp ) );
       }
     }
   }
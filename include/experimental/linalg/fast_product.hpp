@@ -0,0 +1,425 @@
+//==================================================================================================
+//  File:       fast_product.hpp
+//
+//  Summary:    This header defines an opt-in fast evaluation of matrix products:
+//              strassen_policy
+//              strassen_workspace< T >
+//              strassen_assignment< Tensor >
+//              strassen( t [, workspace] [, policy] )
+//              strassen_error_bound( n [, policy] )
+//
+//              strassen( c ) = a * b evaluates the product with the Winograd variant of Strassen's
+//              recursion: seven half size products and fifteen additions per level, recursing on
+//              submatrix quadrants until every extent is at most the policy cutoff, where the
+//              conventional kernel takes over. The operands are copied, zero padded to extents
+//              divisible by 2^levels, into a workspace which also holds the temporaries of every
+//              level and may be preallocated and reused across products.
+//
+//              Accuracy: the bound is normwise rather than componentwise. To first order in the unit
+//              roundoff u, with n0 the extent of the base case,
+//                ||C - C^||max <= [ ( n / n0 )^log2(18) ( n0^2 + 6 n0 ) - 6 n ] u ||A||max ||B||max
+//              against n^2 u ||A||max ||B||max for the conventional product (Higham, Accuracy and
+//              Stability of Numerical Algorithms, 2nd ed., section 23.2.2). Small elements of C
+//              computed from large elements of A and B may therefore lose all relative accuracy.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_FAST_PRODUCT_HPP
+#define LINEAR_ALGEBRA_FAST_PRODUCT_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_BEGIN // linalg namespace
+
+//-------------------
+//  Strassen Policy
+//-------------------
+
+/// @brief Opt-in evaluation policy for matrix products by Strassen-Winograd recursion
+struct strassen_policy
+{
+  /// @brief Recursion stops once every extent is at most the cutoff
+  ::std::size_t cutoff = 128;
+};
+
+LINALG_END // linalg namespace
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//-------------------
+//  Strassen Blocks
+//-------------------
+
+// Row major block of the workspace, or a quadrant of one
+template < class T >
+using strassen_block = ::std::mdspan< T, ::std::extents< ::std::size_t, ::std::dynamic_extent, ::std::dynamic_extent >, ::std::layout_stride >;
+
+template < class T >
+[[nodiscard]] inline strassen_block< T > make_strassen_block( T* data, ::std::size_t rows, ::std::size_t columns ) noexcept
+{
+  using extents_type = ::std::extents< ::std::size_t, ::std::dynamic_extent, ::std::dynamic_extent >;
+  return strassen_block< T >( data, ::std::layout_stride::mapping< extents_type >( extents_type( rows, columns ), ::std::array< ::std::size_t, 2 > { columns, 1 } ) );
+}
+
+template < class T >
+[[nodiscard]] inline strassen_block< T > strassen_quadrant( const strassen_block< T >& b, ::std::size_t row, ::std::size_t column ) noexcept
+{
+  const ::std::size_t rows    = b.extent(0) / 2;
+  const ::std::size_t columns = b.extent(1) / 2;
+  return strassen_block< T >( ::std::experimental::submdspan( b,
+                                                              ::std::pair { row * rows, ( row + 1 ) * rows },
+                                                              ::std::pair { column * columns, ( column + 1 ) * columns } ) );
+}
+
+// Sets every element of the block to f( i, j )
+template < class T, class F >
+void strassen_apply( const strassen_block< T >& b, F&& f )
+{
+  for ( ::std::size_t i = 0; i < b.extent(0); ++i )
+  {
+    for ( ::std::size_t j = 0; j < b.extent(1); ++j )
+    {
+      LINALG_DETAIL::access( b, i, j ) = f( i, j );
+    }
+  }
+}
+
+//----------------------
+//  Strassen Recursion
+//----------------------
+
+// Levels of recursion before every extent is at most the cutoff
+[[nodiscard]] inline constexpr ::std::size_t strassen_levels( ::std::size_t rows, ::std::size_t inner, ::std::size_t columns, ::std::size_t cutoff ) noexcept
+{
+  cutoff = ::std::max( cutoff, ::std::size_t( 1 ) );
+  ::std::size_t levels = 0;
+  while ( ::std::max( { rows, inner, columns } ) > cutoff )
+  {
+    rows    = ( rows + 1 ) / 2;
+    inner   = ( inner + 1 ) / 2;
+    columns = ( columns + 1 ) / 2;
+    ++levels;
+  }
+  return levels;
+}
+
+// Extent padded to be divisible by 2^levels
+[[nodiscard]] inline constexpr ::std::size_t strassen_padded_extent( ::std::size_t extent, ::std::size_t levels ) noexcept
+{
+  return ( ( extent + ( ::std::size_t( 1 ) << levels ) - 1 ) >> levels ) << levels;
+}
+
+// Elements of workspace holding the padded operands, the result and the temporaries of every level
+[[nodiscard]] inline constexpr ::std::size_t strassen_workspace_extent( ::std::size_t rows, ::std::size_t inner, ::std::size_t columns, ::std::size_t cutoff ) noexcept
+{
+  const ::std::size_t levels = strassen_levels( rows, inner, columns, cutoff );
+  rows    = strassen_padded_extent( rows, levels );
+  inner   = strassen_padded_extent( inner, levels );
+  columns = strassen_padded_extent( columns, levels );
+  ::std::size_t size = rows * inner + inner * columns + rows * columns;
+  for ( ::std::size_t level = 0; level < levels; ++level )
+  {
+    rows    /= 2;
+    inner   /= 2;
+    columns /= 2;
+    size    += rows * inner + inner * columns + rows * columns;
+  }
+  return size;
+}
+
+// Conventional product c = a * b of the base case
+template < class T >
+void strassen_base_product( const strassen_block< T >& c, const strassen_block< T >& a, const strassen_block< T >& b )
+{
+  for ( ::std::size_t i = 0; i < c.extent(0); ++i )
+  {
+    for ( ::std::size_t j = 0; j < c.extent(1); ++j )
+    {
+      LINALG_DETAIL::access( c, i, j ) = T( 0 );
+    }
+    for ( ::std::size_t k = 0; k < a.extent(1); ++k )
+    {
+      const T a_ik = LINALG_DETAIL::access( a, i, k );
+      for ( ::std::size_t j = 0; j < c.extent(1); ++j )
+      {
+        LINALG_DETAIL::access( c, i, j ) += a_ik * LINALG_DETAIL::access( b, k, j );
+      }
+    }
+  }
+}
+
+// Winograd form of Strassen's recursion, c = a * b, with temporaries taken from the workspace
+template < class T >
+void strassen_product( const strassen_block< T >& c, const strassen_block< T >& a, const strassen_block< T >& b, ::std::size_t levels, T* workspace )
+{
+  if ( levels == 0 )
+  {
+    strassen_base_product( c, a, b );
+    return;
+  }
+  const ::std::size_t rows    = a.extent(0) / 2;
+  const ::std::size_t inner   = a.extent(1) / 2;
+  const ::std::size_t columns = b.extent(1) / 2;
+  const auto a11 = strassen_quadrant( a, 0, 0 );
+  const auto a12 = strassen_quadrant( a, 0, 1 );
+  const auto a21 = strassen_quadrant( a, 1, 0 );
+  const auto a22 = strassen_quadrant( a, 1, 1 );
+  const auto b11 = strassen_quadrant( b, 0, 0 );
+  const auto b12 = strassen_quadrant( b, 0, 1 );
+  const auto b21 = strassen_quadrant( b, 1, 0 );
+  const auto b22 = strassen_quadrant( b, 1, 1 );
+  const auto c11 = strassen_quadrant( c, 0, 0 );
+  const auto c12 = strassen_quadrant( c, 0, 1 );
+  const auto c21 = strassen_quadrant( c, 1, 0 );
+  const auto c22 = strassen_quadrant( c, 1, 1 );
+  const auto s   = make_strassen_block( workspace, rows, inner );
+  const auto t   = make_strassen_block( workspace + rows * inner, inner, columns );
+  const auto q   = make_strassen_block( workspace + rows * inner + inner * columns, rows, columns );
+  T* next = workspace + rows * inner + inner * columns + rows * columns;
+  const auto at = []( const strassen_block< T >& x, ::std::size_t i, ::std::size_t j ) -> T { return LINALG_DETAIL::access( x, i, j ); };
+  // P1 = A11 B11, C11 = P1 + P2
+  strassen_product( q, a11, b11, levels - 1, next );
+  strassen_product( c11, a12, b21, levels - 1, next );
+  strassen_apply( c11, [&]( auto i, auto j ) { return at( c11, i, j ) + at( q, i, j ); } );
+  // C22 = P5 = S1 T1
+  strassen_apply( s, [&]( auto i, auto j ) { return at( a21, i, j ) + at( a22, i, j ); } );
+  strassen_apply( t, [&]( auto i, auto j ) { return at( b12, i, j ) - at( b11, i, j ); } );
+  strassen_product( c22, s, t, levels - 1, next );
+  // C12 = U2 = P1 + S2 T2
+  strassen_apply( s, [&]( auto i, auto j ) { return at( s, i, j ) - at( a11, i, j ); } );
+  strassen_apply( t, [&]( auto i, auto j ) { return at( b22, i, j ) - at( t, i, j ); } );
+  strassen_product( c12, s, t, levels - 1, next );
+  strassen_apply( c12, [&]( auto i, auto j ) { return at( c12, i, j ) + at( q, i, j ); } );
+  // C21 = U3 = U2 + S3 T3
+  strassen_apply( s, [&]( auto i, auto j ) { return at( a11, i, j ) - at( a21, i, j ); } );
+  strassen_apply( t, [&]( auto i, auto j ) { return at( b22, i, j ) - at( b12, i, j ); } );
+  strassen_product( c21, s, t, levels - 1, next );
+  strassen_apply( c21, [&]( auto i, auto j ) { return at( c21, i, j ) + at( c12, i, j ); } );
+  // C12 = U4 = U2 + P5, C22 = U3 + P5
+  strassen_apply( c12, [&]( auto i, auto j ) { return at( c12, i, j ) + at( c22, i, j ); } );
+  strassen_apply( c22, [&]( auto i, auto j ) { return at( c22, i, j ) + at( c21, i, j ); } );
+  // C12 = U4 + S4 B22
+  strassen_apply( s, [&]( auto i, auto j ) { return at( a11, i, j ) + at( a12, i, j ) - at( a21, i, j ) - at( a22, i, j ); } );
+  strassen_product( q, s, b22, levels - 1, next );
+  strassen_apply( c12, [&]( auto i, auto j ) { return at( c12, i, j ) + at( q, i, j ); } );
+  // C21 = U3 - A22 T4
+  strassen_apply( t, [&]( auto i, auto j ) { return at( b11, i, j ) - at( b12, i, j ) - at( b21, i, j ) + at( b22, i, j ); } );
+  strassen_product( q, a22, t, levels - 1, next );
+  strassen_apply( c21, [&]( auto i, auto j ) { return at( c21, i, j ) - at( q, i, j ); } );
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//----------------------
+//  Strassen Workspace
+//----------------------
+
+/// @brief Preallocated workspace for Strassen-Winograd products, reused across products
+/// @tparam T element type the products are computed in
+template < class T >
+class strassen_workspace
+{
+  public:
+    //- Aliases
+    using value_type = T;
+
+    //- Capacity
+
+    /// @brief Grows the workspace to hold a rows x inner by inner x columns product under the policy
+    void reserve( ::std::size_t rows, ::std::size_t inner, ::std::size_t columns, strassen_policy policy = strassen_policy() )
+    {
+      this->acquire( LINALG_DETAIL::strassen_workspace_extent( rows, inner, columns, policy.cutoff ) );
+    }
+    /// @brief Number of elements held
+    [[nodiscard]] ::std::size_t capacity() const noexcept { return this->buffer_.size(); }
+
+    //- Access
+
+    /// @brief Returns at least size elements, growing the workspace only if it is too small
+    [[nodiscard]] T* acquire( ::std::size_t size )
+    {
+      if ( this->buffer_.size() < size )
+      {
+        this->buffer_.resize( size );
+      }
+      return this->buffer_.data();
+    }
+
+  private:
+    //- Data
+    ::std::vector< T > buffer_;
+};
+
+//-----------------------
+//  Strassen Assignment
+//-----------------------
+
+/// @brief Assigns a matrix product to a tensor by Strassen-Winograd recursion
+/// @tparam Tensor writable matrix
+template < class Tensor >
+class strassen_assignment
+{
+  public:
+    //- Aliases
+    using workspace_type = strassen_workspace< LINALG::accumulation_type_t< typename Tensor::value_type > >;
+
+    //- Constructors
+
+    /// @brief Constructs from the destination, the policy and an optional workspace
+    constexpr strassen_assignment( Tensor& t, strassen_policy policy, workspace_type* workspace ) noexcept :
+      t_( t ), policy_( policy ), workspace_( workspace ) { }
+
+    //- Assignment
+
+    /// @brief Evaluates the product into the destination
+    /// Dynamic destinations are resized to the extents of the product, others must match. The operands
+    /// are read in full before the destination is written, so they may share storage with it.
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Expression >
+      requires LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< Expression >
+    #else
+    template < class Expression,
+               typename = ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< Expression > > >
+    #endif
+    Tensor& operator = ( Expression&& rhs )
+    {
+      this->match_extents( rhs );
+      if ( this->workspace_ )
+      {
+        this->evaluate( rhs, *this->workspace_ );
+      }
+      else
+      {
+        workspace_type workspace;
+        this->evaluate( rhs, workspace );
+      }
+      return this->t_;
+    }
+
+  private:
+    //- Helpers
+
+    template < class Expression >
+    void evaluate( const Expression& rhs, workspace_type& workspace )
+    {
+      using value_type     = typename workspace_type::value_type;
+      using first_type     = decltype( rhs.first() );
+      using second_type    = decltype( rhs.second() );
+      using first_operand  = LINALG_EXPRESSIONS_DETAIL::product_operand_t< first_type >;
+      using second_operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< second_type >;
+      const ::std::size_t rows    = static_cast< ::std::size_t >( rhs.extent(0) );
+      const ::std::size_t inner   = static_cast< ::std::size_t >( rhs.first().extent(1) );
+      const ::std::size_t columns = static_cast< ::std::size_t >( rhs.extent(1) );
+      const ::std::size_t levels  = LINALG_DETAIL::strassen_levels( rows, inner, columns, this->policy_.cutoff );
+      const ::std::size_t padded_rows    = LINALG_DETAIL::strassen_padded_extent( rows, levels );
+      const ::std::size_t padded_inner   = LINALG_DETAIL::strassen_padded_extent( inner, levels );
+      const ::std::size_t padded_columns = LINALG_DETAIL::strassen_padded_extent( columns, levels );
+      value_type* data = workspace.acquire( LINALG_DETAIL::strassen_workspace_extent( rows, inner, columns, this->policy_.cutoff ) );
+      const auto a = LINALG_DETAIL::make_strassen_block( data, padded_rows, padded_inner );
+      const auto b = LINALG_DETAIL::make_strassen_block( data + padded_rows * padded_inner, padded_inner, padded_columns );
+      const auto c = LINALG_DETAIL::make_strassen_block( data + padded_rows * padded_inner + padded_inner * padded_columns, padded_rows, padded_columns );
+      // Copy the operands through their transposes and conjugates, zero padded
+      const auto& a_leaf = first_operand::leaf( rhs.first() );
+      const auto& b_leaf = second_operand::leaf( rhs.second() );
+      LINALG_DETAIL::strassen_apply( a, [&]( auto i, auto k )
+        { return ( i < rows && k < inner ) ? value_type( LINALG_EXPRESSIONS_DETAIL::read_operand< first_type >( a_leaf, i, k ) ) : value_type( 0 ); } );
+      LINALG_DETAIL::strassen_apply( b, [&]( auto k, auto j )
+        { return ( k < inner && j < columns ) ? value_type( LINALG_EXPRESSIONS_DETAIL::read_operand< second_type >( b_leaf, k, j ) ) : value_type( 0 ); } );
+      LINALG_DETAIL::strassen_product( c, a, b, levels, data + padded_rows * padded_inner + padded_inner * padded_columns + padded_rows * padded_columns );
+      value_type alpha = value_type( 1 );
+      if constexpr ( first_operand::scaled || second_operand::scaled )
+      {
+        alpha = LINALG_EXPRESSIONS_DETAIL::operand_alpha< first_type, value_type >( rhs.first() ) *
+                LINALG_EXPRESSIONS_DETAIL::operand_alpha< second_type, value_type >( rhs.second() );
+      }
+      for ( ::std::size_t i = 0; i < rows; ++i )
+      {
+        for ( ::std::size_t j = 0; j < columns; ++j )
+        {
+          LINALG_DETAIL::access( this->t_, i, j ) = static_cast< typename Tensor::value_type >( alpha * LINALG_DETAIL::access( c, i, j ) );
+        }
+      }
+    }
+    template < class Expression >
+    void match_extents( const Expression& rhs )
+    {
+      #ifdef LINALG_ENABLE_CONCEPTS
+      if constexpr ( LINALG_CONCEPTS::dynamic_tensor< Tensor > )
+      #else
+      if constexpr ( LINALG_CONCEPTS::dynamic_tensor_v< Tensor > )
+      #endif
+      {
+        if ( this->t_.extents() != rhs.extents() )
+        {
+          this->t_.resize( rhs.extents() );
+        }
+      }
+      else
+      {
+        for ( typename Tensor::rank_type dim = 0; dim < Tensor::rank(); ++dim )
+        {
+          if ( static_cast< typename Tensor::index_type >( rhs.extent( dim ) ) != this->t_.extent( dim ) ) LINALG_UNLIKELY
+          {
+            throw ::std::length_error( "Tensor extents are incompatable." );
+          }
+        }
+      }
+    }
+
+    //- Data
+    Tensor&         t_;
+    strassen_policy policy_;
+    workspace_type* workspace_;
+};
+
+//------------
+//  Strassen
+//------------
+
+/// @brief Returns an assignment target which evaluates matrix products by Strassen-Winograd recursion
+/// @param t destination matrix
+/// @param policy recursion cutoff
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Tensor >
+  requires ( LINALG_CONCEPTS::writable_tensor< Tensor > && ( Tensor::rank() == 2 ) )
+#else
+template < class Tensor,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::writable_tensor_v< Tensor > && ( Tensor::rank() == 2 ) > >
+#endif
+[[nodiscard]] constexpr strassen_assignment< Tensor > strassen( Tensor& t, strassen_policy policy = strassen_policy() ) noexcept
+{
+  return strassen_assignment< Tensor >( t, policy, nullptr );
+}
+
+/// @brief Returns an assignment target which evaluates matrix products by Strassen-Winograd recursion
+/// @param t destination matrix
+/// @param workspace preallocated workspace, grown if too small and kept for later products
+/// @param policy recursion cutoff
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Tensor >
+  requires ( LINALG_CONCEPTS::writable_tensor< Tensor > && ( Tensor::rank() == 2 ) )
+#else
+template < class Tensor,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::writable_tensor_v< Tensor > && ( Tensor::rank() == 2 ) > >
+#endif
+[[nodiscard]] constexpr strassen_assignment< Tensor > strassen( Tensor&                                                 t,
+                                                                typename strassen_assignment< Tensor >::workspace_type& workspace,
+                                                                strassen_policy                                         policy = strassen_policy() ) noexcept
+{
+  return strassen_assignment< Tensor >( t, policy, &workspace );
+}
+
+/// @brief First order bound on ||C - C^||max / ( u ||A||max ||B||max ) for an n x n product under the policy
+/// Equal to n^2, the bound of the conventional product, when n is at most the cutoff.
+[[nodiscard]] inline double strassen_error_bound( ::std::size_t n, strassen_policy policy = strassen_policy() ) noexcept
+{
+  const ::std::size_t levels = LINALG_DETAIL::strassen_levels( n, n, n, policy.cutoff );
+  const double        padded = static_cast< double >( LINALG_DETAIL::strassen_padded_extent( n, levels ) );
+  const double        base   = padded / static_cast< double >( ::std::size_t( 1 ) << levels );
+  return ::std::pow( 18.0, static_cast< double >( levels ) ) * ( base * base + 6.0 * base ) - 6.0 * padded;
+}
+
+LINALG_END // linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_FAST_PRODUCT_HPP
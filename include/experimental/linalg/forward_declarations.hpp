@@ -229,6 +229,10 @@ template < class FirstVector, class SecondVector, typename = ::std::enable_if_t<
 #endif
 class outer_product_expression;
 
+// Inverse
+template < class Matrix >
+class inverse_expression;
+
 LINALG_EXPRESSIONS_END // end expressions namespace
 
 LINALG_BEGIN // linalg namespace
@@ -415,12 +415,33 @@ constexpr fs_tensor<T,Extents,LayoutPolicy,AccessorPolicy>::fs_tensor( Tensor&&
     }
   }
   // Construct all elements from tensor expression
-  auto tensor_ctor = [this,&t]( auto ... indices ) constexpr noexcept( ::std::is_nothrow_copy_constructible_v<element_type> )
+  if constexpr ( LINALG_DETAIL::is_unrollable_extents_v< extents_type > )
   {
-    // TODO: This requires reference returned from mdspan to be the address of the element
-    ::new ( ::std::addressof( LINALG_DETAIL::access( *this, indices ... ) ) ) element_type( LINALG_DETAIL::access( t, indices ... ) );
-  };
-  LINALG_DETAIL::apply_all( *this, tensor_ctor, LINALG_EXECUTION_UNSEQ );
+    // Fully unroll evaluation for small static extents so the expression may be evaluated in constant expressions
+    LINALG_DETAIL::constexpr_apply_all< extents_type >( [this,&t]( auto ... indices ) constexpr
+      { LINALG_DETAIL::construct_at( ::std::addressof( LINALG_DETAIL::access( *this, indices ... ) ), LINALG_DETAIL::access( t, indices ... ) ); } );
+  }
+  else
+  {
+    #ifdef LINALG_ENABLE_CONCEPTS
+    if constexpr ( LINALG_CONCEPTS::unevaluated_tensor_expression< ::std::remove_reference_t< Tensor > > )
+    #else
+    if constexpr ( LINALG_CONCEPTS::unevaluated_tensor_expression_v< ::std::remove_reference_t< Tensor > > )
+    #endif
+    {
+      // Elements are already value initialized, so an equivalent expression tree may be assigned as by operator =
+      if ( rewritten_assignment< fs_tensor, ::std::decay_t< Tensor > >::apply( *this, t ) )
+      {
+        return;
+      }
+    }
+    auto tensor_ctor = [this,&t]( auto ... indices ) constexpr noexcept( ::std::is_nothrow_copy_constructible_v<element_type> )
+    {
+      // TODO: This requires reference returned from mdspan to be the address of the element
+      ::new ( ::std::addressof( LINALG_DETAIL::access( *this, indices ... ) ) ) element_type( LINALG_DETAIL::access( t, indices ... ) );
+    };
+    LINALG_DETAIL::apply_all( *this, tensor_ctor, LINALG_EXECUTION_UNSEQ );
+  }
 }
 
 template < class T, class Extents, class LayoutPolicy, class AccessorPolicy >
@@ -499,18 +520,29 @@ fs_tensor<T,Extents,LayoutPolicy,AccessorPolicy>::operator = ( Tensor&& rhs )
   if constexpr ( LINALG_CONCEPTS::unevaluated_tensor_expression_v< ::std::remove_reference_t< Tensor > > )
   #endif
   {
-    if constexpr ( ! is_alias_assignable_v< Tensor > )
+    // An equivalent expression tree may be cheaper to evaluate
+    if ( rewritten_assignment< fs_tensor, ::std::decay_t< Tensor > >::apply( *this, rhs ) )
     {
-      // Create a temporary to assign from
-      fs_tensor temp { rhs };
-      // Copy construct all elements
-      LINALG_DETAIL::copy_view( *this, temp );
+      return *this;
     }
-    else
+    if constexpr ( ! is_alias_assignable_v< Tensor > )
     {
-      // Copy construct all elements
-      LINALG_DETAIL::copy_view( *this, rhs );
+      // Only operands sharing storage with this tensor require evaluation into a temporary
+      if ( LINALG_DETAIL::overlaps( rhs, *this ) )
+      {
+        if ( in_place_assignment< fs_tensor, ::std::decay_t< Tensor > >::apply( *this, rhs ) )
+        {
+          return *this;
+        }
+        // Create a temporary to assign from
+        fs_tensor temp { rhs };
+        // Copy construct all elements
+        LINALG_DETAIL::copy_view( *this, temp );
+        return *this;
+      }
     }
+    // Copy construct all elements
+    LINALG_DETAIL::copy_view( *this, rhs );
   }
   else
   {
@@ -0,0 +1,334 @@
+//==================================================================================================
+//  File:       inverse.hpp
+//
+//  Summary:    This header defines the inverse of a square matrix as a lazily evaluated expression:
+//              LINALG::accessor_result< LINALG_EXPRESSIONS::inverse_expression< Matrix > >
+//              LINALG::allocator_result< LINALG_EXPRESSIONS::inverse_expression< Matrix > >
+//              LINALG::layout_result< LINALG_EXPRESSIONS::inverse_expression< Matrix > >
+//              LINALG_EXPRESSIONS::inverse_expression< Matrix >
+//              LINALG_EXPRESSIONS_DETAIL::inverse_product( Tensor& t, const Inverse& inv, const Rhs& b )
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_product_expression< const inverse_expression< Matrix >&, SecondMatrix > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_vector_product_expression< const inverse_expression< Matrix >&, Vector > >
+//              LINALG::inverse( const M& m )
+//
+//              Assigning inverse( a ) * b to a tensor never forms the inverse: it is evaluated as a
+//              solve with a factorization of a, Cholesky if a is symmetric (Hermitian if complex) and
+//              positive definite, LU with partial pivoting otherwise. The factorization is computed on
+//              first use and kept by the inverse expression, so products with the same named node reuse
+//              it, provided a is not modified meanwhile. Constructing a tensor from the product solves
+//              in the same way, and so does assigning any tree in which alpha * inverse( a ) * b is an
+//              operand, such as inverse( a ) * b + c: the product is solved into a temporary, or into
+//              the tensor itself at the root, by solve_inverse_products. Trees which need the inverse
+//              itself, such as trans( inverse( a ) ) * b or b * inverse( a ), evaluate the node, which
+//              solves against the identity. Only reading elements of the inverse directly evaluates and
+//              keeps the explicit inverse.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_INVERSE_HPP
+#define LINEAR_ALGEBRA_INVERSE_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_BEGIN // linalg namespace
+
+//-------------------
+//  Accessor Result
+//-------------------
+
+template < class Matrix >
+struct accessor_result< LINALG_EXPRESSIONS::inverse_expression< Matrix > >
+{
+  using type = ::std::default_accessor< typename LINALG_EXPRESSIONS::inverse_expression< Matrix >::value_type >;
+};
+
+//--------------------
+//  Allocator Result
+//--------------------
+
+template < class Matrix >
+struct allocator_result< LINALG_EXPRESSIONS::inverse_expression< Matrix > >
+{
+  using type = ::std::allocator< typename LINALG_EXPRESSIONS::inverse_expression< Matrix >::value_type >;
+  [[nodiscard]] static inline constexpr type get_allocator( [[maybe_unused]] const LINALG_EXPRESSIONS::inverse_expression< Matrix >& t ) noexcept
+    { return type(); }
+};
+
+//-----------------
+//  Layout Result
+//-----------------
+
+template < class Matrix >
+struct layout_result< LINALG_EXPRESSIONS::inverse_expression< Matrix > >
+{
+  using type = LINALG::default_layout;
+};
+
+LINALG_END // end linalg namespace
+
+LINALG_EXPRESSIONS_BEGIN // expressions namespace
+
+//----------------------
+//  Inverse Expression
+//----------------------
+
+/// @brief Expression for the inverse of a square matrix, evaluated through a cached factorization
+/// @tparam Matrix square matrix expression, reference qualified
+template < class Matrix >
+class inverse_expression
+{
+  private:
+    using matrix_type = ::std::remove_reference_t< Matrix >;
+  public:
+    // Aliases
+    using value_type     = ::std::remove_cv_t< typename matrix_type::value_type >;
+    using index_type     = typename matrix_type::index_type;
+    using size_type      = typename matrix_type::size_type;
+    using extents_type   = typename matrix_type::extents_type;
+    using rank_type      = typename matrix_type::rank_type;
+    using evaluated_type = LINALG_DETAIL::solution_type_t< value_type, matrix_type >;
+  private:
+    using lu_type       = LINALG::lu_factorization< evaluated_type >;
+    using cholesky_type = LINALG::cholesky_factorization< evaluated_type >;
+  public:
+    // Special member functions
+    constexpr inverse_expression( Matrix&& m ) : m_( m ), lu_(), cholesky_(), inverse_()
+    {
+      if ( static_cast< ::std::size_t >( m.extent(0) ) != static_cast< ::std::size_t >( m.extent(1) ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Matrix extents are incompatable." );
+      }
+    }
+    // Tensor expression functions
+    [[nodiscard]] static constexpr rank_type rank() noexcept { return matrix_type::rank(); }
+    [[nodiscard]] constexpr extents_type extents() const noexcept { return this->m_.extents(); }
+    [[nodiscard]] constexpr index_type extent( rank_type n ) const noexcept { return this->m_.extent( n ); }
+    // Unary tensor expression function
+    [[nodiscard]] constexpr const matrix_type& underlying() const noexcept { return this->m_; }
+    // Inverse
+    #if LINALG_USE_BRACKET_OPERATOR
+    template < class ... OtherIndexType >
+    [[nodiscard]] value_type operator[]( OtherIndexType ... indices ) const
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ( sizeof...( OtherIndexType ) == rank() ) && ( ::std::is_convertible_v< OtherIndexType, index_type > && ... )
+    #endif
+      { return LINALG_DETAIL::access( this->inverse(), indices ... ); }
+    #endif
+    #if LINALG_USE_PAREN_OPERATOR
+    template < class ... OtherIndexType >
+    [[nodiscard]] value_type operator()( OtherIndexType ... indices ) const
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ( sizeof...( OtherIndexType ) == rank() ) && ( ::std::is_convertible_v< OtherIndexType, index_type > && ... )
+    #endif
+      { return LINALG_DETAIL::access( this->inverse(), indices ... ); }
+    #endif
+    // Implicit conversion
+    [[nodiscard]] operator evaluated_type() const { return this->evaluate(); }
+    // Evaluated expression
+    [[nodiscard]] evaluated_type evaluate() const
+    {
+      evaluated_type x = this->identity();
+      this->solve_in_place( x );
+      return x;
+    }
+    // Factorization
+    /// @brief Factors the matrix, unless a factorization is already cached
+    /// @throw domain_error if the matrix is singular
+    void factor() const
+    {
+      if ( this->lu_ || this->cholesky_ )
+      {
+        return;
+      }
+      if ( LINALG_DETAIL::is_symmetric< LINALG_DETAIL::is_complex_v< value_type > >( this->m_ ) )
+      {
+        try
+        {
+          this->cholesky_.emplace( LINALG_DETAIL::make_solution< value_type >( this->m_ ) );
+          return;
+        }
+        catch ( const ::std::domain_error& )
+        {
+          // Symmetric but indefinite
+        }
+      }
+      this->lu_.emplace( LINALG_DETAIL::make_solution< value_type >( this->m_ ) );
+    }
+    /// @brief Returns true if the cached factorization is a Cholesky factorization
+    [[nodiscard]] bool is_cholesky() const noexcept { return this->cholesky_.has_value(); }
+    /// @brief Returns true if the explicit inverse has been evaluated for element access
+    [[nodiscard]] bool has_inverse() const noexcept { return this->inverse_.has_value(); }
+    /// @brief Overwrites x, a writable vector or matrix of right hand sides, with inverse( a ) * x
+    /// @throw domain_error if the matrix is singular
+    template < class Solution >
+    void solve_in_place( Solution& x ) const
+    {
+      this->factor();
+      if ( this->cholesky_ )
+      {
+        this->cholesky_->solve_in_place( x );
+      }
+      else
+      {
+        this->lu_->solve_in_place( x );
+      }
+    }
+    /// @brief Returns inverse( a ) * b for a vector or a matrix of right hand sides
+    /// @throw domain_error if the matrix is singular
+    template < class Rhs >
+    [[nodiscard]] auto solve( const Rhs& b ) const
+    {
+      auto x = LINALG_DETAIL::make_solution< value_type >( b );
+      this->solve_in_place( x );
+      return x;
+    }
+  private:
+    // Identity matrix of the same extents
+    [[nodiscard]] evaluated_type identity() const
+    {
+      evaluated_type x = LINALG_DETAIL::make_solution< value_type >( this->m_ );
+      for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( x.extent(0) ); ++i )
+      {
+        for ( ::std::size_t j = 0; j < static_cast< ::std::size_t >( x.extent(1) ); ++j )
+        {
+          LINALG_DETAIL::access( x, i, j ) = value_type( ( i == j ) ? 1 : 0 );
+        }
+      }
+      return x;
+    }
+    // Explicit inverse, evaluated once for element access
+    [[nodiscard]] const evaluated_type& inverse() const
+    {
+      if ( !this->inverse_ )
+      {
+        this->inverse_.emplace( this->evaluate() );
+      }
+      return *this->inverse_;
+    }
+    // Data
+    Matrix&                                   m_;
+    mutable ::std::optional< lu_type >        lu_;
+    mutable ::std::optional< cholesky_type >  cholesky_;
+    mutable ::std::optional< evaluated_type > inverse_;
+};
+
+LINALG_EXPRESSIONS_END // end expressions namespace
+
+LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
+
+//-------------------
+//  Inverse Product
+//-------------------
+
+/// @brief Evaluates inverse( a ) * b into t as a solve with the cached factorization of a
+template < class Tensor, class Inverse, class Rhs >
+void inverse_product( Tensor& t, const Inverse& inv, const Rhs& b )
+{
+  // Factor first, so a may share storage with t
+  inv.factor();
+  if ( LINALG_DETAIL::is_same_view( b, t ) )
+  {
+    inv.solve_in_place( t );
+  }
+  else if ( ( t.extents() != b.extents() ) || LINALG_DETAIL::overlaps( b, t ) )
+  {
+    t = inv.solve( b );
+  }
+  else
+  {
+    LINALG_DETAIL::copy_view( t, b );
+    inv.solve_in_place( t );
+  }
+}
+
+LINALG_EXPRESSIONS_DETAIL_END // expressions detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//-------------------------------
+//  Inverse Product Assignment
+//-------------------------------
+
+#ifdef LINALG_ENABLE_CONCEPTS
+
+template < class Tensor, class Matrix, class SecondMatrix >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_product_expression< const LINALG_EXPRESSIONS::inverse_expression< Matrix >&, SecondMatrix > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::matrix_product_expression< const LINALG_EXPRESSIONS::inverse_expression< Matrix >&, SecondMatrix >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    LINALG_EXPRESSIONS_DETAIL::with_solved( expr.second(), [&]( const auto& b ) { LINALG_EXPRESSIONS_DETAIL::inverse_product( t, expr.first(), b ); } );
+    return true;
+  }
+};
+
+template < class Tensor, class Matrix, class Vector >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_vector_product_expression< const LINALG_EXPRESSIONS::inverse_expression< Matrix >&, Vector > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::matrix_vector_product_expression< const LINALG_EXPRESSIONS::inverse_expression< Matrix >&, Vector >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    LINALG_EXPRESSIONS_DETAIL::with_solved( expr.second(), [&]( const auto& b ) { LINALG_EXPRESSIONS_DETAIL::inverse_product( t, expr.first(), b ); } );
+    return true;
+  }
+};
+
+#else
+
+template < class Tensor, class Matrix, class SecondMatrix, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_product_expression< const LINALG_EXPRESSIONS::inverse_expression< Matrix >&, SecondMatrix, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::matrix_product_expression< const LINALG_EXPRESSIONS::inverse_expression< Matrix >&, SecondMatrix, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    LINALG_EXPRESSIONS_DETAIL::with_solved( expr.second(), [&]( const auto& b ) { LINALG_EXPRESSIONS_DETAIL::inverse_product( t, expr.first(), b ); } );
+    return true;
+  }
+};
+
+template < class Tensor, class Matrix, class Vector, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_vector_product_expression< const LINALG_EXPRESSIONS::inverse_expression< Matrix >&, Vector, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::matrix_vector_product_expression< const LINALG_EXPRESSIONS::inverse_expression< Matrix >&, Vector, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    LINALG_EXPRESSIONS_DETAIL::with_solved( expr.second(), [&]( const auto& b ) { LINALG_EXPRESSIONS_DETAIL::inverse_product( t, expr.first(), b ); } );
+    return true;
+  }
+};
+
+#endif
+
+//-----------
+//  Inverse
+//-----------
+
+/// @brief Returns an expression for the inverse of a square matrix, which products are evaluated against by solving
+/// @param m square matrix
+/// @throw length_error if m is not square
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M >
+  requires LINALG_CONCEPTS::matrix_expression< M >
+#else
+template < class M,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< M > > >
+#endif
+[[nodiscard]] inline auto inverse( const M& m )
+{
+  return LINALG_EXPRESSIONS::inverse_expression< const M& >( m );
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_INVERSE_HPP
@@ -0,0 +1,631 @@
+//==================================================================================================
+//  File:       iterative_eigen.hpp
+//
+//  Summary:    This header defines iterative eigensolvers for a few eigenpairs at one end of the
+//              spectrum of a large symmetric operator known only through its products:
+//              eigen_target
+//              partial_eigendecomposition< T >
+//              lanczos_eigen( const Operator& a, count[, eigen_target target[, tolerance[, restarts]]] )
+//              lobpcg_eigen( const Operator& a, count[, eigen_target target[, tolerance[, iterations]]] )
+//
+//              The operator is a linear_operator or a matrix. lanczos_eigen builds a Krylov basis of
+//              twice the count plus a margin, fully reorthogonalized, and restarts it implicitly: shifted
+//              QR steps on the projected tridiagonal matrix, with the unwanted Ritz values as shifts,
+//              compress the basis onto the wanted ones without leaving tridiagonal form, so the projected
+//              problem is always solved by QL iteration. An operator of no larger order than that basis
+//              is formed from its products with the unit vectors and solved densely instead. Being a
+//              single vector method, it finds only one eigenvector of a multiple eigenvalue.
+//              lobpcg_eigen iterates a block of count vectors with the locally optimal block
+//              preconditioned conjugate gradient method of Knyazev, so it finds every copy, in the basis
+//              [ X P W ] kept orthonormal: the Rayleigh-Ritz problem is a small standard one solved by
+//              Jacobi rotations, and the residuals of converged pairs leave it.
+//
+//              Both solvers allocate their whole workspace before iterating. Convergence is declared
+//              when every residual norm || A x - lambda x || is at most the tolerance times the largest
+//              Ritz value in magnitude.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_ITERATIVE_EIGEN_HPP
+#define LINEAR_ALGEBRA_ITERATIVE_EIGEN_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_BEGIN // linalg namespace
+
+/// @brief End of the spectrum an iterative eigensolver converges to
+enum class eigen_target
+{
+  smallest, // Algebraically smallest eigenvalues
+  largest   // Algebraically largest eigenvalues
+};
+
+/// @brief Eigenpairs at one end of the spectrum of a symmetric operator, with the eigenvalues ascending
+/// @tparam T element type
+template < class T >
+class partial_eigendecomposition
+{
+  public:
+    //- Aliases
+    using value_type   = T;
+    using values_type  = LINALG::dyn_tensor< T, 1 >;
+    using vectors_type = LINALG::dyn_tensor< T, 2 >;
+
+    //- Constructors
+    /// @brief Holds the eigenvalues, the eigenvectors as columns and the iterations taken to find them
+    partial_eigendecomposition( values_type values, vectors_type vectors, ::std::size_t iterations ) :
+      values_( ::std::move( values ) ), vectors_( ::std::move( vectors ) ), iterations_( iterations ) { }
+
+    //- Decomposition
+    /// @brief Returns the eigenvalues in ascending order
+    [[nodiscard]] constexpr const values_type& values() const noexcept { return this->values_; }
+    /// @brief Returns the orthonormal eigenvectors as columns, in the order of the eigenvalues
+    [[nodiscard]] constexpr const vectors_type& vectors() const noexcept { return this->vectors_; }
+    /// @brief Returns the restarts or iterations taken
+    [[nodiscard]] constexpr ::std::size_t iterations() const noexcept { return this->iterations_; }
+
+  private:
+    //- Data
+    values_type   values_;
+    vectors_type  vectors_;
+    ::std::size_t iterations_;
+};
+
+LINALG_END // end linalg namespace
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//--------------------------
+//  Iterative Eigensolvers
+//--------------------------
+
+// Restarts of the Lanczos iteration before giving up
+inline constexpr ::std::size_t lanczos_restart_limit = 1000;
+
+// Iterations of LOBPCG before giving up
+inline constexpr ::std::size_t lobpcg_iteration_limit = 1000;
+
+// Krylov basis vectors kept beyond twice the count of wanted eigenpairs
+inline constexpr ::std::size_t lanczos_basis_margin = 20;
+
+/// @brief Returns the default tolerance on residual norms relative to the largest Ritz value, sqrt( eps )
+template < class T >
+[[nodiscard]] T iterative_eigen_tolerance() noexcept
+{
+  return ::std::sqrt( ::std::numeric_limits< T >::epsilon() );
+}
+
+/// @brief Orthogonalizes basis[j] against basis[0:j] twice, applying the same combination to images[j] if given,
+///        and normalizes it
+/// @return false if basis[j] lies in the span of the others to working accuracy
+template < class T >
+[[nodiscard]] bool orthonormalize_vector( ::std::vector< LINALG::dyn_tensor< T, 1 > >& basis, ::std::vector< LINALG::dyn_tensor< T, 1 > >* images, ::std::size_t j )
+{
+  const T before = ::std::sqrt( dot_product( basis[j], basis[j] ) );
+  for ( ::std::size_t pass = 0; pass < 2; ++pass )
+  {
+    for ( ::std::size_t i = 0; i < j; ++i )
+    {
+      const T h = dot_product( basis[i], basis[j] );
+      add_scaled( basis[j], -h, basis[i] );
+      if ( images != nullptr )
+      {
+        add_scaled( ( *images )[j], -h, ( *images )[i] );
+      }
+    }
+  }
+  const T after = ::std::sqrt( dot_product( basis[j], basis[j] ) );
+  if ( !( after > ::std::sqrt( ::std::numeric_limits< T >::epsilon() ) * before ) )
+  {
+    return false;
+  }
+  scale_vector( basis[j], T( 1 ) / after );
+  if ( images != nullptr )
+  {
+    scale_vector( ( *images )[j], T( 1 ) / after );
+  }
+  return true;
+}
+
+/// @brief Sets result to the sum over first <= i < count of basis[i] c( i, column )
+template < class T, class C >
+void basis_combination( LINALG::dyn_tensor< T, 1 >& result, const ::std::vector< LINALG::dyn_tensor< T, 1 > >& basis, ::std::size_t first, ::std::size_t count,
+                        const matrix_block< C >& c, ::std::size_t column )
+{
+  for ( ::std::size_t r = 0; r < static_cast< ::std::size_t >( result.extent(0) ); ++r )
+  {
+    LINALG_DETAIL::access( result, r ) = T( 0 );
+  }
+  for ( ::std::size_t i = first; i < count; ++i )
+  {
+    add_scaled( result, static_cast< T >( c( i, column ) ), basis[i] );
+  }
+}
+
+/// @brief Sorts the indices of the n values into order, ascending by value
+/// @return the position in order of the first of the count values wanted
+template < class T >
+[[nodiscard]] ::std::size_t select_wanted( const T* values, ::std::size_t* order, ::std::size_t n, ::std::size_t count, LINALG::eigen_target target )
+{
+  ::std::iota( order, order + n, ::std::size_t( 0 ) );
+  ::std::sort( order, order + n, [values]( ::std::size_t x, ::std::size_t y ) { return values[x] < values[y]; } );
+  return ( target == LINALG::eigen_target::smallest ) ? 0 : n - count;
+}
+
+//--------------------------------
+//  Implicitly Restarted Lanczos
+//--------------------------------
+
+/// @brief Krylov basis, projected tridiagonal matrix and the work arrays of the restarted Lanczos iteration
+template < class T >
+struct lanczos_workspace
+{
+  using vector_type = LINALG::dyn_tensor< T, 1 >;
+  using matrix_type = LINALG::dyn_tensor< T, 2 >;
+
+  lanczos_workspace( ::std::size_t n, ::std::size_t m ) :
+    basis( m + 1, vector_type( typename vector_type::extents_type( n ) ) ), next( m + 1, vector_type( typename vector_type::extents_type( n ) ) ),
+    alpha( m ), beta( m ), d( m ), e( m ), order( m ),
+    z( typename matrix_type::extents_type( m, m ) ), q( typename matrix_type::extents_type( m, m ) ), t( typename matrix_type::extents_type( m, m ) ) { }
+
+  ::std::vector< vector_type >   basis;  // v_0 ... v_m
+  ::std::vector< vector_type >   next;   // The basis compressed by a restart
+  ::std::vector< T >             alpha;  // Diagonal of the projected matrix
+  ::std::vector< T >             beta;   // Subdiagonal, with beta[m-1] the norm of the residual
+  ::std::vector< T >             d;      // Ritz values
+  ::std::vector< T >             e;
+  ::std::vector< ::std::size_t > order;
+  matrix_type                    z;      // Eigenvectors of the projected matrix
+  matrix_type                    q;      // Accumulated restart rotations
+  matrix_type                    t;      // Projected matrix during a restart
+};
+
+/// @brief Replaces basis[j] by a random unit vector orthogonal to basis[0:j], or zero if there is none
+template < class T, class Engine >
+void random_basis_vector( ::std::vector< LINALG::dyn_tensor< T, 1 > >& basis, ::std::size_t j, Engine& engine )
+{
+  gaussian_vector( basis[j], engine );
+  if ( !orthonormalize_vector( basis, static_cast< ::std::vector< LINALG::dyn_tensor< T, 1 > >* >( nullptr ), j ) )
+  {
+    scale_vector( basis[j], T( 0 ) );
+  }
+}
+
+/// @brief Extends the Lanczos factorization A V_j = V_j T_j + beta_j-1 v_j e_j^T from first to m steps
+template < class T, class Operator, class Engine >
+void lanczos_extend( const Operator& a, lanczos_workspace< T >& w, ::std::size_t first, ::std::size_t m, T& norm, Engine& engine )
+{
+  const T eps = ::std::numeric_limits< T >::epsilon();
+  for ( ::std::size_t j = first; j < m; ++j )
+  {
+    a.apply( w.basis[j], w.basis[ j + 1 ] );
+    // Full reorthogonalization, twice; the projections on v_j accumulate alpha_j
+    T alpha = T( 0 );
+    for ( ::std::size_t pass = 0; pass < 2; ++pass )
+    {
+      for ( ::std::size_t i = 0; i <= j; ++i )
+      {
+        const T h = dot_product( w.basis[i], w.basis[ j + 1 ] );
+        add_scaled( w.basis[ j + 1 ], -h, w.basis[i] );
+        alpha += ( i == j ) ? h : T( 0 );
+      }
+    }
+    const T beta = ::std::sqrt( dot_product( w.basis[ j + 1 ], w.basis[ j + 1 ] ) );
+    w.alpha[j] = alpha;
+    norm       = ::std::max( norm, ::std::abs( alpha ) + beta );
+    if ( beta <= eps * norm )
+    {
+      // An invariant subspace was found: continue from a random vector orthogonal to it
+      w.beta[j] = T( 0 );
+      random_basis_vector( w.basis, j + 1, engine );
+    }
+    else
+    {
+      w.beta[j] = beta;
+      scale_vector( w.basis[ j + 1 ], T( 1 ) / beta );
+    }
+  }
+}
+
+/// @brief Applies the rotation of rows and columns k and k + 1 by c and s to the band of the symmetric t,
+///        and accumulates it into the columns of q
+template < class T >
+void rotate_tridiagonal( LINALG::dyn_tensor< T, 2 >& t, LINALG::dyn_tensor< T, 2 >& q, ::std::size_t k, T c, T s )
+{
+  const ::std::size_t m     = static_cast< ::std::size_t >( t.extent(0) );
+  const ::std::size_t first = ( k == 0 ) ? 0 : k - 1;
+  const ::std::size_t last  = ::std::min( m, k + 3 );
+  for ( ::std::size_t j = first; j < last; ++j )
+  {
+    const T t_k = LINALG_DETAIL::access( t, k, j );
+    const T t_l = LINALG_DETAIL::access( t, k + 1, j );
+    LINALG_DETAIL::access( t, k, j )     = c * t_k + s * t_l;
+    LINALG_DETAIL::access( t, k + 1, j ) = c * t_l - s * t_k;
+  }
+  for ( ::std::size_t i = first; i < last; ++i )
+  {
+    const T t_k = LINALG_DETAIL::access( t, i, k );
+    const T t_l = LINALG_DETAIL::access( t, i, k + 1 );
+    LINALG_DETAIL::access( t, i, k )     = c * t_k + s * t_l;
+    LINALG_DETAIL::access( t, i, k + 1 ) = c * t_l - s * t_k;
+  }
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( q.extent(0) ); ++i )
+  {
+    const T q_k = LINALG_DETAIL::access( q, i, k );
+    const T q_l = LINALG_DETAIL::access( q, i, k + 1 );
+    LINALG_DETAIL::access( q, i, k )     = c * q_k + s * q_l;
+    LINALG_DETAIL::access( q, i, k + 1 ) = c * q_l - s * q_k;
+  }
+}
+
+/// @brief Compresses the m step factorization to keep steps with the m - keep shifts given, by implicitly shifted QR
+template < class T, class Engine >
+void lanczos_restart( lanczos_workspace< T >& w, ::std::size_t m, ::std::size_t keep, const T* shifts, Engine& engine )
+{
+  auto& t = w.t;
+  auto& q = w.q;
+  for ( ::std::size_t i = 0; i < m; ++i )
+  {
+    for ( ::std::size_t j = 0; j < m; ++j )
+    {
+      LINALG_DETAIL::access( t, i, j ) = ( i == j ) ? w.alpha[i] : ( i == j + 1 ) ? w.beta[j] : ( j == i + 1 ) ? w.beta[i] : T( 0 );
+      LINALG_DETAIL::access( q, i, j ) = T( ( i == j ) ? 1 : 0 );
+    }
+  }
+  for ( ::std::size_t s = 0; s + keep < m; ++s )
+  {
+    // Chase the bulge of the QR step shifted by shifts[s] down the band
+    T x = LINALG_DETAIL::access( t, 0, 0 ) - shifts[s];
+    T y = LINALG_DETAIL::access( t, 1, 0 );
+    for ( ::std::size_t k = 0; k + 1 < m; ++k )
+    {
+      if ( k > 0 )
+      {
+        x = LINALG_DETAIL::access( t, k, k - 1 );
+        y = LINALG_DETAIL::access( t, k + 1, k - 1 );
+      }
+      const T r = ::std::hypot( x, y );
+      if ( r == T( 0 ) )
+      {
+        continue;
+      }
+      rotate_tridiagonal( t, q, k, x / r, y / r );
+      if ( k > 0 )
+      {
+        LINALG_DETAIL::access( t, k + 1, k - 1 ) = T( 0 );
+        LINALG_DETAIL::access( t, k - 1, k + 1 ) = T( 0 );
+      }
+    }
+  }
+  // V_keep = V_m Q( :, 0:keep ), and the residual is v_keep t( keep, keep - 1 ) + beta_m-1 v_m q( m - 1, keep - 1 )
+  const auto rotations = make_block( q );
+  for ( ::std::size_t j = 0; j <= keep; ++j )
+  {
+    basis_combination( w.next[j], w.basis, 0, m, rotations, j );
+  }
+  scale_vector( w.next[ keep ], LINALG_DETAIL::access( t, keep, keep - 1 ) );
+  add_scaled( w.next[ keep ], w.beta[ m - 1 ] * LINALG_DETAIL::access( q, m - 1, keep - 1 ), w.basis[m] );
+  for ( ::std::size_t j = 0; j <= keep; ++j )
+  {
+    ::std::swap( w.basis[j], w.next[j] );
+  }
+  for ( ::std::size_t j = 0; j < keep; ++j )
+  {
+    w.alpha[j] = LINALG_DETAIL::access( t, j, j );
+    w.beta[j]  = LINALG_DETAIL::access( t, j + 1, j );
+  }
+  const T beta = ::std::sqrt( dot_product( w.basis[ keep ], w.basis[ keep ] ) );
+  w.beta[ keep - 1 ] = beta;
+  if ( beta == T( 0 ) )
+  {
+    random_basis_vector( w.basis, keep, engine );
+  }
+  else
+  {
+    scale_vector( w.basis[ keep ], T( 1 ) / beta );
+  }
+}
+
+/// @brief Finds count eigenpairs at the target end of the spectrum of the symmetric operator a
+/// @throw domain_error if they do not converge within the restarts
+template < class T, class Operator >
+[[nodiscard]] LINALG::partial_eigendecomposition< T >
+lanczos_solve( const Operator& a, ::std::size_t count, LINALG::eigen_target target, T tolerance, ::std::size_t restarts )
+{
+  using values_type  = LINALG::dyn_tensor< T, 1 >;
+  using vectors_type = LINALG::dyn_tensor< T, 2 >;
+  const ::std::size_t n = a.extent(0);
+  count = ::std::min( count, n );
+  values_type  values { typename values_type::extents_type( count ) };
+  vectors_type vectors( typename vectors_type::extents_type( n, count ) );
+  if ( count == 0 )
+  {
+    return LINALG::partial_eigendecomposition< T >( ::std::move( values ), ::std::move( vectors ), 0 );
+  }
+  const ::std::size_t m = ::std::min( n, ::std::max( 2 * count + 1, count + lanczos_basis_margin ) );
+  if ( m == n )
+  {
+    // The basis would span the whole space, so the operator is formed and solved densely instead
+    vectors_type dense( typename vectors_type::extents_type( n, n ) );
+    values_type  unit { typename values_type::extents_type( n ) };
+    values_type  column { typename values_type::extents_type( n ) };
+    for ( ::std::size_t j = 0; j < n; ++j )
+    {
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        LINALG_DETAIL::access( unit, i ) = T( ( i == j ) ? 1 : 0 );
+      }
+      a.apply( unit, column );
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        LINALG_DETAIL::access( dense, i, j ) = LINALG_DETAIL::access( column, i );
+      }
+    }
+    ::std::vector< T > w( n );
+    vectors_type       z;
+    symmetric_eigen_solve( dense, n, w.data(), &z );
+    const ::std::size_t wanted = ( target == LINALG::eigen_target::smallest ) ? 0 : n - count;
+    for ( ::std::size_t c = 0; c < count; ++c )
+    {
+      LINALG_DETAIL::access( values, c ) = w[ wanted + c ];
+      for ( ::std::size_t r = 0; r < n; ++r )
+      {
+        LINALG_DETAIL::access( vectors, r, c ) = LINALG_DETAIL::access( z, r, wanted + c );
+      }
+    }
+    return LINALG::partial_eigendecomposition< T >( ::std::move( values ), ::std::move( vectors ), 0 );
+  }
+  lanczos_workspace< T > w( n, m );
+  ::std::vector< T >     shifts( m );
+  ::std::mt19937_64      engine;
+  T                      norm = T( 0 );
+  random_basis_vector( w.basis, 0, engine );
+  ::std::size_t first = 0;
+  for ( ::std::size_t restart = 0; restart <= restarts; ++restart )
+  {
+    lanczos_extend( a, w, first, m, norm, engine );
+    // Ritz pairs of the projected matrix
+    ::std::copy( w.alpha.begin(), w.alpha.begin() + m, w.d.begin() );
+    ::std::copy( w.beta.begin(), w.beta.begin() + m, w.e.begin() );
+    w.e[ m - 1 ] = T( 0 );
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t j = 0; j < m; ++j )
+      {
+        LINALG_DETAIL::access( w.z, i, j ) = T( ( i == j ) ? 1 : 0 );
+      }
+    }
+    tridiagonal_ql( w.d.data(), w.e.data(), m, &w.z );
+    const ::std::size_t wanted = select_wanted( w.d.data(), w.order.data(), m, count, target );
+    const T             limit  = tolerance * ::std::max( ::std::abs( w.d[ w.order[0] ] ), ::std::abs( w.d[ w.order[ m - 1 ] ] ) );
+    ::std::size_t       converged = 0;
+    for ( ::std::size_t i = wanted; i < wanted + count; ++i )
+    {
+      converged += ( ::std::abs( w.beta[ m - 1 ] * LINALG_DETAIL::access( w.z, m - 1, w.order[i] ) ) <= limit ) ? 1 : 0;
+    }
+    if ( converged == count )
+    {
+      const auto ritz = make_block( w.z );
+      for ( ::std::size_t c = 0; c < count; ++c )
+      {
+        const ::std::size_t i = w.order[ wanted + c ];
+        LINALG_DETAIL::access( values, c ) = w.d[i];
+        basis_combination( w.next[0], w.basis, 0, m, ritz, i );
+        for ( ::std::size_t r = 0; r < n; ++r )
+        {
+          LINALG_DETAIL::access( vectors, r, c ) = LINALG_DETAIL::access( w.next[0], r );
+        }
+      }
+      return LINALG::partial_eigendecomposition< T >( ::std::move( values ), ::std::move( vectors ), restart );
+    }
+    // Keep the wanted Ritz values and, as they converge, more of their neighbours; the rest are the shifts
+    const ::std::size_t keep = count + ::std::min( converged, ( m - count ) / 2 );
+    const ::std::size_t skip = ( target == LINALG::eigen_target::smallest ) ? keep : 0;
+    for ( ::std::size_t s = 0; s + keep < m; ++s )
+    {
+      shifts[s] = w.d[ w.order[ skip + s ] ];
+    }
+    lanczos_restart( w, m, keep, shifts.data(), engine );
+    first = keep;
+  }
+  throw ::std::domain_error( "Eigenvalue iteration did not converge." );
+}
+
+//----------
+//  LOBPCG
+//----------
+
+/// @brief Basis [ X P W ], its image under the operator and the work arrays of LOBPCG for a block of k vectors
+template < class T >
+struct lobpcg_workspace
+{
+  using vector_type = LINALG::dyn_tensor< T, 1 >;
+  using matrix_type = LINALG::dyn_tensor< T, 2 >;
+
+  lobpcg_workspace( ::std::size_t n, ::std::size_t k ) :
+    basis( 3 * k, vector_type( typename vector_type::extents_type( n ) ) ), images( 3 * k, vector_type( typename vector_type::extents_type( n ) ) ),
+    next( 2 * k, vector_type( typename vector_type::extents_type( n ) ) ), next_images( 2 * k, vector_type( typename vector_type::extents_type( n ) ) ),
+    gram( typename matrix_type::extents_type( 3 * k, 3 * k ) ), coefficients( typename matrix_type::extents_type( 3 * k, 3 * k ) ),
+    ritz( 3 * k ), order( 3 * k ), lambda( k ), residuals( k ) { }
+
+  ::std::vector< vector_type >   basis;        // X, then P, then W
+  ::std::vector< vector_type >   images;       // A applied to the basis
+  ::std::vector< vector_type >   next;         // The next X and P
+  ::std::vector< vector_type >   next_images;
+  matrix_type                    gram;         // Rayleigh-Ritz matrix of the basis
+  matrix_type                    coefficients; // Its eigenvectors
+  ::std::vector< T >             ritz;
+  ::std::vector< ::std::size_t > order;
+  ::std::vector< T >             lambda;       // Ritz values of X
+  ::std::vector< T >             residuals;    // Residual norms of X
+};
+
+/// @brief Rayleigh-Ritz on the first size vectors of the orthonormal basis, of which the first k are X
+/// X and its images become the wanted Ritz vectors, and P the part of them outside the span of X.
+/// @return the largest Ritz value in magnitude
+/// @throw domain_error if the Jacobi rotations do not converge
+template < class T >
+[[nodiscard]] T lobpcg_rayleigh_ritz( lobpcg_workspace< T >& w, ::std::size_t k, ::std::size_t size, LINALG::eigen_target target )
+{
+  const auto gram         = make_block( w.gram ).block( 0, 0, size, size );
+  const auto coefficients = make_block( w.coefficients ).block( 0, 0, size, size );
+  for ( ::std::size_t i = 0; i < size; ++i )
+  {
+    for ( ::std::size_t j = 0; j <= i; ++j )
+    {
+      const T g = ( dot_product( w.basis[i], w.images[j] ) + dot_product( w.basis[j], w.images[i] ) ) / T( 2 );
+      gram( i, j ) = g;
+      gram( j, i ) = g;
+    }
+  }
+  jacobi_eigen( gram, coefficients, w.ritz.data() );
+  const ::std::size_t wanted = select_wanted( w.ritz.data(), w.order.data(), size, k, target );
+  for ( ::std::size_t c = 0; c < k; ++c )
+  {
+    const ::std::size_t i = w.order[ wanted + c ];
+    w.lambda[c] = w.ritz[i];
+    basis_combination( w.next[c], w.basis, 0, size, coefficients, i );
+    basis_combination( w.next_images[c], w.images, 0, size, coefficients, i );
+    basis_combination( w.next[ k + c ], w.basis, k, size, coefficients, i );
+    basis_combination( w.next_images[ k + c ], w.images, k, size, coefficients, i );
+  }
+  for ( ::std::size_t c = 0; c < 2 * k; ++c )
+  {
+    ::std::swap( w.basis[c], w.next[c] );
+    ::std::swap( w.images[c], w.next_images[c] );
+  }
+  return ::std::max( ::std::abs( w.ritz[ w.order[0] ] ), ::std::abs( w.ritz[ w.order[ size - 1 ] ] ) );
+}
+
+/// @brief Finds count eigenpairs at the target end of the spectrum of the symmetric operator a
+/// @throw domain_error if they do not converge within the iterations
+template < class T, class Operator >
+[[nodiscard]] LINALG::partial_eigendecomposition< T >
+lobpcg_solve( const Operator& a, ::std::size_t count, LINALG::eigen_target target, T tolerance, ::std::size_t iterations )
+{
+  using values_type  = LINALG::dyn_tensor< T, 1 >;
+  using vectors_type = LINALG::dyn_tensor< T, 2 >;
+  const ::std::size_t n = a.extent(0);
+  const ::std::size_t k = ::std::min( count, n );
+  values_type  values { typename values_type::extents_type( k ) };
+  vectors_type vectors( typename vectors_type::extents_type( n, k ) );
+  if ( k == 0 )
+  {
+    return LINALG::partial_eigendecomposition< T >( ::std::move( values ), ::std::move( vectors ), 0 );
+  }
+  lobpcg_workspace< T > w( n, k );
+  ::std::mt19937_64     engine;
+  // Random initial block, orthonormal
+  for ( ::std::size_t j = 0; j < k; ++j )
+  {
+    do
+    {
+      gaussian_vector( w.basis[j], engine );
+    }
+    while ( !orthonormalize_vector( w.basis, static_cast< ::std::vector< LINALG::dyn_tensor< T, 1 > >* >( nullptr ), j ) );
+    a.apply( w.basis[j], w.images[j] );
+  }
+  ::std::size_t size = k;
+  for ( ::std::size_t iteration = 0; iteration <= iterations; ++iteration )
+  {
+    const T limit = tolerance * lobpcg_rayleigh_ritz( w, k, size, target );
+    // P, the previous step, orthonormalized against X with the images following along; W the residuals
+    ::std::size_t directions = 0;
+    if ( size > k )
+    {
+      for ( ::std::size_t j = k; j < 2 * k; ++j )
+      {
+        ::std::swap( w.basis[ k + directions ], w.basis[j] );
+        ::std::swap( w.images[ k + directions ], w.images[j] );
+        directions += orthonormalize_vector( w.basis, &w.images, k + directions ) ? 1 : 0;
+      }
+    }
+    size = k + directions;
+    bool converged = true;
+    for ( ::std::size_t c = 0; c < k; ++c )
+    {
+      auto& r = w.basis[ size ];
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        LINALG_DETAIL::access( r, i ) = LINALG_DETAIL::access( w.images[c], i ) - w.lambda[c] * LINALG_DETAIL::access( w.basis[c], i );
+      }
+      w.residuals[c] = ::std::sqrt( dot_product( r, r ) );
+      if ( w.residuals[c] > limit )
+      {
+        converged = false;
+        // Residuals of converged pairs are left out, so they do not spoil the basis
+        if ( orthonormalize_vector( w.basis, static_cast< ::std::vector< LINALG::dyn_tensor< T, 1 > >* >( nullptr ), size ) )
+        {
+          a.apply( w.basis[ size ], w.images[ size ] );
+          ++size;
+        }
+      }
+    }
+    if ( converged )
+    {
+      for ( ::std::size_t c = 0; c < k; ++c )
+      {
+        LINALG_DETAIL::access( values, c ) = w.lambda[c];
+        for ( ::std::size_t i = 0; i < n; ++i )
+        {
+          LINALG_DETAIL::access( vectors, i, c ) = LINALG_DETAIL::access( w.basis[c], i );
+        }
+      }
+      return LINALG::partial_eigendecomposition< T >( ::std::move( values ), ::std::move( vectors ), iteration );
+    }
+  }
+  throw ::std::domain_error( "Eigenvalue iteration did not converge." );
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//--------------------------
+//  Iterative Eigensolvers
+//--------------------------
+
+/// @brief Returns count eigenpairs at the target end of the spectrum of a real symmetric operator or matrix,
+///        by implicitly restarted Lanczos iteration
+/// @param tolerance largest residual norm relative to the largest Ritz value in magnitude, sqrt( eps ) by default
+/// @throw domain_error if the eigenpairs do not converge within the restarts
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Operator >
+  requires ( ( LINALG::is_linear_operator_v< Operator > || LINALG_CONCEPTS::matrix_expression< Operator > ) &&
+             ::std::is_floating_point_v< LINALG_DETAIL::operator_value_t< Operator > > )
+#else
+template < class Operator,
+           typename = ::std::enable_if_t< ( LINALG::is_linear_operator_v< Operator > || LINALG_CONCEPTS::matrix_expression_v< Operator > ) &&
+                                          ::std::is_floating_point_v< LINALG_DETAIL::operator_value_t< Operator > > > >
+#endif
+[[nodiscard]] partial_eigendecomposition< LINALG_DETAIL::operator_value_t< Operator > >
+lanczos_eigen( const Operator& a, ::std::size_t count, eigen_target target = eigen_target::largest,
+               LINALG_DETAIL::operator_value_t< Operator > tolerance = LINALG_DETAIL::iterative_eigen_tolerance< LINALG_DETAIL::operator_value_t< Operator > >(),
+               ::std::size_t restarts = LINALG_DETAIL::lanczos_restart_limit )
+{
+  return LINALG_DETAIL::lanczos_solve( LINALG_DETAIL::as_linear_operator( a ), count, target, tolerance, restarts );
+}
+
+/// @brief Returns count eigenpairs at the target end of the spectrum of a real symmetric operator or matrix,
+///        by the locally optimal block preconditioned conjugate gradient method
+/// @param tolerance largest residual norm relative to the largest Ritz value in magnitude, sqrt( eps ) by default
+/// @throw domain_error if the eigenpairs do not converge within the iterations
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Operator >
+  requires ( ( LINALG::is_linear_operator_v< Operator > || LINALG_CONCEPTS::matrix_expression< Operator > ) &&
+             ::std::is_floating_point_v< LINALG_DETAIL::operator_value_t< Operator > > )
+#else
+template < class Operator,
+           typename = ::std::enable_if_t< ( LINALG::is_linear_operator_v< Operator > || LINALG_CONCEPTS::matrix_expression_v< Operator > ) &&
+                                          ::std::is_floating_point_v< LINALG_DETAIL::operator_value_t< Operator > > > >
+#endif
+[[nodiscard]] partial_eigendecomposition< LINALG_DETAIL::operator_value_t< Operator > >
+lobpcg_eigen( const Operator& a, ::std::size_t count, eigen_target target = eigen_target::largest,
+              LINALG_DETAIL::operator_value_t< Operator > tolerance = LINALG_DETAIL::iterative_eigen_tolerance< LINALG_DETAIL::operator_value_t< Operator > >(),
+              ::std::size_t iterations = LINALG_DETAIL::lobpcg_iteration_limit )
+{
+  return LINALG_DETAIL::lobpcg_solve( LINALG_DETAIL::as_linear_operator( a ), count, target, tolerance, iterations );
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_ITERATIVE_EIGEN_HPP
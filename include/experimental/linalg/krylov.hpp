@@ -0,0 +1,801 @@
+//==================================================================================================
+//  File:       krylov.hpp
+//
+//  Summary:    This header defines Krylov subspace solvers of large linear systems A x = b and their
+//              preconditioners:
+//              identity_preconditioner
+//              jacobi_preconditioner< T >
+//              ilu0_preconditioner< T >
+//              make_jacobi_preconditioner( const Matrix& a )
+//              make_ilu0_preconditioner( const Matrix& a )
+//              cg_workspace< T >
+//              bicgstab_workspace< T >
+//              gmres_workspace< T >
+//              krylov_result< T >
+//              cg( const Operator& a, const Rhs& b, x, cg_workspace& w[, m[, tolerance[, iterations]]] )
+//              bicgstab( const Operator& a, const Rhs& b, x, bicgstab_workspace& w[, m[, tolerance[, iterations]]] )
+//              gmres( const Operator& a, const Rhs& b, x, gmres_workspace& w[, m[, tolerance[, iterations]]] )
+//
+//              The operator is a linear_operator or a matrix and b any vector expression; x holds the
+//              initial guess and receives the solution. Every vector a solver needs lives in a workspace
+//              sized once from the order of the system and reused by later solves, so an iteration
+//              applies the operator and the preconditioner and otherwise only streams over vectors it
+//              already owns, each update fused with the inner product that follows it in one pass.
+//
+//              cg is the preconditioned conjugate gradient method for symmetric positive definite
+//              systems, bicgstab the stabilized biconjugate gradient method and gmres restarted GMRES
+//              with modified Gram-Schmidt, both for general systems and right preconditioned. A
+//              preconditioner applies z = inverse( M ) r and returns r^T z from the same pass: Jacobi
+//              scales by the inverse diagonal, and ILU(0) factors A incompletely on the pattern of its
+//              nonzero elements, held by compressed rows, and solves with both triangles.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_KRYLOV_HPP
+#define LINEAR_ALGEBRA_KRYLOV_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_BEGIN // linalg namespace
+
+//-------------------
+//  Preconditioners
+//-------------------
+
+/// @brief Preconditioner M = I, leaving the solvers unpreconditioned
+class identity_preconditioner
+{
+  public:
+    /// @brief Sets z = r and returns r^T z
+    template < class T >
+    T apply( const LINALG::dyn_tensor< T, 1 >& r, LINALG::dyn_tensor< T, 1 >& z ) const
+    {
+      T sum = T( 0 );
+      for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( r.extent(0) ); ++i )
+      {
+        const T r_i = LINALG_DETAIL::access( r, i );
+        LINALG_DETAIL::access( z, i ) = r_i;
+        sum += r_i * r_i;
+      }
+      return sum;
+    }
+};
+
+/// @brief Jacobi preconditioner M = diag( A )
+/// @tparam T element type
+template < class T >
+class jacobi_preconditioner
+{
+  public:
+    //- Aliases
+    using value_type  = T;
+    using vector_type = LINALG::dyn_tensor< T, 1 >;
+
+    //- Constructors
+    /// @brief Constructs from the diagonal of A
+    /// @throw domain_error if an element of the diagonal is zero
+    explicit jacobi_preconditioner( vector_type diagonal ) : inverse_( ::std::move( diagonal ) )
+    {
+      for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( this->inverse_.extent(0) ); ++i )
+      {
+        if ( LINALG_DETAIL::access( this->inverse_, i ) == T( 0 ) ) LINALG_UNLIKELY
+        {
+          throw ::std::domain_error( "Matrix is singular." );
+        }
+        LINALG_DETAIL::access( this->inverse_, i ) = T( 1 ) / LINALG_DETAIL::access( this->inverse_, i );
+      }
+    }
+
+    //- Application
+    /// @brief Sets z = inverse( M ) r and returns r^T z
+    T apply( const vector_type& r, vector_type& z ) const
+    {
+      T sum = T( 0 );
+      for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( r.extent(0) ); ++i )
+      {
+        const T r_i = LINALG_DETAIL::access( r, i );
+        const T z_i = LINALG_DETAIL::access( this->inverse_, i ) * r_i;
+        LINALG_DETAIL::access( z, i ) = z_i;
+        sum += r_i * z_i;
+      }
+      return sum;
+    }
+
+  private:
+    //- Data
+    vector_type inverse_;
+};
+
+/// @brief Incomplete LU preconditioner M = L U with no fill: L and U keep the pattern of the nonzero elements of A
+/// @tparam T element type
+template < class T >
+class ilu0_preconditioner
+{
+  public:
+    //- Aliases
+    using value_type  = T;
+    using vector_type = LINALG::dyn_tensor< T, 1 >;
+
+    //- Constructors
+    /// @brief Factors the square matrix a, skipping its zero elements
+    /// @throw length_error if a is not square
+    /// @throw domain_error if a pivot is zero
+    template < class Matrix >
+    explicit ilu0_preconditioner( const Matrix& a ) : n_( static_cast< ::std::size_t >( a.extent(0) ) ), row_start_( n_ + 1, 0 ), diagonal_( n_ )
+    {
+      if ( this->n_ != static_cast< ::std::size_t >( a.extent(1) ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Matrix extents are incompatable." );
+      }
+      // Compressed rows of the nonzero elements and the diagonal, in column order
+      for ( ::std::size_t i = 0; i < this->n_; ++i )
+      {
+        for ( ::std::size_t j = 0; j < this->n_; ++j )
+        {
+          const T a_ij = static_cast< T >( LINALG_DETAIL::access( a, i, j ) );
+          if ( ( a_ij != T( 0 ) ) || ( i == j ) )
+          {
+            if ( i == j )
+            {
+              this->diagonal_[i] = this->columns_.size();
+            }
+            this->columns_.push_back( j );
+            this->values_.push_back( a_ij );
+          }
+        }
+        this->row_start_[ i + 1 ] = this->columns_.size();
+      }
+      // Row i of L U matches A on the pattern: eliminate with the rows above, dropping fill outside it
+      ::std::vector< ::std::size_t > position( this->n_, this->columns_.size() );
+      for ( ::std::size_t i = 0; i < this->n_; ++i )
+      {
+        for ( ::std::size_t p = this->row_start_[i]; p < this->row_start_[ i + 1 ]; ++p )
+        {
+          position[ this->columns_[p] ] = p;
+        }
+        for ( ::std::size_t p = this->row_start_[i]; p < this->diagonal_[i]; ++p )
+        {
+          const ::std::size_t k = this->columns_[p];
+          this->values_[p] /= this->values_[ this->diagonal_[k] ];
+          for ( ::std::size_t q = this->diagonal_[k] + 1; q < this->row_start_[ k + 1 ]; ++q )
+          {
+            if ( position[ this->columns_[q] ] != this->columns_.size() )
+            {
+              this->values_[ position[ this->columns_[q] ] ] -= this->values_[p] * this->values_[q];
+            }
+          }
+        }
+        if ( this->values_[ this->diagonal_[i] ] == T( 0 ) ) LINALG_UNLIKELY
+        {
+          throw ::std::domain_error( "Matrix is singular." );
+        }
+        for ( ::std::size_t p = this->row_start_[i]; p < this->row_start_[ i + 1 ]; ++p )
+        {
+          position[ this->columns_[p] ] = this->columns_.size();
+        }
+      }
+    }
+
+    //- Application
+    /// @brief Sets z = inverse( U ) inverse( L ) r and returns r^T z
+    T apply( const vector_type& r, vector_type& z ) const
+    {
+      for ( ::std::size_t i = 0; i < this->n_; ++i )
+      {
+        T sum = LINALG_DETAIL::access( r, i );
+        for ( ::std::size_t p = this->row_start_[i]; p < this->diagonal_[i]; ++p )
+        {
+          sum -= this->values_[p] * LINALG_DETAIL::access( z, this->columns_[p] );
+        }
+        LINALG_DETAIL::access( z, i ) = sum;
+      }
+      T dot = T( 0 );
+      for ( ::std::size_t i = this->n_; i-- > 0; )
+      {
+        T sum = LINALG_DETAIL::access( z, i );
+        for ( ::std::size_t p = this->diagonal_[i] + 1; p < this->row_start_[ i + 1 ]; ++p )
+        {
+          sum -= this->values_[p] * LINALG_DETAIL::access( z, this->columns_[p] );
+        }
+        const T z_i = sum / this->values_[ this->diagonal_[i] ];
+        LINALG_DETAIL::access( z, i ) = z_i;
+        dot += LINALG_DETAIL::access( r, i ) * z_i;
+      }
+      return dot;
+    }
+
+  private:
+    //- Data
+    ::std::size_t                  n_;
+    ::std::vector< ::std::size_t > row_start_;
+    ::std::vector< ::std::size_t > diagonal_;  // Position of the diagonal element of each row
+    ::std::vector< ::std::size_t > columns_;
+    ::std::vector< T >             values_;    // L below the diagonal, with a unit diagonal, and U from it
+};
+
+/// @brief Returns the Jacobi preconditioner of a square matrix
+/// @throw length_error if a is not square
+/// @throw domain_error if an element of the diagonal is zero
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::matrix_expression< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] jacobi_preconditioner< ::std::remove_cv_t< typename Matrix::value_type > > make_jacobi_preconditioner( const Matrix& a )
+{
+  using value_type  = ::std::remove_cv_t< typename Matrix::value_type >;
+  using vector_type = LINALG::dyn_tensor< value_type, 1 >;
+  const ::std::size_t n = static_cast< ::std::size_t >( a.extent(0) );
+  if ( n != static_cast< ::std::size_t >( a.extent(1) ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Matrix extents are incompatable." );
+  }
+  vector_type diagonal { typename vector_type::extents_type( n ) };
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    LINALG_DETAIL::access( diagonal, i ) = static_cast< value_type >( LINALG_DETAIL::access( a, i, i ) );
+  }
+  return jacobi_preconditioner< value_type >( ::std::move( diagonal ) );
+}
+
+/// @brief Returns the ILU(0) preconditioner of a square matrix, on the pattern of its nonzero elements
+/// @throw length_error if a is not square
+/// @throw domain_error if a pivot is zero
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::matrix_expression< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] ilu0_preconditioner< ::std::remove_cv_t< typename Matrix::value_type > > make_ilu0_preconditioner( const Matrix& a )
+{
+  return ilu0_preconditioner< ::std::remove_cv_t< typename Matrix::value_type > >( a );
+}
+
+//--------------
+//  Workspaces
+//--------------
+
+/// @brief Vectors of the conjugate gradient method for systems of order n; their contents between solves are unspecified
+template < class T >
+struct cg_workspace
+{
+  using value_type  = T;
+  using vector_type = LINALG::dyn_tensor< T, 1 >;
+
+  explicit cg_workspace( ::std::size_t n ) :
+    r { typename vector_type::extents_type( n ) }, z { typename vector_type::extents_type( n ) },
+    p { typename vector_type::extents_type( n ) }, q { typename vector_type::extents_type( n ) } { }
+
+  vector_type r; // Residual
+  vector_type z; // Preconditioned residual
+  vector_type p; // Search direction
+  vector_type q; // A p
+};
+
+/// @brief Vectors of the stabilized biconjugate gradient method for systems of order n
+template < class T >
+struct bicgstab_workspace
+{
+  using value_type  = T;
+  using vector_type = LINALG::dyn_tensor< T, 1 >;
+
+  explicit bicgstab_workspace( ::std::size_t n ) :
+    r { typename vector_type::extents_type( n ) }, shadow { typename vector_type::extents_type( n ) },
+    p { typename vector_type::extents_type( n ) }, v { typename vector_type::extents_type( n ) },
+    t { typename vector_type::extents_type( n ) }, p_hat { typename vector_type::extents_type( n ) },
+    s_hat { typename vector_type::extents_type( n ) } { }
+
+  vector_type r;      // Residual, and the intermediate residual s
+  vector_type shadow; // Initial residual
+  vector_type p;      // Search direction
+  vector_type v;      // A inverse( M ) p
+  vector_type t;      // A inverse( M ) s
+  vector_type p_hat;  // inverse( M ) p
+  vector_type s_hat;  // inverse( M ) s
+};
+
+/// @brief Krylov basis and Hessenberg matrix of GMRES restarted every restart steps, for systems of order n
+template < class T >
+struct gmres_workspace
+{
+  using value_type  = T;
+  using vector_type = LINALG::dyn_tensor< T, 1 >;
+  using matrix_type = LINALG::dyn_tensor< T, 2 >;
+
+  static constexpr ::std::size_t default_restart = 30;
+
+  explicit gmres_workspace( ::std::size_t n, ::std::size_t restart = default_restart ) :
+    basis( restart + 1, vector_type( typename vector_type::extents_type( n ) ) ), z { typename vector_type::extents_type( n ) },
+    hessenberg( typename matrix_type::extents_type( restart + 1, restart ) ), cosines( restart ), sines( restart ), g( restart + 1 ) { }
+
+  ::std::vector< vector_type > basis;      // Orthonormal basis v_0 ... v_restart
+  vector_type                  z;          // inverse( M ) v_j, then the correction of x
+  matrix_type                  hessenberg; // Projected operator, reduced to upper triangular form by Givens rotations
+  ::std::vector< T >           cosines;    // The rotations
+  ::std::vector< T >           sines;
+  ::std::vector< T >           g;          // Rotated right hand side of the least squares problem, then its solution
+};
+
+//-----------
+//  Results
+//-----------
+
+/// @brief Iterations taken by a Krylov solver and the relative residual norm || b - A x || / || b || reached
+/// @tparam T element type
+template < class T >
+class krylov_result
+{
+  public:
+    //- Constructors
+    constexpr krylov_result( ::std::size_t iterations, T residual ) noexcept : iterations_( iterations ), residual_( residual ) { }
+
+    //- Accessors
+    /// @brief Returns the iterations taken, each one application of the operator, two for bicgstab
+    [[nodiscard]] constexpr ::std::size_t iterations() const noexcept { return this->iterations_; }
+    /// @brief Returns the relative residual norm, as updated by the iteration
+    [[nodiscard]] constexpr T residual() const noexcept { return this->residual_; }
+
+  private:
+    //- Data
+    ::std::size_t iterations_;
+    T             residual_;
+};
+
+LINALG_END // end linalg namespace
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//------------------
+//  Krylov Kernels
+//------------------
+
+// Iterations of a Krylov solver before giving up
+inline constexpr ::std::size_t krylov_iteration_limit = 10000;
+
+/// @brief Returns the default tolerance on the relative residual norm, sqrt( eps )
+template < class T >
+[[nodiscard]] T krylov_tolerance() noexcept
+{
+  return ::std::sqrt( ::std::numeric_limits< T >::epsilon() );
+}
+
+/// @brief True if the preconditioner is the identity, which the solvers skip
+template < class Preconditioner >
+inline constexpr bool is_identity_preconditioner_v = ::std::is_same_v< ::std::decay_t< Preconditioner >, LINALG::identity_preconditioner >;
+
+/// @brief Checks the extents of the system against the operator and returns its order
+/// @throw length_error if b, x or the workspace vector w do not match the operator
+template < class Operator, class Rhs, class T >
+::std::size_t system_extent( const Operator& a, const Rhs& b, const LINALG::dyn_tensor< T, 1 >& x, const LINALG::dyn_tensor< T, 1 >& w )
+{
+  const ::std::size_t n = a.extent(0);
+  if ( ( static_cast< ::std::size_t >( b.extent(0) ) != n ) || ( static_cast< ::std::size_t >( x.extent(0) ) != n ) ||
+       ( static_cast< ::std::size_t >( w.extent(0) ) != n ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Tensor extents are incompatable." );
+  }
+  return n;
+}
+
+/// @brief Returns || b ||
+template < class T, class Rhs >
+[[nodiscard]] T rhs_norm( const Rhs& b )
+{
+  T sum = T( 0 );
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( b.extent(0) ); ++i )
+  {
+    const T b_i = static_cast< T >( LINALG_DETAIL::access( b, i ) );
+    sum += b_i * b_i;
+  }
+  return ::std::sqrt( sum );
+}
+
+/// @brief Sets x = 0, the solution for b = 0, which no tolerance relative to || b || could accept otherwise
+template < class T >
+void zero_solution( LINALG::dyn_tensor< T, 1 >& x )
+{
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( x.extent(0) ); ++i )
+  {
+    LINALG_DETAIL::access( x, i ) = T( 0 );
+  }
+}
+
+/// @brief Sets r = b - A x and returns r^T r
+template < class T, class Operator, class Rhs >
+T residual( const Operator& a, const Rhs& b, const LINALG::dyn_tensor< T, 1 >& x, LINALG::dyn_tensor< T, 1 >& r )
+{
+  a.apply( x, r );
+  T sum = T( 0 );
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( r.extent(0) ); ++i )
+  {
+    const T r_i = static_cast< T >( LINALG_DETAIL::access( b, i ) ) - LINALG_DETAIL::access( r, i );
+    LINALG_DETAIL::access( r, i ) = r_i;
+    sum += r_i * r_i;
+  }
+  return sum;
+}
+
+/// @brief Sets y -= alpha x and returns y^T y
+template < class T >
+T subtract_scaled_norm( LINALG::dyn_tensor< T, 1 >& y, T alpha, const LINALG::dyn_tensor< T, 1 >& x )
+{
+  T sum = T( 0 );
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( y.extent(0) ); ++i )
+  {
+    const T y_i = LINALG_DETAIL::access( y, i ) - alpha * LINALG_DETAIL::access( x, i );
+    LINALG_DETAIL::access( y, i ) = y_i;
+    sum += y_i * y_i;
+  }
+  return sum;
+}
+
+/// @brief Sets z = inverse( m ) r, or leaves it if m is the identity, and returns r^T z
+template < class T, class Preconditioner >
+T precondition( const Preconditioner& m, const LINALG::dyn_tensor< T, 1 >& r, LINALG::dyn_tensor< T, 1 >& z, T rr )
+{
+  if constexpr ( is_identity_preconditioner_v< Preconditioner > )
+  {
+    return rr;
+  }
+  else
+  {
+    return m.apply( r, z );
+  }
+}
+
+//----------------------
+//  Conjugate Gradient
+//----------------------
+
+/// @brief Preconditioned conjugate gradient iteration from x
+/// @throw domain_error if A is not positive definite or the iteration does not converge
+template < class T, class Operator, class Rhs, class Preconditioner >
+[[nodiscard]] LINALG::krylov_result< T > cg_solve( const Operator& a, const Rhs& b, LINALG::dyn_tensor< T, 1 >& x, LINALG::cg_workspace< T >& w,
+                                                  const Preconditioner& m, T tolerance, ::std::size_t iterations )
+{
+  constexpr bool      identity = is_identity_preconditioner_v< Preconditioner >;
+  const ::std::size_t n        = system_extent( a, b, x, w.r );
+  const T             norm     = rhs_norm< T >( b );
+  const T             limit    = tolerance * norm;
+  auto&               z        = identity ? w.r : w.z;
+  if ( norm == T( 0 ) )
+  {
+    zero_solution( x );
+    return LINALG::krylov_result< T >( 0, T( 0 ) );
+  }
+  T rr = residual( a, b, x, w.r );
+  if ( ::std::sqrt( rr ) <= limit )
+  {
+    return LINALG::krylov_result< T >( 0, ::std::sqrt( rr ) / norm );
+  }
+  T rho = precondition( m, w.r, w.z, rr );
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    LINALG_DETAIL::access( w.p, i ) = LINALG_DETAIL::access( z, i );
+  }
+  for ( ::std::size_t iteration = 1; iteration <= iterations; ++iteration )
+  {
+    a.apply( w.p, w.q );
+    const T pq = dot_product( w.p, w.q );
+    if ( !( pq > T( 0 ) ) ) LINALG_UNLIKELY
+    {
+      throw ::std::domain_error( "Matrix is not positive definite." );
+    }
+    const T alpha = rho / pq;
+    rr = subtract_scaled_norm( w.r, alpha, w.q );
+    if ( ::std::sqrt( rr ) <= limit )
+    {
+      add_scaled( x, alpha, w.p );
+      return LINALG::krylov_result< T >( iteration, ::std::sqrt( rr ) / norm );
+    }
+    const T rho_next = precondition( m, w.r, w.z, rr );
+    const T beta     = rho_next / rho;
+    rho = rho_next;
+    // x += alpha p, then p = z + beta p, in one pass
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      const T p_i = LINALG_DETAIL::access( w.p, i );
+      LINALG_DETAIL::access( x, i )  += alpha * p_i;
+      LINALG_DETAIL::access( w.p, i ) = LINALG_DETAIL::access( z, i ) + beta * p_i;
+    }
+  }
+  throw ::std::domain_error( "Iterative solve did not converge." );
+}
+
+//------------
+//  BiCGSTAB
+//------------
+
+/// @brief Right preconditioned stabilized biconjugate gradient iteration from x
+/// @throw domain_error if the iteration breaks down or does not converge
+template < class T, class Operator, class Rhs, class Preconditioner >
+[[nodiscard]] LINALG::krylov_result< T > bicgstab_solve( const Operator& a, const Rhs& b, LINALG::dyn_tensor< T, 1 >& x, LINALG::bicgstab_workspace< T >& w,
+                                                        const Preconditioner& m, T tolerance, ::std::size_t iterations )
+{
+  constexpr bool      identity = is_identity_preconditioner_v< Preconditioner >;
+  const ::std::size_t n        = system_extent( a, b, x, w.r );
+  const T             norm     = rhs_norm< T >( b );
+  const T             limit    = tolerance * norm;
+  auto&               p_hat    = identity ? w.p : w.p_hat;
+  auto&               s_hat    = identity ? w.r : w.s_hat;
+  if ( norm == T( 0 ) )
+  {
+    zero_solution( x );
+    return LINALG::krylov_result< T >( 0, T( 0 ) );
+  }
+  T rr = residual( a, b, x, w.r );
+  if ( ::std::sqrt( rr ) <= limit )
+  {
+    return LINALG::krylov_result< T >( 0, ::std::sqrt( rr ) / norm );
+  }
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    LINALG_DETAIL::access( w.shadow, i ) = LINALG_DETAIL::access( w.r, i );
+    LINALG_DETAIL::access( w.p, i )      = LINALG_DETAIL::access( w.r, i );
+  }
+  T rho = rr;
+  for ( ::std::size_t iteration = 1; iteration <= iterations; ++iteration )
+  {
+    static_cast< void >( precondition( m, w.p, w.p_hat, T( 0 ) ) );
+    a.apply( p_hat, w.v );
+    const T sv = dot_product( w.shadow, w.v );
+    if ( sv == T( 0 ) ) LINALG_UNLIKELY
+    {
+      throw ::std::domain_error( "Iterative solve broke down." );
+    }
+    const T alpha = rho / sv;
+    // s = r - alpha v, held in r
+    rr = subtract_scaled_norm( w.r, alpha, w.v );
+    if ( ::std::sqrt( rr ) <= limit )
+    {
+      add_scaled( x, alpha, p_hat );
+      return LINALG::krylov_result< T >( iteration, ::std::sqrt( rr ) / norm );
+    }
+    static_cast< void >( precondition( m, w.r, w.s_hat, T( 0 ) ) );
+    a.apply( s_hat, w.t );
+    T ts = T( 0 );
+    T tt = T( 0 );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      const T t_i = LINALG_DETAIL::access( w.t, i );
+      ts += t_i * LINALG_DETAIL::access( w.r, i );
+      tt += t_i * t_i;
+    }
+    const T omega = ( tt == T( 0 ) ) ? T( 0 ) : ts / tt;
+    // x += alpha p_hat + omega s_hat and r = s - omega t, with r^T r and shadow^T r in the same pass
+    T rho_next = T( 0 );
+    rr = T( 0 );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      LINALG_DETAIL::access( x, i ) += alpha * LINALG_DETAIL::access( p_hat, i ) + omega * LINALG_DETAIL::access( s_hat, i );
+      const T r_i = LINALG_DETAIL::access( w.r, i ) - omega * LINALG_DETAIL::access( w.t, i );
+      LINALG_DETAIL::access( w.r, i ) = r_i;
+      rr       += r_i * r_i;
+      rho_next += LINALG_DETAIL::access( w.shadow, i ) * r_i;
+    }
+    if ( ::std::sqrt( rr ) <= limit )
+    {
+      return LINALG::krylov_result< T >( iteration, ::std::sqrt( rr ) / norm );
+    }
+    if ( ( omega == T( 0 ) ) || ( rho_next == T( 0 ) ) ) LINALG_UNLIKELY
+    {
+      throw ::std::domain_error( "Iterative solve broke down." );
+    }
+    const T beta = ( rho_next / rho ) * ( alpha / omega );
+    rho = rho_next;
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      LINALG_DETAIL::access( w.p, i ) = LINALG_DETAIL::access( w.r, i ) + beta * ( LINALG_DETAIL::access( w.p, i ) - omega * LINALG_DETAIL::access( w.v, i ) );
+    }
+  }
+  throw ::std::domain_error( "Iterative solve did not converge." );
+}
+
+//---------
+//  GMRES
+//---------
+
+/// @brief Restarted, right preconditioned GMRES iteration from x
+/// @throw domain_error if the iteration breaks down or does not converge
+template < class T, class Operator, class Rhs, class Preconditioner >
+[[nodiscard]] LINALG::krylov_result< T > gmres_solve( const Operator& a, const Rhs& b, LINALG::dyn_tensor< T, 1 >& x, LINALG::gmres_workspace< T >& w,
+                                                     const Preconditioner& m, T tolerance, ::std::size_t iterations )
+{
+  constexpr bool      identity = is_identity_preconditioner_v< Preconditioner >;
+  const ::std::size_t n        = system_extent( a, b, x, w.z );
+  const ::std::size_t restart  = w.cosines.size();
+  const T             norm     = rhs_norm< T >( b );
+  const T             limit    = tolerance * norm;
+  auto&               h        = w.hessenberg;
+  ::std::size_t       iteration = 0;
+  if ( norm == T( 0 ) )
+  {
+    zero_solution( x );
+    return LINALG::krylov_result< T >( 0, T( 0 ) );
+  }
+  while ( true )
+  {
+    const T beta = ::std::sqrt( residual( a, b, x, w.basis[0] ) );
+    if ( beta <= limit )
+    {
+      return LINALG::krylov_result< T >( iteration, beta / norm );
+    }
+    if ( ( iteration >= iterations ) || ( restart == 0 ) ) LINALG_UNLIKELY
+    {
+      throw ::std::domain_error( "Iterative solve did not converge." );
+    }
+    scale_vector( w.basis[0], T( 1 ) / beta );
+    ::std::fill( w.g.begin(), w.g.end(), T( 0 ) );
+    w.g[0] = beta;
+    ::std::size_t steps = 0;
+    T             estimate = beta;
+    while ( ( steps < restart ) && ( iteration < iterations ) && ( estimate > limit ) )
+    {
+      const ::std::size_t j = steps++;
+      ++iteration;
+      static_cast< void >( precondition( m, w.basis[j], w.z, T( 0 ) ) );
+      auto& v = w.basis[ j + 1 ];
+      a.apply( identity ? w.basis[j] : w.z, v );
+      // Modified Gram-Schmidt, each subtraction fused with the next inner product
+      T h_ij = dot_product( w.basis[0], v );
+      for ( ::std::size_t i = 0; i <= j; ++i )
+      {
+        LINALG_DETAIL::access( h, i, j ) = h_ij;
+        h_ij = T( 0 );
+        for ( ::std::size_t r = 0; r < n; ++r )
+        {
+          const T v_r = LINALG_DETAIL::access( v, r ) - LINALG_DETAIL::access( h, i, j ) * LINALG_DETAIL::access( w.basis[i], r );
+          LINALG_DETAIL::access( v, r ) = v_r;
+          h_ij += ( ( i < j ) ? LINALG_DETAIL::access( w.basis[ i + 1 ], r ) : v_r ) * v_r;
+        }
+      }
+      const T v_norm = ::std::sqrt( h_ij );
+      LINALG_DETAIL::access( h, j + 1, j ) = v_norm;
+      if ( v_norm != T( 0 ) )
+      {
+        scale_vector( v, T( 1 ) / v_norm );
+      }
+      // Reduce the new column to upper triangular form by the previous rotations and a new one
+      for ( ::std::size_t i = 0; i < j; ++i )
+      {
+        const T h_i = LINALG_DETAIL::access( h, i, j );
+        const T h_k = LINALG_DETAIL::access( h, i + 1, j );
+        LINALG_DETAIL::access( h, i, j )     = w.cosines[i] * h_i + w.sines[i] * h_k;
+        LINALG_DETAIL::access( h, i + 1, j ) = w.cosines[i] * h_k - w.sines[i] * h_i;
+      }
+      const T diagonal = LINALG_DETAIL::access( h, j, j );
+      const T radius   = ::std::hypot( diagonal, v_norm );
+      w.cosines[j] = ( radius == T( 0 ) ) ? T( 1 ) : diagonal / radius;
+      w.sines[j]   = ( radius == T( 0 ) ) ? T( 0 ) : v_norm / radius;
+      LINALG_DETAIL::access( h, j, j )     = radius;
+      LINALG_DETAIL::access( h, j + 1, j ) = T( 0 );
+      w.g[ j + 1 ] = -w.sines[j] * w.g[j];
+      w.g[j]       = w.cosines[j] * w.g[j];
+      estimate     = ::std::abs( w.g[ j + 1 ] );
+      if ( v_norm == T( 0 ) )
+      {
+        // The Krylov subspace is invariant: its solution is exact
+        break;
+      }
+    }
+    // y = inverse( H ) g, then x += inverse( M ) V y
+    for ( ::std::size_t i = steps; i-- > 0; )
+    {
+      for ( ::std::size_t k = i + 1; k < steps; ++k )
+      {
+        w.g[i] -= LINALG_DETAIL::access( h, i, k ) * w.g[k];
+      }
+      // A zero diagonal is left only by a breakdown on a singular Hessenberg matrix
+      if ( LINALG_DETAIL::access( h, i, i ) == T( 0 ) ) LINALG_UNLIKELY
+      {
+        throw ::std::domain_error( "Iterative solve broke down." );
+      }
+      w.g[i] /= LINALG_DETAIL::access( h, i, i );
+    }
+    for ( ::std::size_t r = 0; r < n; ++r )
+    {
+      T sum = T( 0 );
+      for ( ::std::size_t i = 0; i < steps; ++i )
+      {
+        sum += w.g[i] * LINALG_DETAIL::access( w.basis[i], r );
+      }
+      LINALG_DETAIL::access( w.z, r ) = sum;
+    }
+    if constexpr ( identity )
+    {
+      add_scaled( x, T( 1 ), w.z );
+    }
+    else
+    {
+      static_cast< void >( m.apply( w.z, w.basis[ steps ] ) );
+      add_scaled( x, T( 1 ), w.basis[ steps ] );
+    }
+  }
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//------------------
+//  Krylov Solvers
+//------------------
+
+/// @brief Solves A x = b for a real symmetric positive definite operator or matrix by the preconditioned
+///        conjugate gradient method, starting from x
+/// @param m symmetric positive definite preconditioner, none by default
+/// @param tolerance largest residual norm relative to || b ||, sqrt( eps ) by default
+/// @throw length_error if b, x and the workspace do not match a
+/// @throw domain_error if A is not positive definite or the iteration does not converge, x holding the last iterate
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Operator, class Rhs, class Preconditioner = identity_preconditioner >
+  requires ( ( LINALG::is_linear_operator_v< Operator > || LINALG_CONCEPTS::matrix_expression< Operator > ) &&
+             LINALG_CONCEPTS::vector_expression< Rhs > && ::std::is_floating_point_v< LINALG_DETAIL::operator_value_t< Operator > > )
+#else
+template < class Operator, class Rhs, class Preconditioner = identity_preconditioner,
+           typename = ::std::enable_if_t< ( LINALG::is_linear_operator_v< Operator > || LINALG_CONCEPTS::matrix_expression_v< Operator > ) &&
+                                          LINALG_CONCEPTS::vector_expression_v< Rhs > && ::std::is_floating_point_v< LINALG_DETAIL::operator_value_t< Operator > > > >
+#endif
+krylov_result< LINALG_DETAIL::operator_value_t< Operator > >
+cg( const Operator& a, const Rhs& b, LINALG::dyn_tensor< LINALG_DETAIL::operator_value_t< Operator >, 1 >& x, cg_workspace< LINALG_DETAIL::operator_value_t< Operator > >& w,
+    const Preconditioner& m = Preconditioner(),
+    LINALG_DETAIL::operator_value_t< Operator > tolerance = LINALG_DETAIL::krylov_tolerance< LINALG_DETAIL::operator_value_t< Operator > >(),
+    ::std::size_t iterations = LINALG_DETAIL::krylov_iteration_limit )
+{
+  return LINALG_DETAIL::cg_solve( LINALG_DETAIL::as_linear_operator( a ), b, x, w, m, tolerance, iterations );
+}
+
+/// @brief Solves A x = b for a real operator or matrix by the stabilized biconjugate gradient method, right
+///        preconditioned, starting from x
+/// @param m preconditioner, none by default
+/// @param tolerance largest residual norm relative to || b ||, sqrt( eps ) by default
+/// @throw length_error if b, x and the workspace do not match a
+/// @throw domain_error if the iteration breaks down or does not converge, x holding the last iterate
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Operator, class Rhs, class Preconditioner = identity_preconditioner >
+  requires ( ( LINALG::is_linear_operator_v< Operator > || LINALG_CONCEPTS::matrix_expression< Operator > ) &&
+             LINALG_CONCEPTS::vector_expression< Rhs > && ::std::is_floating_point_v< LINALG_DETAIL::operator_value_t< Operator > > )
+#else
+template < class Operator, class Rhs, class Preconditioner = identity_preconditioner,
+           typename = ::std::enable_if_t< ( LINALG::is_linear_operator_v< Operator > || LINALG_CONCEPTS::matrix_expression_v< Operator > ) &&
+                                          LINALG_CONCEPTS::vector_expression_v< Rhs > && ::std::is_floating_point_v< LINALG_DETAIL::operator_value_t< Operator > > > >
+#endif
+krylov_result< LINALG_DETAIL::operator_value_t< Operator > >
+bicgstab( const Operator& a, const Rhs& b, LINALG::dyn_tensor< LINALG_DETAIL::operator_value_t< Operator >, 1 >& x, bicgstab_workspace< LINALG_DETAIL::operator_value_t< Operator > >& w,
+          const Preconditioner& m = Preconditioner(),
+          LINALG_DETAIL::operator_value_t< Operator > tolerance = LINALG_DETAIL::krylov_tolerance< LINALG_DETAIL::operator_value_t< Operator > >(),
+          ::std::size_t iterations = LINALG_DETAIL::krylov_iteration_limit )
+{
+  return LINALG_DETAIL::bicgstab_solve( LINALG_DETAIL::as_linear_operator( a ), b, x, w, m, tolerance, iterations );
+}
+
+/// @brief Solves A x = b for a real operator or matrix by GMRES, restarted as often as the workspace allows
+///        and right preconditioned, starting from x
+/// @param m preconditioner, none by default
+/// @param tolerance largest residual norm relative to || b ||, sqrt( eps ) by default
+/// @throw length_error if b, x and the workspace do not match a
+/// @throw domain_error if the iteration breaks down or does not converge, x holding the last iterate
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Operator, class Rhs, class Preconditioner = identity_preconditioner >
+  requires ( ( LINALG::is_linear_operator_v< Operator > || LINALG_CONCEPTS::matrix_expression< Operator > ) &&
+             LINALG_CONCEPTS::vector_expression< Rhs > && ::std::is_floating_point_v< LINALG_DETAIL::operator_value_t< Operator > > )
+#else
+template < class Operator, class Rhs, class Preconditioner = identity_preconditioner,
+           typename = ::std::enable_if_t< ( LINALG::is_linear_operator_v< Operator > || LINALG_CONCEPTS::matrix_expression_v< Operator > ) &&
+                                          LINALG_CONCEPTS::vector_expression_v< Rhs > && ::std::is_floating_point_v< LINALG_DETAIL::operator_value_t< Operator > > > >
+#endif
+krylov_result< LINALG_DETAIL::operator_value_t< Operator > >
+gmres( const Operator& a, const Rhs& b, LINALG::dyn_tensor< LINALG_DETAIL::operator_value_t< Operator >, 1 >& x, gmres_workspace< LINALG_DETAIL::operator_value_t< Operator > >& w,
+       const Preconditioner& m = Preconditioner(),
+       LINALG_DETAIL::operator_value_t< Operator > tolerance = LINALG_DETAIL::krylov_tolerance< LINALG_DETAIL::operator_value_t< Operator > >(),
+       ::std::size_t iterations = LINALG_DETAIL::krylov_iteration_limit )
+{
+  return LINALG_DETAIL::gmres_solve( LINALG_DETAIL::as_linear_operator( a ), b, x, w, m, tolerance, iterations );
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_KRYLOV_HPP
@@ -0,0 +1,232 @@
+//==================================================================================================
+//  File:       linear_operator.hpp
+//
+//  Summary:    This header defines matrix-free linear operators and the vector kernels the iterative
+//              solvers built on them use:
+//              LINALG::linear_operator< T, Apply >
+//              LINALG::is_linear_operator< Operator >
+//              LINALG::make_linear_operator< T >( n, Apply&& apply )
+//              LINALG::make_linear_operator( const Matrix& a )
+//              LINALG::adjoint_linear_operator< T, Apply, ApplyAdjoint >
+//              LINALG::is_adjoint_linear_operator< Operator >
+//              LINALG::make_adjoint_linear_operator< T >( rows, columns, Apply&& apply, ApplyAdjoint&& apply_adjoint )
+//              LINALG_DETAIL::as_linear_operator( const Operator& a )
+//              LINALG_DETAIL::dot_product( x, y )
+//              LINALG_DETAIL::add_scaled( y, alpha, x )
+//              LINALG_DETAIL::scale_vector( x, alpha )
+//              LINALG_DETAIL::gaussian_vector( x, engine )
+//
+//              A linear operator is an n x n matrix known only through y = A x, applied to dyn_tensor
+//              vectors the caller owns: any callable with that effect, or any object a with which
+//              y = a * x is a valid assignment, dense and lazy matrices as well as inverse( a ). The
+//              solvers allocate every vector they need before iterating, so apply is the only call in
+//              an iteration which may allocate, and only if the callable itself does. An adjoint linear
+//              operator is a rows x columns matrix known only through Y = A X and X = A^H Y for blocks
+//              of vectors, as the randomized range finder samples it.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_LINEAR_OPERATOR_HPP
+#define LINEAR_ALGEBRA_LINEAR_OPERATOR_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_BEGIN // linalg namespace
+
+//-------------------
+//  Linear Operator
+//-------------------
+
+/// @brief Square matrix known only through its product with a vector
+/// @tparam T element type of the vectors it is applied to
+/// @tparam Apply callable with apply( x, y ) setting y = A x for vectors of dyn_tensor< T, 1 >
+template < class T, class Apply >
+class linear_operator
+{
+  public:
+    //- Aliases
+    using value_type  = T;
+    using vector_type = LINALG::dyn_tensor< T, 1 >;
+
+    //- Constructors
+    /// @brief Constructs the n x n operator applied by apply
+    constexpr linear_operator( ::std::size_t n, Apply apply ) : n_( n ), apply_( ::std::move( apply ) ) { }
+
+    //- Extents
+    [[nodiscard]] constexpr ::std::size_t extent( [[maybe_unused]] ::std::size_t n ) const noexcept { return this->n_; }
+
+    //- Application
+    /// @brief Sets y = A x; x and y hold extent( 0 ) elements and must not overlap
+    constexpr void apply( const vector_type& x, vector_type& y ) const { this->apply_( x, y ); }
+
+  private:
+    //- Data
+    ::std::size_t n_;
+    Apply         apply_;
+};
+
+/// @brief True for specializations of linear_operator
+template < class Operator >
+class is_linear_operator : public ::std::false_type { };
+
+template < class T, class Apply >
+class is_linear_operator< linear_operator< T, Apply > > : public ::std::true_type { };
+
+template < class Operator >
+inline constexpr bool is_linear_operator_v = is_linear_operator< ::std::decay_t< Operator > >::value;
+
+/// @brief Returns the n x n operator with y = A x set by apply( x, y ) for vectors of dyn_tensor< T, 1 >
+template < class T, class Apply >
+[[nodiscard]] constexpr linear_operator< T, ::std::decay_t< Apply > > make_linear_operator( ::std::size_t n, Apply&& apply )
+{
+  return linear_operator< T, ::std::decay_t< Apply > >( n, ::std::forward< Apply >( apply ) );
+}
+
+/// @brief Returns the operator applying the square matrix a as y = a * x, which a must outlive
+/// @throw length_error if a is not square
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires LINALG_CONCEPTS::matrix_expression< Matrix >
+#else
+template < class Matrix, typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< Matrix > > >
+#endif
+[[nodiscard]] auto make_linear_operator( const Matrix& a )
+{
+  using value_type  = ::std::remove_cv_t< typename Matrix::value_type >;
+  using vector_type = LINALG::dyn_tensor< value_type, 1 >;
+  if ( static_cast< ::std::size_t >( a.extent(0) ) != static_cast< ::std::size_t >( a.extent(1) ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Matrix extents are incompatable." );
+  }
+  return make_linear_operator< value_type >( static_cast< ::std::size_t >( a.extent(0) ), [&a]( const vector_type& x, vector_type& y ) { y = a * x; } );
+}
+
+//---------------------------
+//  Adjoint Linear Operator
+//---------------------------
+
+/// @brief Rectangular matrix known only through its products, and those of its adjoint, with blocks of vectors
+/// @tparam T element type of the blocks it is applied to
+/// @tparam Apply callable with apply( x, y ) setting y = A x for blocks of dyn_tensor< T, 2 >
+/// @tparam ApplyAdjoint callable with apply_adjoint( y, x ) setting x = A^H y
+template < class T, class Apply, class ApplyAdjoint >
+class adjoint_linear_operator
+{
+  public:
+    //- Aliases
+    using value_type = T;
+    using block_type = LINALG::dyn_tensor< T, 2 >;
+
+    //- Constructors
+    /// @brief Constructs the rows x columns operator applied by apply and apply_adjoint
+    constexpr adjoint_linear_operator( ::std::size_t rows, ::std::size_t columns, Apply apply, ApplyAdjoint apply_adjoint ) :
+      rows_( rows ), columns_( columns ), apply_( ::std::move( apply ) ), apply_adjoint_( ::std::move( apply_adjoint ) ) { }
+
+    //- Extents
+    [[nodiscard]] constexpr ::std::size_t extent( ::std::size_t n ) const noexcept { return ( n == 0 ) ? this->rows_ : this->columns_; }
+
+    //- Application
+    /// @brief Sets y = A x; x is extent( 1 ) x k, y is extent( 0 ) x k and they must not overlap
+    constexpr void apply( const block_type& x, block_type& y ) const { this->apply_( x, y ); }
+    /// @brief Sets x = A^H y; y is extent( 0 ) x k, x is extent( 1 ) x k and they must not overlap
+    constexpr void apply_adjoint( const block_type& y, block_type& x ) const { this->apply_adjoint_( y, x ); }
+
+  private:
+    //- Data
+    ::std::size_t rows_;
+    ::std::size_t columns_;
+    Apply         apply_;
+    ApplyAdjoint  apply_adjoint_;
+};
+
+/// @brief True for specializations of adjoint_linear_operator
+template < class Operator >
+class is_adjoint_linear_operator : public ::std::false_type { };
+
+template < class T, class Apply, class ApplyAdjoint >
+class is_adjoint_linear_operator< adjoint_linear_operator< T, Apply, ApplyAdjoint > > : public ::std::true_type { };
+
+template < class Operator >
+inline constexpr bool is_adjoint_linear_operator_v = is_adjoint_linear_operator< ::std::decay_t< Operator > >::value;
+
+/// @brief Returns the rows x columns operator with y = A x set by apply( x, y ) and x = A^H y set by
+///        apply_adjoint( y, x ) for blocks of dyn_tensor< T, 2 >
+template < class T, class Apply, class ApplyAdjoint >
+[[nodiscard]] constexpr adjoint_linear_operator< T, ::std::decay_t< Apply >, ::std::decay_t< ApplyAdjoint > >
+make_adjoint_linear_operator( ::std::size_t rows, ::std::size_t columns, Apply&& apply, ApplyAdjoint&& apply_adjoint )
+{
+  return adjoint_linear_operator< T, ::std::decay_t< Apply >, ::std::decay_t< ApplyAdjoint > >( rows, columns, ::std::forward< Apply >( apply ),
+                                                                                                 ::std::forward< ApplyAdjoint >( apply_adjoint ) );
+}
+
+LINALG_END // end linalg namespace
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+/// @brief Returns a linear operator unchanged, or the operator applying a matrix
+template < class Operator >
+[[nodiscard]] decltype(auto) as_linear_operator( const Operator& a )
+{
+  if constexpr ( LINALG::is_linear_operator_v< Operator > )
+  {
+    return ( a );
+  }
+  else
+  {
+    return LINALG::make_linear_operator( a );
+  }
+}
+
+/// @brief Element type of an operator or matrix
+template < class Operator >
+using operator_value_t = ::std::remove_cv_t< typename ::std::decay_t< Operator >::value_type >;
+
+//------------------
+//  Vector Kernels
+//------------------
+
+/// @brief Returns conj( x )^T y
+template < class T >
+[[nodiscard]] T dot_product( const LINALG::dyn_tensor< T, 1 >& x, const LINALG::dyn_tensor< T, 1 >& y )
+{
+  T sum = T( 0 );
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( x.extent(0) ); ++i )
+  {
+    sum += LINALG_EXPRESSIONS_DETAIL::conjugate_value( LINALG_DETAIL::access( x, i ) ) * LINALG_DETAIL::access( y, i );
+  }
+  return sum;
+}
+
+/// @brief y += alpha * x
+template < class T >
+void add_scaled( LINALG::dyn_tensor< T, 1 >& y, T alpha, const LINALG::dyn_tensor< T, 1 >& x )
+{
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( y.extent(0) ); ++i )
+  {
+    LINALG_DETAIL::access( y, i ) += alpha * LINALG_DETAIL::access( x, i );
+  }
+}
+
+/// @brief x *= alpha
+template < class T >
+void scale_vector( LINALG::dyn_tensor< T, 1 >& x, T alpha )
+{
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( x.extent(0) ); ++i )
+  {
+    LINALG_DETAIL::access( x, i ) *= alpha;
+  }
+}
+
+/// @brief Fills x with standard normal samples drawn from engine
+template < class T, class Engine >
+void gaussian_vector( LINALG::dyn_tensor< T, 1 >& x, Engine& engine )
+{
+  ::std::normal_distribution< T > normal;
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( x.extent(0) ); ++i )
+  {
+    LINALG_DETAIL::access( x, i ) = normal( engine );
+  }
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+#endif  //- LINEAR_ALGEBRA_LINEAR_OPERATOR_HPP
@@ -0,0 +1,385 @@
+//==================================================================================================
+//  File:       low_precision.hpp
+//
+//  Summary:    This header defines narrow floating point storage types:
+//              LINALG::bfloat16_t
+//              LINALG::float16_t
+//              LINALG::is_low_precision< T >
+//              LINALG::accumulation_type< LINALG::bfloat16_t >
+//              LINALG::accumulation_type< LINALG::float16_t >
+//              LINALG::convert( const From& from, To& to )
+//
+//              The storage types hold 16 bits and compute in float: every arithmetic operation
+//              converts to float, so expression value types built from them are float. They may be
+//              used as the element type of dr_tensor and fs_tensor with the default accessor.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_LOW_PRECISION_HPP
+#define LINEAR_ALGEBRA_LOW_PRECISION_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//==================================================================================================
+//  Bit Cast reinterprets the object representation, in constant expressions where supported
+//==================================================================================================
+template < class To, class From >
+[[nodiscard]] LINALG_CONSTEXPR_BIT_CAST To bit_cast( const From& from ) noexcept
+{
+  static_assert( sizeof( To ) == sizeof( From ) );
+  #ifdef __cpp_lib_bit_cast
+  return ::std::bit_cast< To >( from );
+  #else
+  To to;
+  ::std::memcpy( ::std::addressof( to ), ::std::addressof( from ), sizeof( To ) );
+  return to;
+  #endif
+}
+
+//==================================================================================================
+//  Float / bfloat16 bit conversions
+//==================================================================================================
+
+// Round to nearest even, quieting NaNs
+[[nodiscard]] LINALG_CONSTEXPR_BIT_CAST ::std::uint16_t float_to_bfloat16_bits( float value ) noexcept
+{
+  const ::std::uint32_t bits = LINALG_DETAIL::bit_cast< ::std::uint32_t >( value );
+  if ( ( bits & 0x7FFFFFFFu ) > 0x7F800000u ) LINALG_UNLIKELY
+  {
+    return static_cast< ::std::uint16_t >( ( bits >> 16 ) | 0x0040u );
+  }
+  return static_cast< ::std::uint16_t >( ( bits + 0x7FFFu + ( ( bits >> 16 ) & 1u ) ) >> 16 );
+}
+
+[[nodiscard]] LINALG_CONSTEXPR_BIT_CAST float bfloat16_bits_to_float( ::std::uint16_t bits ) noexcept
+{
+  return LINALG_DETAIL::bit_cast< float >( static_cast< ::std::uint32_t >( bits ) << 16 );
+}
+
+//==================================================================================================
+//  Float / IEEE binary16 bit conversions
+//==================================================================================================
+
+// Round to nearest even, saturating to infinity and quieting NaNs
+[[nodiscard]] LINALG_CONSTEXPR_BIT_CAST ::std::uint16_t float_to_float16_bits( float value ) noexcept
+{
+  ::std::uint32_t       bits = LINALG_DETAIL::bit_cast< ::std::uint32_t >( value );
+  const ::std::uint32_t sign = ( bits >> 16 ) & 0x8000u;
+  bits &= 0x7FFFFFFFu;
+  // Infinity or NaN
+  if ( bits >= 0x7F800000u ) LINALG_UNLIKELY
+  {
+    return static_cast< ::std::uint16_t >( sign | 0x7C00u | ( ( bits > 0x7F800000u ) ? 0x0200u : 0u ) );
+  }
+  // Rounds to infinity
+  if ( bits >= 0x477FF000u ) LINALG_UNLIKELY
+  {
+    return static_cast< ::std::uint16_t >( sign | 0x7C00u );
+  }
+  // Subnormal or zero, adding one half aligns the mantissa so the float addition performs the rounding
+  if ( bits < 0x38800000u )
+  {
+    return static_cast< ::std::uint16_t >( sign | ( LINALG_DETAIL::bit_cast< ::std::uint32_t >( LINALG_DETAIL::bit_cast< float >( bits ) + 0.5f ) - 0x3F000000u ) );
+  }
+  // Normal, rebias the exponent and round the discarded mantissa bits
+  bits += 0xC8000FFFu + ( ( bits >> 13 ) & 1u );
+  return static_cast< ::std::uint16_t >( sign | ( bits >> 13 ) );
+}
+
+[[nodiscard]] LINALG_CONSTEXPR_BIT_CAST float float16_bits_to_float( ::std::uint16_t bits ) noexcept
+{
+  const ::std::uint32_t sign     = static_cast< ::std::uint32_t >( bits & 0x8000u ) << 16;
+  ::std::uint32_t       exponent = ( bits >> 10 ) & 0x1Fu;
+  ::std::uint32_t       mantissa = bits & 0x03FFu;
+  if ( exponent == 0 )
+  {
+    if ( mantissa == 0 )
+    {
+      return LINALG_DETAIL::bit_cast< float >( sign );
+    }
+    // Normalize the subnormal
+    exponent = 113;
+    while ( !( mantissa & 0x0400u ) )
+    {
+      mantissa <<= 1;
+      --exponent;
+    }
+    return LINALG_DETAIL::bit_cast< float >( sign | ( exponent << 23 ) | ( ( mantissa & 0x03FFu ) << 13 ) );
+  }
+  if ( exponent == 0x1Fu ) LINALG_UNLIKELY
+  {
+    return LINALG_DETAIL::bit_cast< float >( sign | 0x7F800000u | ( mantissa << 13 ) );
+  }
+  return LINALG_DETAIL::bit_cast< float >( sign | ( ( exponent + 112 ) << 23 ) | ( mantissa << 13 ) );
+}
+
+LINALG_DETAIL_END
+
+LINALG_BEGIN // linalg namespace
+
+//==================================================================================================
+//  bfloat16_t
+//==================================================================================================
+
+/// @brief 16 bit storage with the exponent range of float and an 8 bit significand
+class bfloat16_t
+{
+  public:
+    /// @brief Default constructor leaves the value uninitialized
+    constexpr bfloat16_t() noexcept = default;
+    /// @brief Converts any value convertible to float, rounding to nearest even
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class U >
+      requires ( ::std::is_convertible_v< U, float > && !::std::is_same_v< ::std::remove_cvref_t< U >, bfloat16_t > )
+    #else
+    template < class U,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< U, float > && !::std::is_same_v< ::std::decay_t< U >, bfloat16_t > > >
+    #endif
+    explicit constexpr bfloat16_t( const U& value ) noexcept :
+      bits_( LINALG_DETAIL::float_to_bfloat16_bits( static_cast< float >( value ) ) ) { }
+    /// @brief Assigns any value convertible to float, rounding to nearest even
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class U >
+      requires ( ::std::is_convertible_v< U, float > && !::std::is_same_v< ::std::remove_cvref_t< U >, bfloat16_t > )
+    #else
+    template < class U,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< U, float > && !::std::is_same_v< ::std::decay_t< U >, bfloat16_t > > >
+    #endif
+    constexpr bfloat16_t& operator = ( const U& value ) noexcept
+    {
+      this->bits_ = LINALG_DETAIL::float_to_bfloat16_bits( static_cast< float >( value ) );
+      return *this;
+    }
+    /// @brief Widens to float, which is exact
+    [[nodiscard]] LINALG_CONSTEXPR_BIT_CAST operator float() const noexcept { return LINALG_DETAIL::bfloat16_bits_to_float( this->bits_ ); }
+    //- Compound assignment computes in float and rounds once
+    template < class U > constexpr bfloat16_t& operator += ( const U& value ) noexcept { return *this = static_cast< float >( *this ) + value; }
+    template < class U > constexpr bfloat16_t& operator -= ( const U& value ) noexcept { return *this = static_cast< float >( *this ) - value; }
+    template < class U > constexpr bfloat16_t& operator *= ( const U& value ) noexcept { return *this = static_cast< float >( *this ) * value; }
+    template < class U > constexpr bfloat16_t& operator /= ( const U& value ) noexcept { return *this = static_cast< float >( *this ) / value; }
+    /// @brief Returns the stored bit pattern
+    [[nodiscard]] constexpr ::std::uint16_t bits() const noexcept { return this->bits_; }
+    /// @brief Constructs from a stored bit pattern
+    [[nodiscard]] static constexpr bfloat16_t from_bits( ::std::uint16_t bits ) noexcept
+    {
+      bfloat16_t result;
+      result.bits_ = bits;
+      return result;
+    }
+  private:
+    ::std::uint16_t bits_;
+};
+
+//==================================================================================================
+//  float16_t
+//==================================================================================================
+
+/// @brief 16 bit IEEE binary16 storage
+class float16_t
+{
+  public:
+    /// @brief Default constructor leaves the value uninitialized
+    constexpr float16_t() noexcept = default;
+    /// @brief Converts any value convertible to float, rounding to nearest even
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class U >
+      requires ( ::std::is_convertible_v< U, float > && !::std::is_same_v< ::std::remove_cvref_t< U >, float16_t > )
+    #else
+    template < class U,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< U, float > && !::std::is_same_v< ::std::decay_t< U >, float16_t > > >
+    #endif
+    explicit constexpr float16_t( const U& value ) noexcept :
+      bits_( LINALG_DETAIL::float_to_float16_bits( static_cast< float >( value ) ) ) { }
+    /// @brief Assigns any value convertible to float, rounding to nearest even
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class U >
+      requires ( ::std::is_convertible_v< U, float > && !::std::is_same_v< ::std::remove_cvref_t< U >, float16_t > )
+    #else
+    template < class U,
+               typename = ::std::enable_if_t< ::std::is_convertible_v< U, float > && !::std::is_same_v< ::std::decay_t< U >, float16_t > > >
+    #endif
+    constexpr float16_t& operator = ( const U& value ) noexcept
+    {
+      this->bits_ = LINALG_DETAIL::float_to_float16_bits( static_cast< float >( value ) );
+      return *this;
+    }
+    /// @brief Widens to float, which is exact
+    [[nodiscard]] LINALG_CONSTEXPR_BIT_CAST operator float() const noexcept { return LINALG_DETAIL::float16_bits_to_float( this->bits_ ); }
+    //- Compound assignment computes in float and rounds once
+    template < class U > constexpr float16_t& operator += ( const U& value ) noexcept { return *this = static_cast< float >( *this ) + value; }
+    template < class U > constexpr float16_t& operator -= ( const U& value ) noexcept { return *this = static_cast< float >( *this ) - value; }
+    template < class U > constexpr float16_t& operator *= ( const U& value ) noexcept { return *this = static_cast< float >( *this ) * value; }
+    template < class U > constexpr float16_t& operator /= ( const U& value ) noexcept { return *this = static_cast< float >( *this ) / value; }
+    /// @brief Returns the stored bit pattern
+    [[nodiscard]] constexpr ::std::uint16_t bits() const noexcept { return this->bits_; }
+    /// @brief Constructs from a stored bit pattern
+    [[nodiscard]] static constexpr float16_t from_bits( ::std::uint16_t bits ) noexcept
+    {
+      float16_t result;
+      result.bits_ = bits;
+      return result;
+    }
+  private:
+    ::std::uint16_t bits_;
+};
+
+//==================================================================================================
+//  Is Low Precision returns true for the narrow storage types
+//==================================================================================================
+
+template < class T >
+struct is_low_precision : public ::std::false_type { };
+
+template < >
+struct is_low_precision< bfloat16_t > : public ::std::true_type { };
+
+template < >
+struct is_low_precision< float16_t > : public ::std::true_type { };
+
+template < class T >
+inline constexpr bool is_low_precision_v = is_low_precision< T >::value;
+
+//==================================================================================================
+//  Accumulation Type
+//==================================================================================================
+
+template < >
+struct accumulation_type< bfloat16_t >
+{
+  using type = float;
+};
+
+template < >
+struct accumulation_type< float16_t >
+{
+  using type = float;
+};
+
+LINALG_END // linalg namespace
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//==================================================================================================
+//  Bulk conversion kernels
+//==================================================================================================
+
+// Portable kernel, the loop body is branch free for the common cases so unsequenced execution vectorizes
+template < class From, class To >
+inline void convert_n( const From* from, ::std::size_t n, To* to )
+{
+  LINALG_DETAIL::for_each( LINALG_EXECUTION_UNSEQ,
+                           faux_index_iterator< ::std::size_t >( 0 ),
+                           faux_index_iterator< ::std::size_t >( n ),
+                           [from,to]( ::std::size_t index ) noexcept { to[index] = static_cast< To >( from[index] ); } );
+}
+
+#if defined( __F16C__ ) && defined( __AVX__ )
+
+inline void convert_n( const float* from, ::std::size_t n, LINALG::float16_t* to )
+{
+  ::std::size_t index = 0;
+  for ( ; index + 8 <= n; index += 8 )
+  {
+    const __m128i half = _mm256_cvtps_ph( _mm256_loadu_ps( from + index ), _MM_FROUND_TO_NEAREST_INT );
+    ::std::memcpy( to + index, &half, sizeof( half ) );
+  }
+  for ( ; index < n; ++index )
+  {
+    to[index] = from[index];
+  }
+}
+
+inline void convert_n( const LINALG::float16_t* from, ::std::size_t n, float* to )
+{
+  ::std::size_t index = 0;
+  for ( ; index + 8 <= n; index += 8 )
+  {
+    __m128i half;
+    ::std::memcpy( &half, from + index, sizeof( half ) );
+    _mm256_storeu_ps( to + index, _mm256_cvtph_ps( half ) );
+  }
+  for ( ; index < n; ++index )
+  {
+    to[index] = static_cast< float >( from[index] );
+  }
+}
+
+#endif
+
+#if defined( __AVX512BF16__ ) && defined( __AVX512F__ )
+
+// Note, the instruction treats subnormal inputs as zero
+inline void convert_n( const float* from, ::std::size_t n, LINALG::bfloat16_t* to )
+{
+  ::std::size_t index = 0;
+  for ( ; index + 16 <= n; index += 16 )
+  {
+    const __m256bh narrow = _mm512_cvtneps_pbh( _mm512_loadu_ps( from + index ) );
+    ::std::memcpy( to + index, &narrow, sizeof( narrow ) );
+  }
+  for ( ; index < n; ++index )
+  {
+    to[index] = from[index];
+  }
+}
+
+#endif
+
+LINALG_DETAIL_END
+
+LINALG_BEGIN // linalg namespace
+
+//==================================================================================================
+//  Convert
+//==================================================================================================
+
+/// @brief Converts each element of a tensor into another of equal extents with a different value type
+/// @tparam From tensor expression
+/// @tparam To writable tensor
+/// @param from tensor to be converted
+/// @param to tensor to be overwritten
+/// Exhaustive tensors with identical layouts and the default accessor are converted as one contiguous
+/// range using hardware conversion instructions when the target supports them.
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class From, class To >
+  requires ( LINALG_CONCEPTS::tensor_expression< From > &&
+             LINALG_CONCEPTS::writable_tensor< To > &&
+             ( From::rank() == To::rank() ) )
+#else
+template < class From, class To,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< From > &&
+                                          LINALG_CONCEPTS::writable_tensor_v< To > &&
+                                          ( From::rank() == To::rank() ) > >
+#endif
+void convert( const From& from, To& to )
+{
+  for ( typename To::rank_type dim = 0; dim < To::rank(); ++dim )
+  {
+    if ( static_cast< typename To::index_type >( from.extent( dim ) ) != to.extent( dim ) ) LINALG_UNLIKELY
+    {
+      throw ::std::length_error( "Tensor extents are incompatable." );
+    }
+  }
+  if constexpr ( LINALG_DETAIL::has_data_handle_v< const From > && LINALG_DETAIL::has_data_handle_v< To > )
+  {
+    if constexpr ( ::std::is_same_v< typename From::layout_type, typename To::layout_type > &&
+                   LINALG_DETAIL::is_default_accessor_v< typename From::accessor_type > &&
+                   LINALG_DETAIL::is_default_accessor_v< typename To::accessor_type > )
+    {
+      if ( from.is_exhaustive() && to.is_exhaustive() ) LINALG_LIKELY
+      {
+        LINALG_DETAIL::convert_n( from.data_handle(), to.size(), to.data_handle() );
+        return;
+      }
+    }
+  }
+  LINALG_DETAIL::apply_all( to,
+                            [&from,&to]( auto ... indices ) constexpr noexcept
+                              { LINALG_DETAIL::access( to, indices ... ) = static_cast< typename To::value_type >( LINALG_DETAIL::access( from, indices ... ) ); },
+                            LINALG_EXECUTION_UNSEQ );
+}
+
+LINALG_END // linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_LOW_PRECISION_HPP
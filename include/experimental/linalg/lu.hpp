@@ -0,0 +1,343 @@
+//==================================================================================================
+//  File:       lu.hpp
+//
+//  Summary:    This header defines the LU factorization with partial pivoting:
+//              lu_factorization< Matrix >
+//              lu_factor( Matrix&& a )
+//
+//              The factorization overwrites the matrix with the unit lower triangle L and the upper
+//              triangle U of P A = L U. Panels of lu_block_extent columns are factored unblocked, then
+//              the trailing matrix is updated with a single product of the panel and the block row of
+//              U, which runs in parallel for large matrices. Small fixed size matrices are factored by
+//              fully unrolled loops instead.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_LU_HPP
+#define LINEAR_ALGEBRA_LU_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//-------------------------
+//  Blocked Factorization
+//-------------------------
+
+// Columns of the panel factored before the trailing matrix is updated
+inline constexpr ::std::size_t lu_block_extent = 64;
+
+// Pivot storage: an array when both extents are static, a vector otherwise
+template < class Extents, bool = ( Extents::static_extent(0) != ::std::dynamic_extent ) && ( Extents::static_extent(1) != ::std::dynamic_extent ) >
+struct lu_pivots
+{
+  using type = ::std::vector< ::std::size_t >;
+};
+
+template < class Extents >
+struct lu_pivots< Extents, true >
+{
+  using type = ::std::array< ::std::size_t, ::std::min( Extents::static_extent(0), Extents::static_extent(1) ) >;
+};
+
+template < class Extents >
+using lu_pivots_t = typename lu_pivots< Extents >::type;
+
+/// @brief Factors columns [first, first + width) of a unblocked, interchanging whole rows
+/// @return false if a zero pivot was found
+template < class Matrix, class Pivots >
+[[nodiscard]] bool lu_panel( Matrix& a, Pivots& pivots, ::std::size_t first, ::std::size_t width )
+{
+  const ::std::size_t rows    = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( a.extent(1) );
+  bool nonsingular = true;
+  for ( ::std::size_t j = first; j < first + width; ++j )
+  {
+    ::std::size_t pivot = j;
+    auto          max   = ::std::abs( LINALG_DETAIL::access( a, j, j ) );
+    for ( ::std::size_t i = j + 1; i < rows; ++i )
+    {
+      auto mag = ::std::abs( LINALG_DETAIL::access( a, i, j ) );
+      if ( mag > max )
+      {
+        max   = mag;
+        pivot = i;
+      }
+    }
+    pivots[j] = pivot;
+    if ( max == decltype( max )( 0 ) ) LINALG_UNLIKELY
+    {
+      // Column is already eliminated; U is singular but the factorization continues
+      nonsingular = false;
+      continue;
+    }
+    if ( pivot != j )
+    {
+      for ( ::std::size_t c = 0; c < columns; ++c )
+      {
+        ::std::swap( LINALG_DETAIL::access( a, j, c ), LINALG_DETAIL::access( a, pivot, c ) );
+      }
+    }
+    const auto a_jj = LINALG_DETAIL::access( a, j, j );
+    for ( ::std::size_t i = j + 1; i < rows; ++i )
+    {
+      const auto l_ij = ( LINALG_DETAIL::access( a, i, j ) /= a_jj );
+      for ( ::std::size_t c = j + 1; c < first + width; ++c )
+      {
+        LINALG_DETAIL::access( a, i, c ) -= l_ij * LINALG_DETAIL::access( a, j, c );
+      }
+    }
+  }
+  return nonsingular;
+}
+
+/// @brief Right looking blocked factorization of a in place
+/// @return false if the matrix is singular
+template < class Matrix, class Pivots >
+[[nodiscard]] bool blocked_lu( Matrix& a, Pivots& pivots )
+{
+  using value_type = typename Matrix::value_type;
+  const ::std::size_t rows    = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( a.extent(1) );
+  const ::std::size_t steps   = ::std::min( rows, columns );
+  const auto          block   = LINALG_DETAIL::make_block( a );
+  bool nonsingular = true;
+  for ( ::std::size_t j = 0; j < steps; j += lu_block_extent )
+  {
+    const ::std::size_t width = ::std::min( lu_block_extent, steps - j );
+    nonsingular = lu_panel( a, pivots, j, width ) && nonsingular;
+    const ::std::size_t trailing_rows    = rows - j - width;
+    const ::std::size_t trailing_columns = columns - j - width;
+    if ( trailing_columns > 0 )
+    {
+      // Block row of U, then the trailing matrix less the product of the panel and that block row
+      LINALG_DETAIL::unit_lower_solve( block.block( j, j, width, width ), block.block( j, j + width, width, trailing_columns ) );
+      LINALG_DETAIL::block_product_update( block.block( j + width, j + width, trailing_rows, trailing_columns ),
+                                           block.block( j + width, j, trailing_rows, width ),
+                                           block.block( j, j + width, width, trailing_columns ),
+                                           value_type( -1 ) );
+    }
+  }
+  return nonsingular;
+}
+
+/// @brief Unblocked factorization of a small fixed size matrix with every loop bound known at compile time
+/// @return false if the matrix is singular
+template < class Matrix, class Pivots >
+[[nodiscard]] constexpr bool unrolled_lu( Matrix& a, Pivots& pivots )
+{
+  using extents_type = typename Matrix::extents_type;
+  constexpr ::std::size_t rows    = extents_type::static_extent(0);
+  constexpr ::std::size_t columns = extents_type::static_extent(1);
+  constexpr ::std::size_t steps   = ::std::min( rows, columns );
+  bool nonsingular = true;
+  LINALG_DETAIL::constexpr_for< ::std::size_t( 0 ), steps, ::std::size_t( 1 ) >( [&]( auto j ) constexpr
+  {
+    constexpr ::std::size_t next = decltype( j )::value + 1;
+    ::std::size_t pivot = j;
+    auto          max   = ::std::abs( LINALG_DETAIL::access( a, j, j ) );
+    LINALG_DETAIL::constexpr_for< next, rows, ::std::size_t( 1 ) >( [&]( auto i ) constexpr
+    {
+      auto mag = ::std::abs( LINALG_DETAIL::access( a, i, j ) );
+      if ( mag > max )
+      {
+        max   = mag;
+        pivot = i;
+      }
+    } );
+    pivots[j] = pivot;
+    if ( max == decltype( max )( 0 ) )
+    {
+      nonsingular = false;
+      return;
+    }
+    if ( pivot != j )
+    {
+      LINALG_DETAIL::constexpr_for< ::std::size_t( 0 ), columns, ::std::size_t( 1 ) >( [&]( auto c ) constexpr
+      {
+        ::std::swap( LINALG_DETAIL::access( a, j, c ), LINALG_DETAIL::access( a, pivot, c ) );
+      } );
+    }
+    const auto a_jj = LINALG_DETAIL::access( a, j, j );
+    LINALG_DETAIL::constexpr_for< next, rows, ::std::size_t( 1 ) >( [&]( auto i ) constexpr
+    {
+      const auto l_ij = ( LINALG_DETAIL::access( a, i, j ) /= a_jj );
+      LINALG_DETAIL::constexpr_for< next, columns, ::std::size_t( 1 ) >( [&]( auto c ) constexpr
+      {
+        LINALG_DETAIL::access( a, i, c ) -= l_ij * LINALG_DETAIL::access( a, j, c );
+      } );
+    } );
+  } );
+  return nonsingular;
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//--------------------
+//  LU Factorization
+//--------------------
+
+/// @brief LU factorization P A = L U with partial pivoting, stored over the factored matrix
+/// @tparam Matrix factored matrix type; an lvalue reference when an lvalue was factored in place
+template < class Matrix >
+class lu_factorization
+{
+  public:
+    //- Aliases
+    using matrix_type  = ::std::decay_t< Matrix >;
+    using value_type   = ::std::remove_cv_t< typename matrix_type::value_type >;
+    using extents_type = typename matrix_type::extents_type;
+    using pivots_type  = LINALG_DETAIL::lu_pivots_t< extents_type >;
+
+    //- Constructors
+    /// @brief Factors the matrix in place
+    explicit lu_factorization( Matrix&& a ) :
+      factors_( ::std::forward< Matrix >( a ) ), pivots_(), nonsingular_( true )
+    {
+      if constexpr ( extents_type::static_extent(0) != ::std::dynamic_extent && extents_type::static_extent(1) != ::std::dynamic_extent )
+      {
+        if constexpr ( LINALG_DETAIL::is_unrollable_extents_v< extents_type > )
+        {
+          this->nonsingular_ = LINALG_DETAIL::unrolled_lu( this->factors_, this->pivots_ );
+          return;
+        }
+      }
+      else
+      {
+        this->pivots_.resize( ::std::min( static_cast< ::std::size_t >( this->factors_.extent(0) ),
+                                          static_cast< ::std::size_t >( this->factors_.extent(1) ) ) );
+      }
+      this->nonsingular_ = LINALG_DETAIL::blocked_lu( this->factors_, this->pivots_ );
+    }
+
+    //- Factors
+    /// @brief Returns the factored matrix, holding U on and above the diagonal and L below it
+    [[nodiscard]] constexpr const matrix_type& factors() const noexcept { return this->factors_; }
+    /// @brief Returns the row interchanged with row i at step i of the factorization
+    [[nodiscard]] constexpr const pivots_type& pivots() const noexcept { return this->pivots_; }
+    /// @brief Returns true if U has a zero on its diagonal
+    [[nodiscard]] constexpr bool is_singular() const noexcept { return !this->nonsingular_; }
+
+    //- Operations
+    /// @brief Returns the determinant of the square factored matrix
+    /// @throw length_error if the factored matrix is not square
+    [[nodiscard]] value_type determinant() const
+    {
+      this->check_square();
+      value_type det = value_type( 1 );
+      for ( ::std::size_t i = 0; i < this->pivots_.size(); ++i )
+      {
+        det *= LINALG_DETAIL::access( this->factors_, i, i );
+        if ( this->pivots_[i] != i )
+        {
+          det = -det;
+        }
+      }
+      return det;
+    }
+
+    /// @brief Returns x solving A x = b for a vector or a matrix of right hand sides
+    /// @throw length_error if the factored matrix is not square or b has the wrong number of rows
+    /// @throw domain_error if the factored matrix is singular
+#ifdef LINALG_ENABLE_CONCEPTS
+    template < class Rhs >
+      requires ( LINALG_CONCEPTS::tensor_expression< Rhs > && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) )
+#else
+    template < class Rhs,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Rhs > && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) > >
+#endif
+    [[nodiscard]] auto solve( const Rhs& b ) const
+    {
+      if ( static_cast< ::std::size_t >( b.extent(0) ) != static_cast< ::std::size_t >( this->factors_.extent(0) ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Tensor extents are incompatable." );
+      }
+      auto x = LINALG_DETAIL::make_solution< value_type >( b );
+      this->solve_in_place( x );
+      return x;
+    }
+
+    /// @brief Returns the inverse of the factored matrix
+    /// @throw length_error if the factored matrix is not square
+    /// @throw domain_error if the factored matrix is singular
+    [[nodiscard]] auto inverse() const
+    {
+      auto x = LINALG_DETAIL::make_solution< value_type >( this->factors_ );
+      for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( x.extent(0) ); ++i )
+      {
+        for ( ::std::size_t j = 0; j < static_cast< ::std::size_t >( x.extent(1) ); ++j )
+        {
+          LINALG_DETAIL::access( x, i, j ) = value_type( ( i == j ) ? 1 : 0 );
+        }
+      }
+      this->solve_in_place( x );
+      return x;
+    }
+
+    /// @brief Overwrites x, a writable vector or matrix of right hand sides, with the solution of A x = b
+    /// @throw length_error if the factored matrix is not square
+    /// @throw domain_error if the factored matrix is singular
+    template < class Solution >
+    void solve_in_place( Solution& x ) const
+    {
+      this->check_square();
+      if ( !this->nonsingular_ ) LINALG_UNLIKELY
+      {
+        throw ::std::domain_error( "Matrix is singular." );
+      }
+      const auto lu = LINALG_DETAIL::make_block( this->factors_ );
+      const auto xb = LINALG_DETAIL::make_block( x );
+      // Apply P, then solve with L and U
+      for ( ::std::size_t i = 0; i < this->pivots_.size(); ++i )
+      {
+        if ( this->pivots_[i] != i )
+        {
+          for ( ::std::size_t j = 0; j < xb.extent(1); ++j )
+          {
+            ::std::swap( xb( i, j ), xb( this->pivots_[i], j ) );
+          }
+        }
+      }
+      LINALG_DETAIL::unit_lower_solve( lu, xb );
+      LINALG_DETAIL::upper_solve( lu, xb );
+    }
+
+  private:
+    //- Implementation
+    void check_square() const
+    {
+      if ( this->factors_.extent(0) != this->factors_.extent(1) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Tensor extents are incompatable." );
+      }
+    }
+
+    //- Data
+    Matrix      factors_;
+    pivots_type pivots_;
+    bool        nonsingular_;
+};
+
+/// @brief Factors a matrix in place as P A = L U using partial pivoting
+/// @param a writable matrix, such as a dr_tensor, fs_tensor or a view returned by submatrix
+/// @return factorization referring to a if a is an lvalue, or holding a otherwise
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::writable_tensor< ::std::remove_cvref_t< Matrix > > &&
+             !::std::is_const_v< ::std::remove_reference_t< Matrix > > &&
+             ( ::std::remove_cvref_t< Matrix >::rank() == 2 ) )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::writable_tensor_v< ::std::decay_t< Matrix > > &&
+                                          !::std::is_const_v< ::std::remove_reference_t< Matrix > > &&
+                                          ( ::std::decay_t< Matrix >::rank() == 2 ) > >
+#endif
+[[nodiscard]] lu_factorization< Matrix > lu_factor( Matrix&& a )
+{
+  return lu_factorization< Matrix >( ::std::forward< Matrix >( a ) );
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_LU_HPP
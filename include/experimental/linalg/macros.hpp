@@ -48,6 +48,11 @@
 #  endif
 #endif
 
+// Largest static extent for which kernels are fully unrolled at compile time
+#ifndef LINALG_UNROLL_EXTENT_LIMIT
+#  define LINALG_UNROLL_EXTENT_LIMIT 8
+#endif
+
 //- C++17 related macros
 
 // Support for concepts
@@ -129,6 +134,37 @@
 #  endif
 #endif
 
+// Define execution::par if available.
+// If not, then just use execution::seq instead.
+#ifndef LINALG_EXECUTION_PAR
+#  if LINALG_EXECTUION_POLICY
+#    define LINALG_EXECUTION_PAR ::std::execution::par
+#  else
+#    define LINALG_EXECUTION_PAR LINALG_EXECUTION_SEQ
+#  endif
+#endif
+
+// Define is_constant_evaluated() if available.
+// If not, then evaluation is always taken to be at run time.
+#ifndef LINALG_IS_CONSTANT_EVALUATED
+#  if defined( __cpp_lib_is_constant_evaluated )
+#    define LINALG_IS_CONSTANT_EVALUATED() ::std::is_constant_evaluated()
+#  elif ( LINALG_COMPILER_GNU >= 9 ) || ( LINALG_COMPILER_CLANG >= 9 )
+#    define LINALG_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#  else
+#    define LINALG_IS_CONSTANT_EVALUATED() false
+#  endif
+#endif
+
+// Bit casts in constant expressions not supported until C++20
+#ifndef LINALG_CONSTEXPR_BIT_CAST
+#  if defined( __cpp_lib_bit_cast )
+#    define LINALG_CONSTEXPR_BIT_CAST constexpr
+#  else
+#    define LINALG_CONSTEXPR_BIT_CAST
+#  endif
+#endif
+
 #ifndef LINALG_ENABLE_RANGES
 #  if ( __cpp_lib_ranges >= 201911L ) && ( ( LINALG_COMPILER_GNU >= 10 ) || ( LINALG_COMPILER_CLANG >= 15 ) || ( LINALG_COMPILER_MSVC >= 1929 ) )
 #    define LINALG_ENABLE_RANGES
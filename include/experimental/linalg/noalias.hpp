@@ -0,0 +1,152 @@
+//==================================================================================================
+//  File:       noalias.hpp
+//
+//  Summary:    This header defines:
+//              LINALG::noalias_assignment< Tensor >
+//              LINALG::noalias( Tensor& t )
+//
+//              noalias( dst ) = expr evaluates the expression directly into the destination buffer.
+//              The caller guarantees no operand of the expression shares storage with dst, so neither
+//              the runtime overlap check nor a temporary is required.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_NOALIAS_HPP
+#define LINEAR_ALGEBRA_NOALIAS_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_BEGIN // linalg namespace
+
+//======================
+//  No Alias Assignment
+//======================
+
+/// @brief Assigns to a tensor without guarding against operands which share its storage
+/// @tparam Tensor writable tensor
+template < class Tensor >
+class noalias_assignment
+{
+  public:
+    //- Constructors
+
+    /// @brief Constructs from the destination tensor
+    explicit constexpr noalias_assignment( Tensor& t ) noexcept : t_( t ) { }
+
+    //- Assignment
+
+    /// @brief Evaluates the expression directly into the destination
+    /// Dynamic destinations are resized to the extents of the expression, others must match.
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Expression >
+      requires ( LINALG_CONCEPTS::tensor_expression< ::std::remove_reference_t< Expression > > &&
+                 ( ::std::remove_reference_t< Expression >::rank() == Tensor::rank() ) )
+    #else
+    template < class Expression,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< ::std::remove_reference_t< Expression > > &&
+                                              ( ::std::remove_reference_t< Expression >::rank() == Tensor::rank() ) > >
+    #endif
+    constexpr Tensor& operator = ( Expression&& rhs )
+    {
+      this->match_extents( rhs );
+      LINALG_DETAIL::assign_view( this->t_, rhs );
+      return this->t_;
+    }
+    /// @brief Adds the expression directly into the destination
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Expression >
+      requires ( LINALG_CONCEPTS::tensor_expression< ::std::remove_reference_t< Expression > > &&
+                 ( ::std::remove_reference_t< Expression >::rank() == Tensor::rank() ) )
+    #else
+    template < class Expression,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< ::std::remove_reference_t< Expression > > &&
+                                              ( ::std::remove_reference_t< Expression >::rank() == Tensor::rank() ) > >
+    #endif
+    constexpr Tensor& operator += ( Expression&& rhs )
+    {
+      this->check_extents( rhs );
+      LINALG_DETAIL::apply_all( this->t_,
+                                [this,&rhs]( auto ... indices ) constexpr
+                                  { LINALG_DETAIL::access( this->t_, indices ... ) += LINALG_DETAIL::access( rhs, indices ... ); },
+                                LINALG_EXECUTION_UNSEQ );
+      return this->t_;
+    }
+    /// @brief Subtracts the expression directly from the destination
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Expression >
+      requires ( LINALG_CONCEPTS::tensor_expression< ::std::remove_reference_t< Expression > > &&
+                 ( ::std::remove_reference_t< Expression >::rank() == Tensor::rank() ) )
+    #else
+    template < class Expression,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< ::std::remove_reference_t< Expression > > &&
+                                              ( ::std::remove_reference_t< Expression >::rank() == Tensor::rank() ) > >
+    #endif
+    constexpr Tensor& operator -= ( Expression&& rhs )
+    {
+      this->check_extents( rhs );
+      LINALG_DETAIL::apply_all( this->t_,
+                                [this,&rhs]( auto ... indices ) constexpr
+                                  { LINALG_DETAIL::access( this->t_, indices ... ) -= LINALG_DETAIL::access( rhs, indices ... ); },
+                                LINALG_EXECUTION_UNSEQ );
+      return this->t_;
+    }
+
+  private:
+    //- Helpers
+
+    template < class Expression >
+    constexpr void check_extents( const Expression& rhs ) const
+    {
+      for ( typename Tensor::rank_type dim = 0; dim < Tensor::rank(); ++dim )
+      {
+        if ( static_cast< typename Tensor::index_type >( rhs.extent( dim ) ) != this->t_.extent( dim ) ) LINALG_UNLIKELY
+        {
+          throw ::std::length_error( "Tensor extents are incompatable." );
+        }
+      }
+    }
+    template < class Expression >
+    constexpr void match_extents( const Expression& rhs )
+    {
+      #ifdef LINALG_ENABLE_CONCEPTS
+      if constexpr ( LINALG_CONCEPTS::dynamic_tensor< Tensor > )
+      #else
+      if constexpr ( LINALG_CONCEPTS::dynamic_tensor_v< Tensor > )
+      #endif
+      {
+        if ( this->t_.extents() != rhs.extents() )
+        {
+          this->t_.resize( rhs.extents() );
+        }
+      }
+      else
+      {
+        this->check_extents( rhs );
+      }
+    }
+
+    //- Data
+    Tensor& t_;
+};
+
+//===========
+//  No Alias
+//===========
+
+/// @brief Returns an assignment target which skips the overlap check and temporary of tensor assignment
+/// @tparam Tensor writable tensor
+/// @param t destination tensor, which no operand of the assigned expression may share storage with
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Tensor >
+  requires LINALG_CONCEPTS::writable_tensor< Tensor >
+#else
+template < class Tensor,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::writable_tensor_v< Tensor > > >
+#endif
+[[nodiscard]] constexpr noalias_assignment< Tensor > noalias( Tensor& t ) noexcept
+{
+  return noalias_assignment< Tensor >( t );
+}
+
+LINALG_END // linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_NOALIAS_HPP
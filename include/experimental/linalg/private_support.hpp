@@ -273,6 +273,39 @@ constexpr void constexpr_for( F&& f )
   }
 }
 
+//==================================================================================================
+//  Is Unrollable is true if the static extents are small enough for kernels to be fully unrolled
+//==================================================================================================
+template < ::std::size_t Extent >
+inline constexpr bool is_unrollable_extent_v = ( Extent != ::std::dynamic_extent ) && ( Extent <= LINALG_UNROLL_EXTENT_LIMIT );
+
+template < class Extents, class Seq = ::std::make_index_sequence< Extents::rank() > >
+struct is_unrollable_extents : public ::std::false_type { };
+
+template < class Extents, ::std::size_t ... Indices >
+struct is_unrollable_extents< Extents, ::std::index_sequence< Indices ... > >
+  : public ::std::bool_constant< ( is_unrollable_extent_v< Extents::static_extent( Indices ) > && ... ) > { };
+
+template < class Extents >
+inline constexpr bool is_unrollable_extents_v = is_unrollable_extents< Extents >::value;
+
+//==================================================================================================
+//  Constexpr Apply All applies the lambda expression to every index of unrollable static extents
+//==================================================================================================
+template < class Extents, ::std::size_t Dim = 0, class Lambda, class ... IndexType >
+constexpr LINALG_FORCE_INLINE_FUNCTION void constexpr_apply_all( Lambda&& lambda, IndexType ... indices )
+{
+  if constexpr ( Dim == Extents::rank() )
+  {
+    lambda( indices ... );
+  }
+  else
+  {
+    constexpr_for< ::std::size_t( 0 ), Extents::static_extent( Dim ), ::std::size_t( 1 ) >(
+      [&]( auto index ) constexpr { constexpr_apply_all< Extents, Dim + 1 >( lambda, indices ..., index ); } );
+  }
+}
+
 //==================================================================================================
 //  Has Index Operator concept is met if lambda has operator()( Indices ... ) defined
 //==================================================================================================
@@ -905,7 +938,14 @@ assign_view( ToView& to_view, const FromView& from_view )
   noexcept( extents_are_equal_v< typename FromView::extents_type, typename ToView::extents_type > &&
             is_nothrow_convertible_v< typename FromView::reference, typename ToView::value_type > )
 {
-  if constexpr ( extents_are_equal_v< typename FromView::extents_type, typename ToView::extents_type > )
+  if constexpr ( extents_are_equal_v< typename FromView::extents_type, typename ToView::extents_type > &&
+                 is_unrollable_extents_v< typename ToView::extents_type > )
+  {
+    // Small static extents are fully unrolled which also keeps assignment usable in constant expressions
+    constexpr_apply_all< typename ToView::extents_type >(
+      [ &to_view, &from_view ]( auto ... indices ) constexpr { access( to_view, indices ... ) = access( from_view, indices ... ); } );
+  }
+  else if constexpr ( extents_are_equal_v< typename FromView::extents_type, typename ToView::extents_type > )
   {
     apply_all( from_view,
                [ &to_view, &from_view ]( auto ... indices )
@@ -931,6 +971,20 @@ assign_view( ToView& to_view, const FromView& from_view )
   return to_view;
 }
 
+//==================================================================================================
+//  Construct At constructs an object in place, in constant expressions where supported
+//==================================================================================================
+template < class T, class ... Args >
+constexpr T* construct_at( T* p, Args&& ... args )
+  noexcept( ::std::is_nothrow_constructible_v< T, Args ... > )
+{
+  #ifdef __cpp_lib_constexpr_dynamic_alloc
+  return ::std::construct_at( p, ::std::forward< Args >( args ) ... );
+  #else
+  return ::new ( static_cast< void* >( p ) ) T( ::std::forward< Args >( args ) ... );
+  #endif
+}
+
 //==================================================================================================
 //  Copy View copies inplace views with disparate but compatable types
 //==================================================================================================
@@ -940,7 +994,15 @@ copy_view( ToView& to_view, const FromView& from_view )
   noexcept( extents_are_equal_v< typename FromView::extents_type, typename ToView::extents_type > &&
             is_nothrow_convertible_v< typename FromView::value_type, typename ToView::value_type > )
 {
-  if constexpr ( extents_are_equal_v< typename FromView::extents_type, typename ToView::extents_type > )
+  if constexpr ( extents_are_equal_v< typename FromView::extents_type, typename ToView::extents_type > &&
+                 is_unrollable_extents_v< typename ToView::extents_type > )
+  {
+    // Small static extents are fully unrolled which also keeps copying usable in constant expressions
+    constexpr_apply_all< typename ToView::extents_type >(
+      [ &to_view, &from_view ]( auto ... indices ) constexpr
+        { LINALG_DETAIL::construct_at( ::std::addressof( access( to_view, indices ... ) ), access( from_view, indices ... ) ); } );
+  }
+  else if constexpr ( extents_are_equal_v< typename FromView::extents_type, typename ToView::extents_type > )
   {
     apply_all( ::std::forward<ToView>( to_view ),
               [ &to_view, &from_view ]( auto ... indices )
@@ -1025,6 +1087,127 @@ using extents_helper = extents_helper_impl< ::std::make_integer_sequence<U,R> >;
 template < class U, ::std::size_t R >
 using dyn_extents = typename extents_helper< U, R >::extents_type;
 
+//==================================================================================================
+//  Has Data Handle returns true if the tensor exposes its buffer through a pointer
+//==================================================================================================
+template < class T, class = void >
+struct has_data_handle : public ::std::false_type { };
+
+template < class T >
+struct has_data_handle< T, ::std::void_t< decltype( ::std::declval< T& >().data_handle() ) > > :
+  public ::std::is_pointer< decltype( ::std::declval< T& >().data_handle() ) > { };
+
+template < class T >
+inline constexpr bool has_data_handle_v = has_data_handle< T >::value;
+
+//==================================================================================================
+//  Overlaps returns true if any operand of a tensor expression may share storage with a tensor
+//==================================================================================================
+template < class T, class = void >
+struct has_binary_operands : public ::std::false_type { };
+
+template < class T >
+struct has_binary_operands< T, ::std::void_t< decltype( ::std::declval< const T& >().first() ),
+                                              decltype( ::std::declval< const T& >().second() ) > > : public ::std::true_type { };
+
+template < class T, class = void >
+struct has_unary_operand : public ::std::false_type { };
+
+template < class T >
+struct has_unary_operand< T, ::std::void_t< decltype( ::std::declval< const T& >().underlying() ) > > : public ::std::true_type { };
+
+template < class T, class = void >
+struct has_mapped_buffer : public ::std::false_type { };
+
+template < class T >
+struct has_mapped_buffer< T, ::std::void_t< decltype( ::std::declval< const T& >().mapping().required_span_size() ) > > :
+  public has_data_handle< const T > { };
+
+template < class T, class = void >
+struct has_extents : public ::std::false_type { };
+
+template < class T >
+struct has_extents< T, ::std::void_t< typename T::extents_type > > : public ::std::true_type { };
+
+template < class Tensor >
+[[nodiscard]] constexpr bool overlaps_range( const Tensor& t, const void* first, const void* last ) noexcept
+{
+  if constexpr ( has_mapped_buffer< Tensor >::value )
+  {
+    const auto          begin = t.data_handle();
+    const ::std::size_t size  = static_cast< ::std::size_t >( t.mapping().required_span_size() );
+    if ( ( size == 0 ) || ( first == last ) )
+    {
+      return false;
+    }
+    const void* t_first = static_cast< const void* >( begin );
+    const void* t_last  = static_cast< const void* >( begin + size );
+    return ::std::less< const void* >{}( t_first, last ) && ::std::less< const void* >{}( first, t_last );
+  }
+  else if constexpr ( has_binary_operands< Tensor >::value )
+  {
+    return overlaps_range( t.first(), first, last ) || overlaps_range( t.second(), first, last );
+  }
+  else if constexpr ( has_unary_operand< Tensor >::value )
+  {
+    return overlaps_range( t.underlying(), first, last );
+  }
+  else
+  {
+    // Tensors with unknown storage are assumed to overlap, scalars never do
+    return has_extents< Tensor >::value;
+  }
+}
+
+/// @brief Returns true if both tensors view exactly the same elements of the same buffer
+template < class FirstTensor, class SecondTensor >
+[[nodiscard]] constexpr bool is_same_view( const FirstTensor& t1, const SecondTensor& t2 ) noexcept
+{
+  if constexpr ( has_mapped_buffer< FirstTensor >::value && has_mapped_buffer< SecondTensor >::value &&
+                 ( FirstTensor::rank() == SecondTensor::rank() ) )
+  {
+    if ( static_cast< const void* >( t1.data_handle() ) != static_cast< const void* >( t2.data_handle() ) )
+    {
+      return false;
+    }
+    for ( typename FirstTensor::rank_type n = 0; n < FirstTensor::rank(); ++n )
+    {
+      if ( ( static_cast< ::std::size_t >( t1.extent( n ) ) != static_cast< ::std::size_t >( t2.extent( n ) ) ) ||
+           ( static_cast< ::std::size_t >( t1.stride( n ) ) != static_cast< ::std::size_t >( t2.stride( n ) ) ) )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+/// @brief Returns true if any leaf operand of the expression may share storage with the tensor
+/// Leaves which do not expose their buffer are conservatively reported as overlapping.
+template < class Expression, class Tensor >
+[[nodiscard]] constexpr bool overlaps( const Expression& expr, const Tensor& t ) noexcept
+{
+  // Unrelated addresses cannot be ordered during constant evaluation
+  if ( LINALG_IS_CONSTANT_EVALUATED() )
+  {
+    return true;
+  }
+  if constexpr ( has_mapped_buffer< Tensor >::value )
+  {
+    const auto          begin = t.data_handle();
+    const ::std::size_t size  = static_cast< ::std::size_t >( t.mapping().required_span_size() );
+    return overlaps_range( expr, static_cast< const void* >( begin ), static_cast< const void* >( begin + size ) );
+  }
+  else
+  {
+    return true;
+  }
+}
+
 LINALG_DETAIL_END // end detail namespace
 
 #endif  //- LINEAR_ALGEBRA_PRIVATE_SUPPORT_HPP
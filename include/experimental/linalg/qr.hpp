@@ -0,0 +1,603 @@
+//==================================================================================================
+//  File:       qr.hpp
+//
+//  Summary:    This header defines the Householder QR factorization and least squares solvers:
+//              qr_mode
+//              qr_factorization< Matrix >
+//              qr_factor( Matrix&& a )
+//              tsqr_r( const Matrix& a[, blocks] )
+//              least_squares( const Matrix& a, const Rhs& b[, qr_mode mode] )
+//
+//              The factorization overwrites the matrix with R on and above the diagonal and the
+//              Householder vectors below it. Panels of qr_block_extent columns are factored one
+//              reflector at a time, then their reflectors are applied to the trailing matrix together
+//              in the compact WY form I - V T V^H, so the update is a pair of matrix products over
+//              tiles of columns run in parallel for large matrices.
+//
+//              For tall and skinny matrices, the TSQR mode factors blocks of rows in parallel and
+//              merges their R factors with one more, small, factorization of the stacked factors.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_QR_HPP
+#define LINEAR_ALGEBRA_QR_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//--------------------------
+//  Householder Reflectors
+//--------------------------
+
+// Columns of the panel factored before the trailing matrix is updated
+inline constexpr ::std::size_t qr_block_extent = 32;
+
+/// @brief Generates the reflector H = I - tau v v^H with H^H x = beta e_0 for the column block x
+/// @return tau; x is overwritten with beta followed by v below its first element, v_0 = 1 being implicit
+template < class M >
+[[nodiscard]] auto householder_reflector( const matrix_block< M >& x )
+{
+  using value_type = typename matrix_block< M >::value_type;
+  using real_type  = decltype( ::std::abs( ::std::declval< value_type >() ) );
+  const value_type alpha = x( 0, 0 );
+  real_type        large = real_type( 0 );
+  for ( ::std::size_t i = 1; i < x.extent(0); ++i )
+  {
+    large = ::std::max( large, static_cast< real_type >( ::std::abs( x( i, 0 ) ) ) );
+  }
+  if ( ( large == real_type( 0 ) ) && ( ::std::imag( alpha ) == real_type( 0 ) ) )
+  {
+    return value_type( 0 );
+  }
+  // Sum of squares relative to the largest element, so tiny columns do not underflow
+  large          = ::std::max( large, static_cast< real_type >( ::std::abs( alpha ) ) );
+  real_type norm = ::std::norm( alpha / large );
+  for ( ::std::size_t i = 1; i < x.extent(0); ++i )
+  {
+    norm += ::std::norm( x( i, 0 ) / large );
+  }
+  const real_type  beta  = -::std::copysign( large * ::std::sqrt( norm ), ::std::real( alpha ) );
+  const value_type scale = value_type( 1 ) / ( alpha - beta );
+  for ( ::std::size_t i = 1; i < x.extent(0); ++i )
+  {
+    x( i, 0 ) *= scale;
+  }
+  x( 0, 0 ) = value_type( beta );
+  return value_type( ( value_type( beta ) - alpha ) / beta );
+}
+
+/// @brief Element of the unit lower trapezoidal matrix of reflectors stored below the diagonal of v
+template < class M >
+[[nodiscard]] constexpr auto reflector_element( const matrix_block< M >& v, ::std::size_t i, ::std::size_t k )
+{
+  using value_type = typename matrix_block< M >::value_type;
+  return ( i < k ) ? value_type( 0 ) : ( i == k ) ? value_type( 1 ) : value_type( v( i, k ) );
+}
+
+/// @brief Factors the panel p one reflector at a time, applying each to the rest of the panel
+template < class M, class Tau >
+void householder_panel( const matrix_block< M >& p, Tau* tau )
+{
+  using value_type = typename matrix_block< M >::value_type;
+  const ::std::size_t rows    = p.extent(0);
+  const ::std::size_t columns = p.extent(1);
+  for ( ::std::size_t j = 0; j < ::std::min( rows, columns ); ++j )
+  {
+    tau[j] = householder_reflector( p.block( j, j, rows - j, 1 ) );
+    const value_type tau_j = LINALG_EXPRESSIONS_DETAIL::conjugate_value( tau[j] );
+    for ( ::std::size_t c = j + 1; c < columns; ++c )
+    {
+      value_type w = p( j, c );
+      for ( ::std::size_t i = j + 1; i < rows; ++i )
+      {
+        w += LINALG_EXPRESSIONS_DETAIL::conjugate_value( p( i, j ) ) * p( i, c );
+      }
+      w *= tau_j;
+      p( j, c ) -= w;
+      for ( ::std::size_t i = j + 1; i < rows; ++i )
+      {
+        p( i, c ) -= p( i, j ) * w;
+      }
+    }
+  }
+}
+
+/// @brief Returns the upper triangular T, stored row major, for which H_0 H_1 ... = I - V T V^H
+template < class M, class Tau >
+[[nodiscard]] auto block_reflector_factor( const matrix_block< M >& v, const Tau* tau )
+{
+  using value_type = typename matrix_block< M >::value_type;
+  const ::std::size_t width = v.extent(1);
+  ::std::vector< value_type > t( width * width, value_type( 0 ) );
+  ::std::vector< value_type > w( width );
+  for ( ::std::size_t i = 0; i < width; ++i )
+  {
+    t[ i * width + i ] = tau[i];
+    // w = V( :, 0:i )^H v_i
+    for ( ::std::size_t k = 0; k < i; ++k )
+    {
+      w[k] = LINALG_EXPRESSIONS_DETAIL::conjugate_value( v( i, k ) );
+      for ( ::std::size_t r = i + 1; r < v.extent(0); ++r )
+      {
+        w[k] += LINALG_EXPRESSIONS_DETAIL::conjugate_value( v( r, k ) ) * v( r, i );
+      }
+    }
+    // T( 0:i, i ) = -tau_i T( 0:i, 0:i ) w
+    for ( ::std::size_t k = 0; k < i; ++k )
+    {
+      value_type sum = value_type( 0 );
+      for ( ::std::size_t l = k; l < i; ++l )
+      {
+        sum += t[ k * width + l ] * w[l];
+      }
+      t[ k * width + i ] = -tau[i] * sum;
+    }
+  }
+  return t;
+}
+
+/// @brief Applies I - V T V^H, or its adjoint, to c from the left with tiles of columns of c run in parallel
+template < bool Adjoint, class M, class C, class Value >
+void apply_block_reflector( const matrix_block< M >& v, const ::std::vector< Value >& t, const matrix_block< C >& c )
+{
+  using value_type = typename matrix_block< C >::value_type;
+  const ::std::size_t rows    = c.extent(0);
+  const ::std::size_t columns = c.extent(1);
+  const ::std::size_t width   = v.extent(1);
+  if ( ( columns == 0 ) || ( width == 0 ) )
+  {
+    return;
+  }
+  ::std::vector< ::std::size_t > tiles( ( columns + parallel_tile_extent - 1 ) / parallel_tile_extent );
+  ::std::iota( tiles.begin(), tiles.end(), ::std::size_t( 0 ) );
+  // Cache the last exception to be thrown
+  ::std::exception_ptr eptr;
+  const auto update_tile = [&]( ::std::size_t tile ) noexcept
+  {
+    try
+    {
+      const ::std::size_t first = tile * parallel_tile_extent;
+      const ::std::size_t count = ::std::min( parallel_tile_extent, columns - first );
+      // w = V^H c
+      ::std::vector< value_type > w( width * count, value_type( 0 ) );
+      for ( ::std::size_t r = 0; r < rows; ++r )
+      {
+        for ( ::std::size_t k = 0; k < ::std::min( width, r + 1 ); ++k )
+        {
+          const value_type v_rk = LINALG_EXPRESSIONS_DETAIL::conjugate_value( reflector_element( v, r, k ) );
+          for ( ::std::size_t j = 0; j < count; ++j )
+          {
+            w[ k * count + j ] += v_rk * c( r, first + j );
+          }
+        }
+      }
+      // T w, or T^H w
+      ::std::vector< value_type > tw( width * count, value_type( 0 ) );
+      for ( ::std::size_t k = 0; k < width; ++k )
+      {
+        for ( ::std::size_t l = 0; l < width; ++l )
+        {
+          value_type t_kl;
+          if constexpr ( Adjoint )
+          {
+            if ( l > k ) { continue; }
+            t_kl = LINALG_EXPRESSIONS_DETAIL::conjugate_value( t[ l * width + k ] );
+          }
+          else
+          {
+            if ( l < k ) { continue; }
+            t_kl = t[ k * width + l ];
+          }
+          for ( ::std::size_t j = 0; j < count; ++j )
+          {
+            tw[ k * count + j ] += t_kl * w[ l * count + j ];
+          }
+        }
+      }
+      // c -= V w
+      for ( ::std::size_t r = 0; r < rows; ++r )
+      {
+        for ( ::std::size_t k = 0; k < ::std::min( width, r + 1 ); ++k )
+        {
+          const value_type v_rk = reflector_element( v, r, k );
+          for ( ::std::size_t j = 0; j < count; ++j )
+          {
+            c( r, first + j ) -= v_rk * tw[ k * count + j ];
+          }
+        }
+      }
+    }
+    catch ( ... ) { eptr = ::std::current_exception(); }
+  };
+  if ( rows * columns * width < parallel_product_threshold )
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_SEQ, tiles.begin(), tiles.end(), update_tile );
+  }
+  else
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR, tiles.begin(), tiles.end(), update_tile );
+  }
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+}
+
+/// @brief Blocked Householder factorization of a in place, with the scalar factors of the reflectors in tau
+template < class Matrix, class Tau >
+void blocked_qr( Matrix& a, Tau* tau )
+{
+  const ::std::size_t rows    = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( a.extent(1) );
+  const ::std::size_t steps   = ::std::min( rows, columns );
+  const auto          block   = LINALG_DETAIL::make_block( a );
+  for ( ::std::size_t j = 0; j < steps; j += qr_block_extent )
+  {
+    const ::std::size_t width = ::std::min( qr_block_extent, steps - j );
+    const auto          panel = block.block( j, j, rows - j, width );
+    householder_panel( panel, tau + j );
+    if ( j + width < columns )
+    {
+      apply_block_reflector< true >( panel, block_reflector_factor( panel, tau + j ), block.block( j, j + width, rows - j, columns - j - width ) );
+    }
+  }
+}
+
+/// @brief Applies Q = H_0 H_1 ... H_k-1, or its adjoint, held in factors and tau, to c from the left
+template < bool Adjoint, class M, class C, class Tau >
+void apply_householder_q( const matrix_block< M >& factors, const Tau* tau, const matrix_block< C >& c )
+{
+  const ::std::size_t rows  = factors.extent(0);
+  const ::std::size_t steps = ::std::min( rows, factors.extent(1) );
+  const ::std::size_t count = ( steps + qr_block_extent - 1 ) / qr_block_extent;
+  for ( ::std::size_t n = 0; n < count; ++n )
+  {
+    // Q^H applies the blocks first to last, Q last to first
+    const ::std::size_t j     = ( Adjoint ? n : count - 1 - n ) * qr_block_extent;
+    const ::std::size_t width = ::std::min( qr_block_extent, steps - j );
+    const auto          panel = factors.block( j, j, rows - j, width );
+    apply_block_reflector< Adjoint >( panel, block_reflector_factor( panel, tau + j ), c.block( j, 0, rows - j, c.extent(1) ) );
+  }
+}
+
+//--------
+//  TSQR
+//--------
+
+/// @brief Returns the R factor of the rows x columns matrix with the given elements, factoring blocks
+///        of rows in parallel and then the stack of their R factors
+/// @param count blocks of rows, each of at least 2 columns rows; 0 takes one per hardware thread
+template < class T, class Element >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > tsqr_r_factor( ::std::size_t rows, ::std::size_t columns, Element element, ::std::size_t count = 0 )
+{
+  using matrix_type  = LINALG::dyn_tensor< T, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  const ::std::size_t workers    = ( count == 0 ) ? ::std::max( ::std::size_t( ::std::thread::hardware_concurrency() ), ::std::size_t( 1 ) ) : count;
+  const ::std::size_t block_rows = ::std::max( 2 * columns, ( rows + workers - 1 ) / workers );
+  const ::std::size_t blocks     = ::std::max( ( rows + block_rows - 1 ) / block_rows, ::std::size_t( 1 ) );
+  // Each block writes its R factor to its own rows of the stack
+  matrix_type stack( extents_type( blocks * columns, columns ) );
+  ::std::vector< ::std::size_t > indices( blocks );
+  ::std::iota( indices.begin(), indices.end(), ::std::size_t( 0 ) );
+  // Cache the last exception to be thrown
+  ::std::exception_ptr eptr;
+  LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR,
+                           indices.begin(),
+                           indices.end(),
+                           [&]( ::std::size_t b ) noexcept
+                           {
+                             try
+                             {
+                               const ::std::size_t first  = b * block_rows;
+                               const ::std::size_t height = ::std::min( block_rows, rows - first );
+                               matrix_type local( extents_type( height, columns ) );
+                               for ( ::std::size_t i = 0; i < height; ++i )
+                               {
+                                 for ( ::std::size_t j = 0; j < columns; ++j )
+                                 {
+                                   LINALG_DETAIL::access( local, i, j ) = static_cast< T >( element( first + i, j ) );
+                                 }
+                               }
+                               ::std::vector< T > tau( ::std::min( height, columns ) );
+                               blocked_qr( local, tau.data() );
+                               for ( ::std::size_t i = 0; i < columns; ++i )
+                               {
+                                 for ( ::std::size_t j = 0; j < columns; ++j )
+                                 {
+                                   LINALG_DETAIL::access( stack, b * columns + i, j ) = ( ( i <= j ) && ( i < height ) ) ? LINALG_DETAIL::access( local, i, j ) : T( 0 );
+                                 }
+                               }
+                             }
+                             catch ( ... ) { eptr = ::std::current_exception(); }
+                           } );
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+  // Merge the R factors
+  const ::std::size_t steps = ::std::min( rows, columns );
+  if ( blocks > 1 )
+  {
+    ::std::vector< T > tau( columns );
+    blocked_qr( stack, tau.data() );
+  }
+  matrix_type r( extents_type( steps, columns ) );
+  for ( ::std::size_t i = 0; i < steps; ++i )
+  {
+    for ( ::std::size_t j = 0; j < columns; ++j )
+    {
+      LINALG_DETAIL::access( r, i, j ) = ( i <= j ) ? LINALG_DETAIL::access( stack, i, j ) : T( 0 );
+    }
+  }
+  return r;
+}
+
+/// @brief Solves the upper triangular system in the first columns of r for the remaining columns of r
+/// @throw domain_error if r has a zero on its diagonal
+template < class T, class Matrix >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > triangular_least_squares( const Matrix& r, ::std::size_t columns )
+{
+  using matrix_type  = LINALG::dyn_tensor< T, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  for ( ::std::size_t i = 0; i < columns; ++i )
+  {
+    if ( LINALG_DETAIL::access( r, i, i ) == T( 0 ) ) LINALG_UNLIKELY
+    {
+      throw ::std::domain_error( "Matrix is rank deficient." );
+    }
+  }
+  const ::std::size_t rhs = static_cast< ::std::size_t >( r.extent(1) ) - columns;
+  matrix_type x( extents_type( columns, rhs ) );
+  for ( ::std::size_t i = 0; i < columns; ++i )
+  {
+    for ( ::std::size_t j = 0; j < rhs; ++j )
+    {
+      LINALG_DETAIL::access( x, i, j ) = LINALG_DETAIL::access( r, i, columns + j );
+    }
+  }
+  LINALG_DETAIL::upper_solve( LINALG_DETAIL::make_block( r ).block( 0, 0, columns, columns ), LINALG_DETAIL::make_block( x ) );
+  return x;
+}
+
+/// @brief Returns the rows x columns solution held in x as a tensor of the given rank
+template < class T, ::std::size_t Rank, class M >
+[[nodiscard]] LINALG::dyn_tensor< T, Rank > least_squares_result( const matrix_block< M >& x, ::std::size_t rows, ::std::size_t columns )
+{
+  using result_type  = LINALG::dyn_tensor< T, Rank >;
+  using extents_type = typename result_type::extents_type;
+  if constexpr ( Rank == 1 )
+  {
+    result_type result { extents_type( rows ) };
+    for ( ::std::size_t i = 0; i < rows; ++i )
+    {
+      LINALG_DETAIL::access( result, i ) = x( i, 0 );
+    }
+    return result;
+  }
+  else
+  {
+    result_type result( extents_type( rows, columns ) );
+    for ( ::std::size_t i = 0; i < rows; ++i )
+    {
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        LINALG_DETAIL::access( result, i, j ) = x( i, j );
+      }
+    }
+    return result;
+  }
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//--------------------
+//  QR Factorization
+//--------------------
+
+/// @brief Algorithm used to solve least squares problems
+enum class qr_mode
+{
+  householder, // Blocked Householder factorization of the whole matrix
+  tsqr         // Blocks of rows factored in parallel and their R factors merged, for tall and skinny matrices
+};
+
+/// @brief Householder factorization A = Q R, stored over the factored matrix
+/// @tparam Matrix factored matrix type; an lvalue reference when an lvalue was factored in place
+template < class Matrix >
+class qr_factorization
+{
+  public:
+    //- Aliases
+    using matrix_type = ::std::decay_t< Matrix >;
+    using value_type  = ::std::remove_cv_t< typename matrix_type::value_type >;
+    using result_type = LINALG::dyn_tensor< value_type, 2 >;
+
+    //- Constructors
+    /// @brief Factors the matrix in place
+    explicit qr_factorization( Matrix&& a ) :
+      factors_( ::std::forward< Matrix >( a ) ),
+      tau_( ::std::min( static_cast< ::std::size_t >( this->factors_.extent(0) ), static_cast< ::std::size_t >( this->factors_.extent(1) ) ) )
+    {
+      LINALG_DETAIL::blocked_qr( this->factors_, this->tau_.data() );
+    }
+
+    //- Factors
+    /// @brief Returns the factored matrix, holding R on and above the diagonal and the Householder vectors below it
+    [[nodiscard]] constexpr const matrix_type& factors() const noexcept { return this->factors_; }
+    /// @brief Returns the scalar factors of the Householder reflectors
+    [[nodiscard]] constexpr const ::std::vector< value_type >& tau() const noexcept { return this->tau_; }
+
+    /// @brief Returns the min( m, n ) x n upper trapezoidal factor R
+    [[nodiscard]] result_type r() const
+    {
+      const ::std::size_t steps   = this->tau_.size();
+      const ::std::size_t columns = static_cast< ::std::size_t >( this->factors_.extent(1) );
+      result_type upper( typename result_type::extents_type( steps, columns ) );
+      for ( ::std::size_t i = 0; i < steps; ++i )
+      {
+        for ( ::std::size_t j = 0; j < columns; ++j )
+        {
+          LINALG_DETAIL::access( upper, i, j ) = ( i <= j ) ? value_type( LINALG_DETAIL::access( this->factors_, i, j ) ) : value_type( 0 );
+        }
+      }
+      return upper;
+    }
+
+    /// @brief Returns the m x min( m, n ) factor Q with orthonormal columns
+    [[nodiscard]] result_type thin_q() const
+    {
+      const ::std::size_t rows  = static_cast< ::std::size_t >( this->factors_.extent(0) );
+      const ::std::size_t steps = this->tau_.size();
+      result_type q( typename result_type::extents_type( rows, steps ) );
+      for ( ::std::size_t i = 0; i < rows; ++i )
+      {
+        for ( ::std::size_t j = 0; j < steps; ++j )
+        {
+          LINALG_DETAIL::access( q, i, j ) = value_type( ( i == j ) ? 1 : 0 );
+        }
+      }
+      LINALG_DETAIL::apply_householder_q< false >( LINALG_DETAIL::make_block( this->factors_ ), this->tau_.data(), LINALG_DETAIL::make_block( q ) );
+      return q;
+    }
+
+    /// @brief Returns x minimizing || A x - b || for a vector or a matrix of right hand sides
+    /// @throw length_error if A has fewer rows than columns or b has the wrong number of rows
+    /// @throw domain_error if R has a zero on its diagonal
+#ifdef LINALG_ENABLE_CONCEPTS
+    template < class Rhs >
+      requires ( LINALG_CONCEPTS::tensor_expression< Rhs > && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) )
+#else
+    template < class Rhs,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Rhs > && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) > >
+#endif
+    [[nodiscard]] LINALG::dyn_tensor< value_type, Rhs::rank() > solve( const Rhs& b ) const
+    {
+      const ::std::size_t rows    = static_cast< ::std::size_t >( this->factors_.extent(0) );
+      const ::std::size_t columns = static_cast< ::std::size_t >( this->factors_.extent(1) );
+      if ( ( rows < columns ) || ( static_cast< ::std::size_t >( b.extent(0) ) != rows ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Tensor extents are incompatable." );
+      }
+      for ( ::std::size_t i = 0; i < columns; ++i )
+      {
+        if ( LINALG_DETAIL::access( this->factors_, i, i ) == value_type( 0 ) ) LINALG_UNLIKELY
+        {
+          throw ::std::domain_error( "Matrix is rank deficient." );
+        }
+      }
+      // Q^H b, then back substitution with R over its first n rows
+      auto       y     = LINALG_DETAIL::make_solution< value_type >( b );
+      const auto block = LINALG_DETAIL::make_block( y );
+      const auto qr    = LINALG_DETAIL::make_block( this->factors_ );
+      LINALG_DETAIL::apply_householder_q< true >( qr, this->tau_.data(), block );
+      LINALG_DETAIL::upper_solve( qr.block( 0, 0, columns, columns ), block.block( 0, 0, columns, block.extent(1) ) );
+      return LINALG_DETAIL::least_squares_result< value_type, Rhs::rank() >( block, columns, block.extent(1) );
+    }
+
+  private:
+    //- Data
+    Matrix                      factors_;
+    ::std::vector< value_type > tau_;
+};
+
+/// @brief Factors a matrix in place as A = Q R using Householder reflectors
+/// @param a writable matrix, such as a dr_tensor, fs_tensor or a view returned by submatrix
+/// @return factorization referring to a if a is an lvalue, or holding a otherwise
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::writable_tensor< ::std::remove_cvref_t< Matrix > > &&
+             !::std::is_const_v< ::std::remove_reference_t< Matrix > > &&
+             ( ::std::remove_cvref_t< Matrix >::rank() == 2 ) )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::writable_tensor_v< ::std::decay_t< Matrix > > &&
+                                          !::std::is_const_v< ::std::remove_reference_t< Matrix > > &&
+                                          ( ::std::decay_t< Matrix >::rank() == 2 ) > >
+#endif
+[[nodiscard]] qr_factorization< Matrix > qr_factor( Matrix&& a )
+{
+  return qr_factorization< Matrix >( ::std::forward< Matrix >( a ) );
+}
+
+/// @brief Returns the min( m, n ) x n factor R of a, factoring blocks of its rows in parallel
+/// @param blocks blocks of rows to factor before merging their R factors, each at least 2 n rows; by default one per hardware thread
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::tensor_expression< Matrix > && ( Matrix::rank() == 2 ) )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Matrix > && ( Matrix::rank() == 2 ) > >
+#endif
+[[nodiscard]] LINALG::dyn_tensor< ::std::remove_cv_t< typename Matrix::value_type >, 2 > tsqr_r( const Matrix& a, ::std::size_t blocks = 0 )
+{
+  return LINALG_DETAIL::tsqr_r_factor< ::std::remove_cv_t< typename Matrix::value_type > >(
+    static_cast< ::std::size_t >( a.extent(0) ),
+    static_cast< ::std::size_t >( a.extent(1) ),
+    [&]( ::std::size_t i, ::std::size_t j ) { return LINALG_DETAIL::access( a, i, j ); },
+    blocks );
+}
+
+/// @brief Returns x minimizing || A x - b || for a vector or a matrix of right hand sides
+/// @param mode householder factors a copy of A; tsqr factors [ A b ] by blocks of rows, so Q is never formed
+/// @throw length_error if A has fewer rows than columns or b has the wrong number of rows
+/// @throw domain_error if A is rank deficient
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix, class Rhs >
+  requires ( LINALG_CONCEPTS::tensor_expression< Matrix > && LINALG_CONCEPTS::tensor_expression< Rhs > &&
+             ( Matrix::rank() == 2 ) && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) )
+#else
+template < class Matrix, class Rhs,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Matrix > && LINALG_CONCEPTS::tensor_expression_v< Rhs > &&
+                                          ( Matrix::rank() == 2 ) && ( ( Rhs::rank() == 1 ) || ( Rhs::rank() == 2 ) ) > >
+#endif
+[[nodiscard]] auto least_squares( const Matrix& a, const Rhs& b, qr_mode mode = qr_mode::householder )
+{
+  using value_type = ::std::common_type_t< ::std::remove_cv_t< typename Matrix::value_type >, ::std::remove_cv_t< typename Rhs::value_type > >;
+  const ::std::size_t rows    = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( a.extent(1) );
+  if ( ( rows < columns ) || ( static_cast< ::std::size_t >( b.extent(0) ) != rows ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Tensor extents are incompatable." );
+  }
+  if ( mode == qr_mode::householder )
+  {
+    LINALG::dyn_tensor< value_type, 2 > copy( typename LINALG::dyn_tensor< value_type, 2 >::extents_type( rows, columns ) );
+    for ( ::std::size_t i = 0; i < rows; ++i )
+    {
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        LINALG_DETAIL::access( copy, i, j ) = static_cast< value_type >( LINALG_DETAIL::access( a, i, j ) );
+      }
+    }
+    return qr_factor( copy ).solve( b );
+  }
+  // The R factor of [ A b ] is [ R Q^H b ] over its first n rows
+  const ::std::size_t rhs = ( Rhs::rank() == 1 ) ? 1 : static_cast< ::std::size_t >( b.extent( Rhs::rank() - 1 ) );
+  const auto r = LINALG_DETAIL::tsqr_r_factor< value_type >( rows,
+                                                             columns + rhs,
+                                                             [&]( ::std::size_t i, ::std::size_t j ) -> value_type
+                                                             {
+                                                               if ( j < columns )
+                                                               {
+                                                                 return static_cast< value_type >( LINALG_DETAIL::access( a, i, j ) );
+                                                               }
+                                                               if constexpr ( Rhs::rank() == 1 )
+                                                               {
+                                                                 return static_cast< value_type >( LINALG_DETAIL::access( b, i ) );
+                                                               }
+                                                               else
+                                                               {
+                                                                 return static_cast< value_type >( LINALG_DETAIL::access( b, i, j - columns ) );
+                                                               }
+                                                             } );
+  const auto x = LINALG_DETAIL::triangular_least_squares< value_type >( r, columns );
+  return LINALG_DETAIL::least_squares_result< value_type, Rhs::rank() >( LINALG_DETAIL::make_block( x ), columns, rhs );
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_QR_HPP
@@ -0,0 +1,396 @@
+//==================================================================================================
+//  File:       quantized.hpp
+//
+//  Summary:    This header defines affine quantized storage:
+//              LINALG::quantization_parameters< Real >
+//              LINALG::quantized_accessor< Storage, Real >
+//              LINALG::rebind_accessor< LINALG::quantized_accessor< Storage, Real >, U >
+//              LINALG::quantize( const Tensor& t, const quantization_parameters< Real >& params, Quantized& q )
+//              LINALG::dequantized( const Quantized& q, const quantization_parameters< Real >& params )
+//              LINALG::quantized_matrix_product( a, a_params, b, b_params, c, c_params )
+//
+//              A quantized value q represents the real value scale * ( q - zero_point ). Parameters
+//              are either per-tensor or per-axis, in which case each index along the axis has its own
+//              scale and zero point.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_QUANTIZED_HPP
+#define LINEAR_ALGEBRA_QUANTIZED_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_BEGIN // linalg namespace
+
+//===========================
+//  Quantization Parameters
+//===========================
+
+/// @brief Scale and zero point of an affine quantization, shared by the tensor or given per index along one axis
+template < class Real = float >
+class quantization_parameters
+{
+  public:
+    //- Types
+
+    /// @brief Type of the scale
+    using real_type       = Real;
+    /// @brief Type of the zero point
+    using zero_point_type = ::std::int32_t;
+
+    //- Constructors
+
+    /// @brief Constructs per-tensor parameters
+    /// @param scale real value of one quantization step
+    /// @param zero_point quantized value representing zero
+    quantization_parameters( real_type scale, zero_point_type zero_point = 0 ) :
+      scales_ { scale }, zero_points_ { zero_point }, axis_ { 0 }, per_axis_ { false } { }
+    /// @brief Constructs per-axis parameters
+    /// @param scales scale of each index along the axis
+    /// @param zero_points zero point of each index along the axis
+    /// @param axis dimension the parameters vary along
+    quantization_parameters( ::std::vector< real_type > scales, ::std::vector< zero_point_type > zero_points, ::std::size_t axis ) :
+      scales_ { ::std::move( scales ) }, zero_points_ { ::std::move( zero_points ) }, axis_ { axis }, per_axis_ { true }
+    {
+      if ( this->scales_.empty() || ( this->scales_.size() != this->zero_points_.size() ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Quantization parameter sizes are incompatable." );
+      }
+    }
+
+    //- Observers
+
+    /// @brief Returns true if parameters vary along an axis
+    [[nodiscard]] bool per_axis() const noexcept { return this->per_axis_; }
+    /// @brief Returns the dimension the parameters vary along
+    [[nodiscard]] ::std::size_t axis() const noexcept { return this->axis_; }
+    /// @brief Returns the scale of index n along the axis
+    [[nodiscard]] real_type scale( ::std::size_t n = 0 ) const noexcept { return this->scales_[ this->per_axis_ ? n : 0 ]; }
+    /// @brief Returns the zero point of index n along the axis
+    [[nodiscard]] zero_point_type zero_point( ::std::size_t n = 0 ) const noexcept { return this->zero_points_[ this->per_axis_ ? n : 0 ]; }
+    /// @brief Returns all scales
+    [[nodiscard]] const ::std::vector< real_type >& scales() const noexcept { return this->scales_; }
+    /// @brief Returns all zero points
+    [[nodiscard]] const ::std::vector< zero_point_type >& zero_points() const noexcept { return this->zero_points_; }
+
+    /// @brief Throws if the parameters cannot describe a tensor with the given extents
+    template < class Extents >
+    void validate( const Extents& extents ) const
+    {
+      if ( this->per_axis_ && ( ( this->axis_ >= Extents::rank() ) ||
+                                ( this->scales_.size() != static_cast< ::std::size_t >( extents.extent( this->axis_ ) ) ) ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Quantization parameter sizes are incompatable." );
+      }
+    }
+
+  private:
+    //- Data
+    ::std::vector< real_type >       scales_;
+    ::std::vector< zero_point_type > zero_points_;
+    ::std::size_t                    axis_;
+    bool                             per_axis_;
+};
+
+//======================
+//  Quantized Accessor
+//======================
+
+/// @brief Read only accessor policy which dequantizes narrow integer storage on access
+/// The scales and zero points are referenced, not owned, so must outlive the accessor.
+template < class Storage = ::std::int8_t, class Real = float >
+class quantized_accessor
+{
+  public:
+    //- Types
+
+    using offset_policy    = quantized_accessor;
+    using element_type     = const Real;
+    using reference        = Real;
+    using data_handle_type = const Storage*;
+
+    //- Constructors
+
+    constexpr quantized_accessor() noexcept = default;
+    /// @brief Constructs from the origin of the buffer and the scales and zero points along an axis
+    /// @param origin beginning of the buffer indexed by the axis
+    /// @param scales scale of each index along the axis
+    /// @param zero_points zero point of each index along the axis
+    /// @param axis_stride distance in elements between consecutive indices along the axis
+    /// @param axis_extent number of indices along the axis, one for per-tensor parameters
+    /// @param outer_stride least stride of the dimensions enclosing the axis, zero if there are none
+    constexpr quantized_accessor( data_handle_type      origin,
+                                  const Real*           scales,
+                                  const ::std::int32_t* zero_points,
+                                  ::std::size_t         axis_stride  = 1,
+                                  ::std::size_t         axis_extent  = 1,
+                                  ::std::size_t         outer_stride = 0 ) noexcept :
+      origin_ { origin }, scales_ { scales }, zero_points_ { zero_points }, axis_stride_ { axis_stride }, axis_extent_ { axis_extent },
+      outer_stride_ { outer_stride } { }
+
+    //- Access
+
+    [[nodiscard]] constexpr reference access( data_handle_type p, ::std::size_t i ) const noexcept
+    {
+      // Offsets are measured from the origin so subviews index the same parameters. The enclosing
+      // dimensions are removed by the outer stride, so padding between them is never counted.
+      const ::std::size_t offset = static_cast< ::std::size_t >( p - this->origin_ ) + i;
+      const ::std::size_t n      = ( this->axis_extent_ == 1 ) ? 0 :
+                                   ( ( this->outer_stride_ == 0 ) ? offset : offset % this->outer_stride_ ) / this->axis_stride_;
+      return this->scales_[n] * ( static_cast< Real >( p[i] ) - static_cast< Real >( this->zero_points_[n] ) );
+    }
+    [[nodiscard]] constexpr data_handle_type offset( data_handle_type p, ::std::size_t i ) const noexcept
+    {
+      return p + i;
+    }
+
+  private:
+    //- Data
+    data_handle_type      origin_       = nullptr;
+    const Real*           scales_       = nullptr;
+    const ::std::int32_t* zero_points_  = nullptr;
+    ::std::size_t         axis_stride_  = 1;
+    ::std::size_t         axis_extent_  = 1;
+    ::std::size_t         outer_stride_ = 0;
+};
+
+// Expressions of dequantized views evaluate into ordinary storage
+template < class Storage, class Real, class U >
+struct rebind_accessor< quantized_accessor< Storage, Real >, U >
+{
+  using type = ::std::default_accessor< U >;
+};
+
+//============
+//  Quantize
+//============
+
+/// @brief Quantizes each element of a tensor, rounding to nearest and saturating to the storage range
+/// @tparam Tensor tensor expression of real values
+/// @tparam Real type of the scales
+/// @tparam Quantized writable tensor of integral values
+/// @param t tensor to be quantized
+/// @param params quantization parameters
+/// @param q tensor to be overwritten with quantized values
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Tensor, class Real, class Quantized >
+  requires ( LINALG_CONCEPTS::tensor_expression< Tensor > &&
+             LINALG_CONCEPTS::writable_tensor< Quantized > &&
+             ::std::is_integral_v< typename Quantized::value_type > &&
+             ( Tensor::rank() == Quantized::rank() ) )
+#else
+template < class Tensor, class Real, class Quantized,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Tensor > &&
+                                          LINALG_CONCEPTS::writable_tensor_v< Quantized > &&
+                                          ::std::is_integral_v< typename Quantized::value_type > &&
+                                          ( Tensor::rank() == Quantized::rank() ) > >
+#endif
+void quantize( const Tensor& t, const quantization_parameters< Real >& params, Quantized& q )
+{
+  using index_type   = typename Quantized::index_type;
+  using storage_type = typename Quantized::value_type;
+  for ( typename Quantized::rank_type dim = 0; dim < Quantized::rank(); ++dim )
+  {
+    if ( static_cast< index_type >( t.extent( dim ) ) != q.extent( dim ) ) LINALG_UNLIKELY
+    {
+      throw ::std::length_error( "Tensor extents are incompatable." );
+    }
+  }
+  params.validate( q.extents() );
+  constexpr Real lowest  = static_cast< Real >( ::std::numeric_limits< storage_type >::lowest() );
+  constexpr Real highest = static_cast< Real >( ::std::numeric_limits< storage_type >::max() );
+  LINALG_DETAIL::apply_all( q,
+                            [&t,&params,&q]( auto ... indices ) noexcept
+                            {
+                              const ::std::array< index_type, sizeof...( indices ) > index { static_cast< index_type >( indices ) ... };
+                              const ::std::size_t n     = params.per_axis() ? static_cast< ::std::size_t >( index[ params.axis() ] ) : 0;
+                              const Real          value = ::std::nearbyint( static_cast< Real >( LINALG_DETAIL::access( t, indices ... ) ) / params.scale( n ) ) +
+                                                          static_cast< Real >( params.zero_point( n ) );
+                              LINALG_DETAIL::access( q, indices ... ) = static_cast< storage_type >( ::std::clamp( value, lowest, highest ) );
+                            },
+                            LINALG_EXECUTION_UNSEQ );
+}
+
+//===============
+//  Dequantized
+//===============
+
+/// @brief Returns a view of quantized storage which dequantizes each element on access
+/// @tparam Quantized readable tensor of integral values using the default accessor
+/// @tparam Real type of the scales
+/// @param q quantized storage
+/// @param params quantization parameters, which must outlive the view
+/// @return read only tensor view of real values usable in any tensor expression
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Quantized, class Real >
+  requires ( LINALG_CONCEPTS::readable_tensor< Quantized > &&
+             ::std::is_integral_v< typename Quantized::value_type > &&
+             LINALG_DETAIL::is_default_accessor_v< typename Quantized::accessor_type > )
+#else
+template < class Quantized, class Real,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::readable_tensor_v< Quantized > &&
+                                          ::std::is_integral_v< typename Quantized::value_type > &&
+                                          LINALG_DETAIL::is_default_accessor_v< typename Quantized::accessor_type > > >
+#endif
+[[nodiscard]] auto dequantized( const Quantized& q, const quantization_parameters< Real >& params )
+{
+  using mapping_type  = typename Quantized::mapping_type;
+  using accessor_type = quantized_accessor< typename Quantized::value_type, Real >;
+  using view_type     = ::std::experimental::mdspan< const Real, typename mapping_type::extents_type, typename mapping_type::layout_type, accessor_type >;
+  params.validate( q.extents() );
+  const ::std::size_t axis_stride  = params.per_axis() ? static_cast< ::std::size_t >( q.stride( params.axis() ) ) : 1;
+  const ::std::size_t axis_extent  = params.per_axis() ? static_cast< ::std::size_t >( q.extent( params.axis() ) ) : 1;
+  ::std::size_t       outer_stride = 0;
+  if ( axis_extent > 1 )
+  {
+    // The axis index is recovered from an offset of the mapping as ( offset % outer_stride ) / axis_stride,
+    // which requires the enclosing strides be multiples of the least of them and the inner dimensions
+    // span less than one step along the axis, as for row major, column major and padded layouts
+    ::std::size_t inner_span = 0;
+    for ( typename Quantized::rank_type dim = 0; dim < Quantized::rank(); ++dim )
+    {
+      const ::std::size_t stride = static_cast< ::std::size_t >( q.stride( dim ) );
+      if ( ( dim == params.axis() ) || ( q.extent( dim ) <= 1 ) )
+      {
+        continue;
+      }
+      if ( stride > axis_stride )
+      {
+        outer_stride = ( outer_stride == 0 ) ? stride : ::std::min( outer_stride, stride );
+      }
+      else
+      {
+        inner_span += static_cast< ::std::size_t >( q.extent( dim ) - 1 ) * stride;
+      }
+    }
+    bool decodable = ( inner_span < axis_stride ) && ( ( outer_stride == 0 ) || ( ( axis_extent - 1 ) * axis_stride + inner_span < outer_stride ) );
+    for ( typename Quantized::rank_type dim = 0; dim < Quantized::rank(); ++dim )
+    {
+      const ::std::size_t stride = static_cast< ::std::size_t >( q.stride( dim ) );
+      if ( ( dim != params.axis() ) && ( q.extent( dim ) > 1 ) && ( stride > axis_stride ) && ( stride % outer_stride != 0 ) )
+      {
+        decodable = false;
+      }
+    }
+    if ( !decodable ) LINALG_UNLIKELY
+    {
+      throw ::std::invalid_argument( "Layout is incompatable with per-axis quantization." );
+    }
+  }
+  return view_type( q.data_handle(),
+                    q.mapping(),
+                    accessor_type( q.data_handle(), params.scales().data(), params.zero_points().data(), axis_stride, axis_extent, outer_stride ) );
+}
+
+//============================
+//  Quantized Matrix Product
+//============================
+
+/// @brief Computes c = a * b entirely on quantized storage with requantization of the result
+/// @tparam MatrixA readable 8 bit integral matrix, per-tensor or per-row (axis 0) parameters
+/// @tparam MatrixB readable 8 bit integral matrix, per-tensor or per-column (axis 1) parameters
+/// @tparam MatrixC writable integral matrix, per-tensor parameters
+/// Products are accumulated exactly in 32 bit integers with the zero points factored out of the
+/// inner loop, so the inner loop is a contiguous narrow integer dot product. The zero point
+/// correction is applied in 64 bit integers.
+/// @throw length_error if the extents are incompatable, or the inner extent is too large for the
+///        dot products to be exact in 32 bit integers
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class MatrixA, class MatrixB, class MatrixC, class Real >
+  requires ( LINALG_CONCEPTS::matrix_expression< MatrixA > &&
+             LINALG_CONCEPTS::matrix_expression< MatrixB > &&
+             LINALG_CONCEPTS::writable_tensor< MatrixC > &&
+             ( MatrixC::rank() == 2 ) &&
+             ::std::is_integral_v< typename MatrixA::value_type > && ( sizeof( typename MatrixA::value_type ) == 1 ) &&
+             ::std::is_integral_v< typename MatrixB::value_type > && ( sizeof( typename MatrixB::value_type ) == 1 ) &&
+             ::std::is_integral_v< typename MatrixC::value_type > )
+#else
+template < class MatrixA, class MatrixB, class MatrixC, class Real,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< MatrixA > &&
+                                          LINALG_CONCEPTS::matrix_expression_v< MatrixB > &&
+                                          LINALG_CONCEPTS::writable_tensor_v< MatrixC > &&
+                                          ( MatrixC::rank() == 2 ) &&
+                                          ::std::is_integral_v< typename MatrixA::value_type > && ( sizeof( typename MatrixA::value_type ) == 1 ) &&
+                                          ::std::is_integral_v< typename MatrixB::value_type > && ( sizeof( typename MatrixB::value_type ) == 1 ) &&
+                                          ::std::is_integral_v< typename MatrixC::value_type > > >
+#endif
+void quantized_matrix_product( const MatrixA&                         a,
+                               const quantization_parameters< Real >& a_params,
+                               const MatrixB&                         b,
+                               const quantization_parameters< Real >& b_params,
+                               MatrixC&                               c,
+                               const quantization_parameters< Real >& c_params )
+{
+  using index_type       = typename MatrixC::index_type;
+  using accumulator_type = ::std::int32_t;
+  using correction_type  = ::std::int64_t;
+  using storage_a_type   = typename MatrixA::value_type;
+  using storage_b_type   = typename MatrixB::value_type;
+  using storage_c_type   = typename MatrixC::value_type;
+  const index_type rows  = static_cast< index_type >( a.extent(0) );
+  const index_type inner = static_cast< index_type >( a.extent(1) );
+  const index_type cols  = static_cast< index_type >( b.extent(1) );
+  if ( ( static_cast< index_type >( b.extent(0) ) != inner ) || ( c.extent(0) != rows ) || ( c.extent(1) != cols ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Matrix extents are incompatable." );
+  }
+  if ( ( a_params.per_axis() && ( a_params.axis() != 0 ) ) || ( b_params.per_axis() && ( b_params.axis() != 1 ) ) || c_params.per_axis() ) LINALG_UNLIKELY
+  {
+    throw ::std::invalid_argument( "Quantization axis is incompatable with the matrix product." );
+  }
+  // Each dot product is at most inner times the largest product of two elements in magnitude
+  constexpr correction_type largest_a = ::std::max( -static_cast< correction_type >( ::std::numeric_limits< storage_a_type >::lowest() ),
+                                                    static_cast< correction_type >( ::std::numeric_limits< storage_a_type >::max() ) );
+  constexpr correction_type largest_b = ::std::max( -static_cast< correction_type >( ::std::numeric_limits< storage_b_type >::lowest() ),
+                                                    static_cast< correction_type >( ::std::numeric_limits< storage_b_type >::max() ) );
+  if ( static_cast< correction_type >( inner ) > ::std::numeric_limits< accumulator_type >::max() / ( largest_a * largest_b ) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Inner extent is too large for exact accumulation." );
+  }
+  a_params.validate( a.extents() );
+  b_params.validate( b.extents() );
+  // Pack b transposed and its column sums so every dot product reads both operands contiguously
+  ::std::vector< storage_b_type >   packed_b( static_cast< ::std::size_t >( cols ) * static_cast< ::std::size_t >( inner ) );
+  ::std::vector< accumulator_type > col_sums( static_cast< ::std::size_t >( cols ), 0 );
+  for ( index_type j = 0; j < cols; ++j )
+  {
+    for ( index_type k = 0; k < inner; ++k )
+    {
+      const storage_b_type value = LINALG_DETAIL::access( b, k, j );
+      packed_b[ static_cast< ::std::size_t >( j ) * inner + k ] = value;
+      col_sums[j] += static_cast< accumulator_type >( value );
+    }
+  }
+  ::std::vector< storage_a_type > packed_a( static_cast< ::std::size_t >( inner ) );
+  constexpr Real lowest  = static_cast< Real >( ::std::numeric_limits< storage_c_type >::lowest() );
+  constexpr Real highest = static_cast< Real >( ::std::numeric_limits< storage_c_type >::max() );
+  for ( index_type i = 0; i < rows; ++i )
+  {
+    accumulator_type row_sum = 0;
+    for ( index_type k = 0; k < inner; ++k )
+    {
+      packed_a[k] = LINALG_DETAIL::access( a, i, k );
+      row_sum += static_cast< accumulator_type >( packed_a[k] );
+    }
+    const correction_type a_zero = a_params.zero_point( i );
+    for ( index_type j = 0; j < cols; ++j )
+    {
+      const storage_b_type* column = packed_b.data() + static_cast< ::std::size_t >( j ) * inner;
+      accumulator_type      dot    = 0;
+      for ( index_type k = 0; k < inner; ++k )
+      {
+        dot += static_cast< accumulator_type >( packed_a[k] ) * static_cast< accumulator_type >( column[k] );
+      }
+      // sum( ( a - za ) * ( b - zb ) ) expanded so the zero points are applied once per output
+      const correction_type b_zero = b_params.zero_point( j );
+      const correction_type exact  = dot - b_zero * row_sum - a_zero * col_sums[j] + static_cast< correction_type >( inner ) * a_zero * b_zero;
+      // Requantize
+      const Real multiplier = a_params.scale( i ) * b_params.scale( j ) / c_params.scale();
+      const Real value      = ::std::nearbyint( multiplier * static_cast< Real >( exact ) ) + static_cast< Real >( c_params.zero_point() );
+      LINALG_DETAIL::access( c, i, j ) = static_cast< storage_c_type >( ::std::clamp( value, lowest, highest ) );
+    }
+  }
+}
+
+LINALG_END // linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_QUANTIZED_HPP
@@ -0,0 +1,225 @@
+//==================================================================================================
+//  File:       randomized_svd.hpp
+//
+//  Summary:    This header defines the randomized range finder and singular value decomposition of
+//              Halko, Martinsson and Tropp for matrices of low numerical rank:
+//              randomized_range( const Matrix& a, columns[, power_iterations[, seed]] )
+//              randomized_svd( const Matrix& a, rank[, oversampling[, power_iterations[, seed]]] )
+//
+//              A is only read through the thin products A X and A^T Y, taken by the packed parallel
+//              product kernel, so it may be any matrix expression, lazy ones included, and is never
+//              copied or factored. A matrix-free A is given as an adjoint_linear_operator, whose
+//              callables take the two products instead. Its range is sampled by A Omega for a
+//              Gaussian Omega filled from a seed, each tile of rows drawing from its own engine so
+//              the samples do not depend on the number of threads. Power iterations
+//              ( A A^T )^q A Omega sharpen slowly decaying spectra and the basis is orthonormalized
+//              after every product so the small singular values are not lost to rounding. The SVD
+//              of the small B = Q^T A then gives the leading triplets.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_RANDOMIZED_SVD_HPP
+#define LINEAR_ALGEBRA_RANDOMIZED_SVD_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//-----------------------
+//  Randomized Sampling
+//-----------------------
+
+// Samples taken beyond the requested rank by default
+inline constexpr ::std::size_t randomized_oversampling = 10;
+
+// Products with A A^T taken by default to sharpen the sampled range
+inline constexpr ::std::size_t randomized_power_iterations = 2;
+
+/// @brief Fills omega with standard normal samples, each tile of rows drawing from an engine seeded by seed and the tile
+template < class T >
+void gaussian_fill( LINALG::dyn_tensor< T, 2 >& omega, ::std::uint64_t seed )
+{
+  const ::std::size_t rows    = static_cast< ::std::size_t >( omega.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( omega.extent(1) );
+  for_each_row_tile( 0, rows, rows * columns, [&]( ::std::size_t first, ::std::size_t last )
+  {
+    const ::std::uint32_t           tile = static_cast< ::std::uint32_t >( first / parallel_tile_extent );
+    ::std::seed_seq                 seeds { static_cast< ::std::uint32_t >( seed ), static_cast< ::std::uint32_t >( seed >> 32 ), tile };
+    ::std::mt19937_64               engine( seeds );
+    ::std::normal_distribution< T > normal;
+    for ( ::std::size_t i = first; i < last; ++i )
+    {
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        LINALG_DETAIL::access( omega, i, j ) = normal( engine );
+      }
+    }
+  } );
+}
+
+/// @brief Returns a * x, or trans( a ) * x if Adjoint, with the packed parallel product kernel, or through
+///        the products of an adjoint linear operator
+template < bool Adjoint, class T, class Matrix >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > operator_product( const Matrix& a, const LINALG::dyn_tensor< T, 2 >& x )
+{
+  using matrix_type  = LINALG::dyn_tensor< T, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  const ::std::size_t rows    = static_cast< ::std::size_t >( a.extent( Adjoint ? 1 : 0 ) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( x.extent(1) );
+  matrix_type result( extents_type( rows, columns ) );
+  if constexpr ( LINALG::is_adjoint_linear_operator_v< Matrix > )
+  {
+    if constexpr ( Adjoint )
+    {
+      a.apply_adjoint( x, result );
+    }
+    else
+    {
+      a.apply( x, result );
+    }
+  }
+  else
+  {
+    // The thin products are too narrow for the assignment threshold but still worth a packed x and parallel tiles
+    const ::std::size_t              workers   = ::std::max( ::std::size_t( ::std::thread::hardware_concurrency() ), ::std::size_t( 1 ) );
+    const parallel_product_partition partition = partition_product( rows, columns, static_cast< ::std::size_t >( x.extent(0) ), workers );
+    if constexpr ( Adjoint )
+    {
+      parallel_matrix_product< T >( result, LINALG::trans( a ) * x, partition );
+    }
+    else
+    {
+      parallel_matrix_product< T >( result, a * x, partition );
+    }
+  }
+  return result;
+}
+
+/// @brief Replaces y, with at least as many rows as columns, by an orthonormal basis of its columns
+template < class T >
+void orthonormalize( LINALG::dyn_tensor< T, 2 >& y )
+{
+  using matrix_type  = LINALG::dyn_tensor< T, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  const ::std::size_t rows    = static_cast< ::std::size_t >( y.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( y.extent(1) );
+  ::std::vector< T > tau( columns );
+  blocked_qr( y, tau.data() );
+  matrix_type q( extents_type( rows, columns ) );
+  for ( ::std::size_t i = 0; i < rows; ++i )
+  {
+    for ( ::std::size_t j = 0; j < columns; ++j )
+    {
+      LINALG_DETAIL::access( q, i, j ) = T( ( i == j ) ? 1 : 0 );
+    }
+  }
+  apply_householder_q< false >( make_block( y ), tau.data(), make_block( q ) );
+  y = ::std::move( q );
+}
+
+/// @brief Returns an orthonormal basis of the range of a sampled by columns Gaussian vectors and power_iterations
+///        products with a a^T
+template < class T, class Matrix >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > range_finder( const Matrix& a, ::std::size_t columns, ::std::size_t power_iterations, ::std::uint64_t seed )
+{
+  using matrix_type  = LINALG::dyn_tensor< T, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  matrix_type omega( extents_type( a.extent(1), columns ) );
+  gaussian_fill( omega, seed );
+  matrix_type y = operator_product< false >( a, omega );
+  orthonormalize( y );
+  for ( ::std::size_t i = 0; i < power_iterations; ++i )
+  {
+    matrix_type z = operator_product< true >( a, y );
+    orthonormalize( z );
+    y = operator_product< false >( a, z );
+    orthonormalize( y );
+  }
+  return y;
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//-------------------------------------
+//  Randomized Singular Value Solvers
+//-------------------------------------
+
+/// @brief Returns an orthonormal basis, rows x columns, approximating the range of the leading columns singular
+///        vectors of a real matrix or adjoint linear operator
+/// @param columns number of basis vectors, at most min( m, n )
+/// @param power_iterations products with A A^T sharpening the basis when the singular values decay slowly
+/// @param seed seed of the Gaussian test matrix; equal seeds give equal bases
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( ( LINALG_CONCEPTS::matrix_expression< Matrix > || LINALG::is_adjoint_linear_operator_v< Matrix > ) &&
+             ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< ( LINALG_CONCEPTS::matrix_expression_v< Matrix > || LINALG::is_adjoint_linear_operator_v< Matrix > ) &&
+                                          ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] LINALG::dyn_tensor< ::std::remove_cv_t< typename Matrix::value_type >, 2 >
+randomized_range( const Matrix& a, ::std::size_t columns, ::std::size_t power_iterations = LINALG_DETAIL::randomized_power_iterations, ::std::uint64_t seed = 0 )
+{
+  const ::std::size_t extent = ::std::min( static_cast< ::std::size_t >( a.extent(0) ), static_cast< ::std::size_t >( a.extent(1) ) );
+  return LINALG_DETAIL::range_finder< ::std::remove_cv_t< typename Matrix::value_type > >( a, ::std::min( columns, extent ), power_iterations, seed );
+}
+
+/// @brief Returns the leading rank singular triplets of a real matrix or adjoint linear operator of low numerical rank
+/// The range is sampled by rank + oversampling Gaussian vectors; the error decays with the singular values
+/// beyond them, faster with more power iterations.
+/// @param seed seed of the Gaussian test matrix; equal seeds give equal decompositions
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( ( LINALG_CONCEPTS::matrix_expression< Matrix > || LINALG::is_adjoint_linear_operator_v< Matrix > ) &&
+             ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< ( LINALG_CONCEPTS::matrix_expression_v< Matrix > || LINALG::is_adjoint_linear_operator_v< Matrix > ) &&
+                                          ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] singular_value_decomposition< Matrix >
+randomized_svd( const Matrix& a, ::std::size_t rank, ::std::size_t oversampling = LINALG_DETAIL::randomized_oversampling,
+                ::std::size_t power_iterations = LINALG_DETAIL::randomized_power_iterations, ::std::uint64_t seed = 0 )
+{
+  using value_type   = ::std::remove_cv_t< typename Matrix::value_type >;
+  using matrix_type  = LINALG::dyn_tensor< value_type, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  using values_type  = LINALG::dyn_tensor< value_type, 1 >;
+  const ::std::size_t rows    = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( a.extent(1) );
+  const ::std::size_t extent  = ::std::min( rows, columns );
+  const ::std::size_t samples = ::std::min( rank + oversampling, extent );
+  rank = ::std::min( rank, extent );
+  values_type values { typename values_type::extents_type( rank ) };
+  matrix_type u( extents_type( rows, rank ) );
+  if ( samples == 0 )
+  {
+    return singular_value_decomposition< Matrix >( rows, columns, ::std::move( values ), ::std::move( u ), matrix_type( extents_type( columns, rank ) ) );
+  }
+  // A ~ Q B with B^T = A^T Q tall and skinny, so B^T = left S right^T gives A ~ ( Q right ) S left^T
+  const matrix_type           q  = LINALG_DETAIL::range_finder< value_type >( a, samples, power_iterations, seed );
+  matrix_type                 bt = LINALG_DETAIL::operator_product< true >( a, q );
+  ::std::vector< value_type > sigma( samples );
+  matrix_type                 left;
+  matrix_type                 right;
+  LINALG_DETAIL::tall_svd( bt, svd_mode::thin, svd_method::divide_and_conquer, sigma.data(), left, right );
+  for ( ::std::size_t i = 0; i < rows; ++i )
+  {
+    for ( ::std::size_t j = 0; j < rank; ++j )
+    {
+      LINALG_DETAIL::access( u, i, j ) = value_type( 0 );
+    }
+  }
+  LINALG_DETAIL::block_product_update( LINALG_DETAIL::make_block( u ), LINALG_DETAIL::make_block( q ), LINALG_DETAIL::make_block( right ).block( 0, 0, samples, rank ), value_type( 1 ) );
+  for ( ::std::size_t i = 0; i < rank; ++i )
+  {
+    LINALG_DETAIL::access( values, i ) = sigma[i];
+  }
+  return singular_value_decomposition< Matrix >( rows, columns, ::std::move( values ), ::std::move( u ), LINALG_DETAIL::leading_columns( left, rank ) );
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_RANDOMIZED_SVD_HPP
@@ -0,0 +1,443 @@
+//==================================================================================================
+//  File:       simultaneous.hpp
+//
+//  Summary:    This header defines:
+//              LINALG::pending_assignment< Tensor, Expression >
+//              LINALG::deferred_assignment< Tensor >
+//              LINALG::deferred( Tensor& t )
+//              LINALG::evaluate_all( const pending_assignment< Tensors, Expressions >& ... assignments )
+//
+//              evaluate_all( deferred( dst1 ) = expr1, deferred( dst2 ) = expr2, ... ) evaluates several
+//              assignments together. Products whose first operand is the same view, such as A * X,
+//              A * x and the inner product of ( A * XX ) * trans( A ), are evaluated a panel of rows of
+//              the shared operand at a time, so each panel is loaded once and used by every output.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_SIMULTANEOUS_HPP
+#define LINEAR_ALGEBRA_SIMULTANEOUS_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_BEGIN // linalg namespace
+
+//======================
+//  Pending Assignment
+//======================
+
+/// @brief Assignment of an expression to a tensor, evaluated when passed to evaluate_all
+/// @tparam Tensor writable tensor
+/// @tparam Expression tensor expression, which must outlive the call to evaluate_all
+template < class Tensor, class Expression >
+class pending_assignment
+{
+  public:
+    //- Constructors
+
+    /// @brief Constructs from the destination tensor and the expression assigned to it
+    constexpr pending_assignment( Tensor& t, const Expression& expr ) noexcept : t_( t ), expr_( expr ) { }
+
+    //- Accessors
+
+    /// @brief Returns the destination tensor
+    [[nodiscard]] constexpr Tensor& target() const noexcept { return this->t_; }
+    /// @brief Returns the expression assigned to the destination
+    [[nodiscard]] constexpr const Expression& expression() const noexcept { return this->expr_; }
+
+  private:
+    //- Data
+    Tensor&           t_;
+    const Expression& expr_;
+};
+
+//=======================
+//  Deferred Assignment
+//=======================
+
+/// @brief Assignment target which records the assignment rather than evaluating it
+/// @tparam Tensor writable tensor
+template < class Tensor >
+class deferred_assignment
+{
+  public:
+    //- Constructors
+
+    /// @brief Constructs from the destination tensor
+    explicit constexpr deferred_assignment( Tensor& t ) noexcept : t_( t ) { }
+
+    //- Assignment
+
+    /// @brief Returns the pending assignment of the expression to the destination
+    #ifdef LINALG_ENABLE_CONCEPTS
+    template < class Expression >
+      requires ( LINALG_CONCEPTS::tensor_expression< Expression > &&
+                 ( Expression::rank() == Tensor::rank() ) )
+    #else
+    template < class Expression,
+               typename = ::std::enable_if_t< LINALG_CONCEPTS::tensor_expression_v< Expression > &&
+                                              ( Expression::rank() == Tensor::rank() ) > >
+    #endif
+    [[nodiscard]] constexpr pending_assignment< Tensor, Expression > operator = ( const Expression& rhs ) const noexcept
+    {
+      return pending_assignment< Tensor, Expression >( this->t_, rhs );
+    }
+
+  private:
+    //- Data
+    Tensor& t_;
+};
+
+//============
+//  Deferred
+//============
+
+/// @brief Returns an assignment target whose assignments are evaluated together by evaluate_all
+/// @tparam Tensor writable tensor
+/// @param t destination tensor
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Tensor >
+  requires LINALG_CONCEPTS::writable_tensor< Tensor >
+#else
+template < class Tensor,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::writable_tensor_v< Tensor > > >
+#endif
+[[nodiscard]] constexpr deferred_assignment< Tensor > deferred( Tensor& t ) noexcept
+{
+  return deferred_assignment< Tensor >( t );
+}
+
+LINALG_END // linalg namespace
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//---------------------------
+//  Simultaneous Evaluation
+//---------------------------
+
+// Number of rows of the shared operand loaded at a time by simultaneous evaluation
+inline constexpr ::std::size_t simultaneous_panel_extent = 16;
+
+// Products evaluated by panels of rows of their first operand: a * b and a * x, and the chain
+// ( a * b ) * c of which the inner product is evaluated by panels and then multiplied by c
+template < class Expression, class = void >
+struct panel_product_traits
+{
+  static constexpr bool is_panel = false;
+  static constexpr bool is_chain = false;
+};
+
+template < class Expression >
+struct panel_product_traits< Expression, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< Expression > ||
+                                                             LINALG_EXPRESSIONS_DETAIL::is_matrix_vector_product_expression_v< Expression > > >
+{
+  static constexpr bool is_panel = true;
+  static constexpr bool is_chain = LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< Expression > &&
+                                   LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< decltype( ::std::declval< const Expression& >().first() ) >;
+};
+
+template < class Assignment >
+using assignment_expression_t = ::std::decay_t< decltype( ::std::declval< const Assignment& >().expression() ) >;
+
+template < class Assignment >
+inline constexpr bool is_panel_assignment_v = panel_product_traits< assignment_expression_t< ::std::decay_t< Assignment > > >::is_panel;
+
+// Returns the product of an assignment which is evaluated by panels
+template < class Expression >
+[[nodiscard]] constexpr decltype(auto) panel_product( const Expression& expr ) noexcept
+{
+  if constexpr ( panel_product_traits< Expression >::is_chain )
+  {
+    return expr.first();
+  }
+  else
+  {
+    return ( expr );
+  }
+}
+
+// Resizes a dynamic destination to the extents of the expression, others must match
+template < class Tensor, class Expression >
+void match_extents( Tensor& t, const Expression& expr )
+{
+  #ifdef LINALG_ENABLE_CONCEPTS
+  if constexpr ( LINALG_CONCEPTS::dynamic_tensor< Tensor > )
+  #else
+  if constexpr ( LINALG_CONCEPTS::dynamic_tensor_v< Tensor > )
+  #endif
+  {
+    if ( t.extents() != expr.extents() )
+    {
+      t.resize( expr.extents() );
+    }
+  }
+  else
+  {
+    for ( typename Tensor::rank_type dim = 0; dim < Tensor::rank(); ++dim )
+    {
+      if ( static_cast< typename Tensor::index_type >( expr.extent( dim ) ) != t.extent( dim ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Tensor extents are incompatable." );
+      }
+    }
+  }
+}
+
+// Accumulates the rows of an output belonging to the current panel of the shared operand. Assignments
+// which are not evaluated by panels, or not in the group being evaluated, have no state.
+template < class Assignment, class = void >
+class panel_state
+{
+  public:
+    constexpr panel_state( [[maybe_unused]] const Assignment& assignment, [[maybe_unused]] bool active, [[maybe_unused]] ::std::size_t panel ) noexcept { }
+    constexpr void clear() noexcept { }
+    template < class Value, class IndexType >
+    constexpr void update( [[maybe_unused]] const Value& a_rk, [[maybe_unused]] IndexType r, [[maybe_unused]] IndexType k ) noexcept { }
+    template < class IndexType >
+    constexpr void store( [[maybe_unused]] IndexType first_row, [[maybe_unused]] IndexType height ) noexcept { }
+    constexpr void finish() noexcept { }
+};
+
+template < class Assignment >
+class panel_state< Assignment, ::std::enable_if_t< is_panel_assignment_v< Assignment > > >
+{
+  private:
+    using expression_type  = assignment_expression_t< Assignment >;
+    using traits_type      = panel_product_traits< expression_type >;
+    using product_type     = ::std::decay_t< decltype( panel_product( ::std::declval< const expression_type& >() ) ) >;
+    using accumulator_type = LINALG::accumulation_result_t< product_type >;
+    using value_type       = typename product_type::value_type;
+    // The inner product of a chain is evaluated into a temporary, then multiplied by the last factor
+    struct no_temporary { };
+    using temporary_type   = ::std::conditional_t< traits_type::is_chain, LINALG::dyn_matrix< value_type >, no_temporary >;
+  public:
+    panel_state( const Assignment& assignment, bool active, ::std::size_t panel ) :
+      assignment_( assignment ),
+      active_( active ),
+      columns_( ( product_type::rank() == 1 ) ? 1 : static_cast< ::std::size_t >( panel_product( assignment.expression() ).extent( product_type::rank() - 1 ) ) ),
+      temporary_( make_temporary( assignment, active ) ),
+      buffer_( active ? panel * this->columns_ : 0 )
+    {
+      if constexpr ( !traits_type::is_chain )
+      {
+        if ( active )
+        {
+          match_extents( assignment.target(), assignment.expression() );
+        }
+      }
+    }
+    void clear()
+    {
+      ::std::fill( this->buffer_.begin(), this->buffer_.end(), accumulator_type( 0 ) );
+    }
+    // Adds the contribution of element ( r, k ) of the panel to row r of the output
+    template < class Value, class IndexType >
+    void update( const Value& a_rk, IndexType r, IndexType k )
+    {
+      if ( !this->active_ )
+      {
+        return;
+      }
+      const auto&            second = panel_product( this->assignment_.expression() ).second();
+      const accumulator_type a      = accumulator_type( a_rk );
+      accumulator_type*      row    = this->buffer_.data() + static_cast< ::std::size_t >( r ) * this->columns_;
+      if constexpr ( product_type::rank() == 1 )
+      {
+        row[0] += a * accumulator_type( LINALG_DETAIL::access( second, k ) );
+      }
+      else
+      {
+        for ( ::std::size_t j = 0; j < this->columns_; ++j )
+        {
+          row[j] += a * accumulator_type( LINALG_DETAIL::access( second, k, static_cast< IndexType >( j ) ) );
+        }
+      }
+    }
+    // Writes the rows of the output belonging to the panel
+    template < class IndexType >
+    void store( IndexType first_row, IndexType height )
+    {
+      if ( !this->active_ )
+      {
+        return;
+      }
+      auto& destination = this->destination();
+      using destination_value_type = typename ::std::decay_t< decltype( destination ) >::value_type;
+      for ( IndexType r = 0; r < height; ++r )
+      {
+        const accumulator_type* row = this->buffer_.data() + static_cast< ::std::size_t >( r ) * this->columns_;
+        if constexpr ( product_type::rank() == 1 )
+        {
+          LINALG_DETAIL::access( destination, first_row + r ) = static_cast< destination_value_type >( row[0] );
+        }
+        else
+        {
+          for ( ::std::size_t j = 0; j < this->columns_; ++j )
+          {
+            LINALG_DETAIL::access( destination, first_row + r, static_cast< IndexType >( j ) ) = static_cast< destination_value_type >( row[j] );
+          }
+        }
+      }
+    }
+    // Completes a chain once its inner product has been evaluated
+    void finish()
+    {
+      if constexpr ( traits_type::is_chain )
+      {
+        if ( this->active_ )
+        {
+          this->assignment_.target() = this->temporary_ * this->assignment_.expression().second();
+        }
+      }
+    }
+  private:
+    [[nodiscard]] static temporary_type make_temporary( const Assignment& assignment, bool active )
+    {
+      if constexpr ( traits_type::is_chain )
+      {
+        const auto& product = panel_product( assignment.expression() );
+        return temporary_type( typename temporary_type::extents_type( active ? product.extent(0) : 0, active ? product.extent(1) : 0 ) );
+      }
+      else
+      {
+        return temporary_type {};
+      }
+    }
+    [[nodiscard]] decltype(auto) destination()
+    {
+      if constexpr ( traits_type::is_chain )
+      {
+        return ( this->temporary_ );
+      }
+      else
+      {
+        return ( this->assignment_.target() );
+      }
+    }
+    //- Data
+    const Assignment&                 assignment_;
+    bool                              active_;
+    ::std::size_t                     columns_;
+    temporary_type                    temporary_;
+    ::std::vector< accumulator_type > buffer_;
+};
+
+// Evaluates an assignment as written
+template < ::std::size_t Index, class Assignments >
+void evaluate_one( const Assignments& assignments )
+{
+  const auto& assignment = ::std::get< Index >( assignments );
+  assignment.target() = assignment.expression();
+}
+
+// True if the destination of an assignment shares storage with any operand or any other destination
+template < ::std::size_t Index, class Assignments, ::std::size_t ... Indices >
+[[nodiscard]] bool target_overlaps( const Assignments& assignments, ::std::index_sequence< Indices ... > )
+{
+  const auto& t = ::std::get< Index >( assignments ).target();
+  return ( ( LINALG_DETAIL::overlaps( ::std::get< Indices >( assignments ).expression(), t ) ||
+             ( ( Index != Indices ) && LINALG_DETAIL::overlaps( ::std::get< Indices >( assignments ).target(), t ) ) ) || ... );
+}
+
+// True if both assignments are evaluated by panels of the same view
+template < ::std::size_t Leader, ::std::size_t Index, class Assignments >
+[[nodiscard]] bool shares_panel_operand( const Assignments& assignments )
+{
+  if constexpr ( is_panel_assignment_v< ::std::tuple_element_t< Index, Assignments > > )
+  {
+    return LINALG_DETAIL::is_same_view( panel_product( ::std::get< Index >( assignments ).expression() ).first(),
+                                        panel_product( ::std::get< Leader >( assignments ).expression() ).first() );
+  }
+  else
+  {
+    return false;
+  }
+}
+
+// Evaluates the member assignments a panel of rows of the shared operand at a time
+template < ::std::size_t Leader, class Assignments, ::std::size_t ... Indices >
+void evaluate_panels( const Assignments& assignments, const ::std::array< bool, sizeof...( Indices ) >& members, ::std::index_sequence< Indices ... > )
+{
+  const auto& shared = panel_product( ::std::get< Leader >( assignments ).expression() ).first();
+  using index_type = typename ::std::decay_t< decltype( shared ) >::index_type;
+  const index_type rows  = shared.extent(0);
+  const index_type inner = shared.extent(1);
+  const index_type panel = static_cast< index_type >( ::std::min( static_cast< ::std::size_t >( rows ), simultaneous_panel_extent ) );
+  ::std::tuple< panel_state< ::std::decay_t< ::std::tuple_element_t< Indices, Assignments > > > ... >
+    states { panel_state< ::std::decay_t< ::std::tuple_element_t< Indices, Assignments > > >( ::std::get< Indices >( assignments ), members[ Indices ], static_cast< ::std::size_t >( panel ) ) ... };
+  for ( index_type first_row = 0; first_row < rows; first_row += panel )
+  {
+    const index_type height = ::std::min( panel, static_cast< index_type >( rows - first_row ) );
+    ( ::std::get< Indices >( states ).clear(), ... );
+    for ( index_type k = 0; k < inner; ++k )
+    {
+      for ( index_type r = 0; r < height; ++r )
+      {
+        // Each element of the panel is loaded once for every output
+        const auto a_rk = LINALG_DETAIL::access( shared, first_row + r, k );
+        ( ::std::get< Indices >( states ).update( a_rk, r, k ), ... );
+      }
+    }
+    ( ::std::get< Indices >( states ).store( first_row, height ), ... );
+  }
+  ( ::std::get< Indices >( states ).finish(), ... );
+}
+
+// Evaluates an assignment, together with every later one sharing its panel operand
+template < ::std::size_t Leader, class Assignments, ::std::size_t ... Indices >
+void evaluate_group( const Assignments& assignments, ::std::array< bool, sizeof...( Indices ) >& done, ::std::index_sequence< Indices ... > indices )
+{
+  if ( done[ Leader ] )
+  {
+    return;
+  }
+  done[ Leader ] = true;
+  if constexpr ( is_panel_assignment_v< ::std::tuple_element_t< Leader, Assignments > > )
+  {
+    ::std::array< bool, sizeof...( Indices ) > members { ( !done[ Indices ] && shares_panel_operand< Leader, Indices >( assignments ) ) ... };
+    members[ Leader ] = true;
+    if ( ::std::count( members.begin(), members.end(), true ) > 1 )
+    {
+      evaluate_panels< Leader >( assignments, members, indices );
+      for ( ::std::size_t i = 0; i < done.size(); ++i )
+      {
+        done[i] = done[i] || members[i];
+      }
+      return;
+    }
+  }
+  evaluate_one< Leader >( assignments );
+}
+
+template < class Assignments, ::std::size_t ... Indices >
+void evaluate_all( const Assignments& assignments, ::std::index_sequence< Indices ... > indices )
+{
+  // Outputs sharing storage with an operand or another output order the assignments, so they are evaluated in turn
+  if ( ( target_overlaps< Indices >( assignments, indices ) || ... ) )
+  {
+    ( evaluate_one< Indices >( assignments ), ... );
+    return;
+  }
+  ::std::array< bool, sizeof...( Indices ) > done {};
+  ( evaluate_group< Indices >( assignments, done, indices ), ... );
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//================
+//  Evaluate All
+//================
+
+/// @brief Evaluates several assignments together, loading operands shared between them once where possible
+/// Assignments whose destination shares storage with an operand or another destination are instead
+/// evaluated in turn, in the order given.
+/// @param assignments pending assignments, created by deferred( dst ) = expr
+template < class ... Tensors, class ... Expressions >
+void evaluate_all( const pending_assignment< Tensors, Expressions >& ... assignments )
+{
+  LINALG_DETAIL::evaluate_all( ::std::forward_as_tuple( assignments ... ), ::std::index_sequence_for< Tensors ... >() );
+}
+
+LINALG_END // linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_SIMULTANEOUS_HPP
@@ -0,0 +1,1214 @@
+//==================================================================================================
+//  File:       svd.hpp
+//
+//  Summary:    This header defines the singular value decomposition and the solvers built on it:
+//              svd_mode
+//              svd_method
+//              singular_value_decomposition< Matrix >
+//              svd( const Matrix& a[, svd_mode mode[, svd_method method]] )
+//              singular_values( const Matrix& a )
+//              pinv( const Matrix& a[, tolerance] )
+//              low_rank_approximation( const Matrix& a, rank )
+//
+//              Wide matrices are decomposed through their transpose. The matrix is reduced to upper
+//              bidiagonal form B = Q^T A P by Householder reflectors from both sides, a panel of
+//              bidiagonal_block_extent columns at a time: the panel's updates are deferred and the
+//              trailing matrix is updated with one rank 2k product over tiles of rows run in parallel.
+//
+//              The singular triplets of B are found by divide and conquer: a middle row splits B into
+//              two smaller bidiagonal problems, solved recursively and in parallel for large matrices,
+//              whose merge is a rank one modification solved by its secular equation. The singular
+//              vectors of the merge come from a recomputed z, after Gu and Eisenstat, so they stay
+//              orthogonal. Problems of at most svd_leaf_extent rows are solved by one-sided Jacobi
+//              rotations, which also decompose whole matrices with svd_method::jacobi, to high relative
+//              accuracy. singular_values skips the vectors and runs QL iteration on the tridiagonal
+//              matrix [ 0 B; B^T 0 ], permuted, whose eigenvalues are the singular values and their
+//              negatives.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_SVD_HPP
+#define LINEAR_ALGEBRA_SVD_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_BEGIN // linalg namespace
+
+/// @brief Extent of the singular vectors computed
+enum class svd_mode
+{
+  thin, // min( m, n ) singular vectors on each side
+  full  // Square orthogonal U and V
+};
+
+/// @brief Algorithm computing the singular value decomposition
+enum class svd_method
+{
+  divide_and_conquer, // Bidiagonal reduction, then divide and conquer on the bidiagonal matrix
+  jacobi              // One-sided Jacobi rotations of the whole matrix, slower but accurate for tiny singular values
+};
+
+LINALG_END // end linalg namespace
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//---------------------------------
+//  Householder Bidiagonalization
+//---------------------------------
+
+// Columns reduced before the trailing matrix is updated
+inline constexpr ::std::size_t bidiagonal_block_extent = 32;
+
+// Rows of the bidiagonal matrix below which divide and conquer solves by Jacobi rotations
+inline constexpr ::std::size_t svd_leaf_extent = 32;
+
+// Sweeps of Jacobi rotations before giving up
+inline constexpr ::std::size_t jacobi_sweep_limit = 60;
+
+/// @brief Reduces a, with at least as many rows as columns, to upper bidiagonal form with diagonal d and superdiagonal e
+/// The left reflectors are left below the diagonal of a and the right ones right of the superdiagonal, with their
+/// scalar factors in tauq and taup.
+template < class T >
+void bidiagonalize( LINALG::dyn_tensor< T, 2 >& a, T* d, T* e, T* tauq, T* taup )
+{
+  const ::std::size_t m     = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t n     = static_cast< ::std::size_t >( a.extent(1) );
+  const ::std::size_t nb    = bidiagonal_block_extent;
+  const auto          block = LINALG_DETAIL::make_block( a );
+  // X and Y with A - V Y^T - X U equal to the partially reduced matrix, m x nb and n x nb row major
+  ::std::vector< T > x( m * nb ), y( n * nb ), vv( nb ), xv( nb );
+  for ( ::std::size_t j = 0; j < n; j += nb )
+  {
+    const ::std::size_t width = ::std::min( nb, n - j );
+    ::std::fill( x.begin(), x.end(), T( 0 ) );
+    ::std::fill( y.begin(), y.end(), T( 0 ) );
+    // Column k of V is 1 at row j + k over the stored column, row k of U is 1 at column j + k + 1 over the stored row
+    const auto v = [&]( ::std::size_t r, ::std::size_t k ) -> T
+    {
+      const ::std::size_t c = j + k;
+      return ( r < c ) ? T( 0 ) : ( r == c ) ? T( 1 ) : block( r, c );
+    };
+    const auto u = [&]( ::std::size_t k, ::std::size_t col ) -> T
+    {
+      const ::std::size_t r = j + k;
+      return ( col <= r ) ? T( 0 ) : ( col == r + 1 ) ? T( 1 ) : block( r, col );
+    };
+    for ( ::std::size_t i = 0; i < width; ++i )
+    {
+      const ::std::size_t c = j + i;
+      // Apply the updates deferred by the panel to column c and reflect it
+      for ( ::std::size_t r = c; r < m; ++r )
+      {
+        T sum = T( 0 );
+        for ( ::std::size_t k = 0; k < i; ++k )
+        {
+          sum += v( r, k ) * y[ c * nb + k ] + x[ r * nb + k ] * u( k, c );
+        }
+        block( r, c ) -= sum;
+      }
+      tauq[c] = householder_reflector( block.block( c, c, m - c, 1 ) );
+      d[c]    = block( c, c );
+      if ( c + 1 == n )
+      {
+        break;
+      }
+      // y = tauq ( A - V Y^T - X U )^T v over the trailing columns
+      for ( ::std::size_t k = 0; k < i; ++k )
+      {
+        vv[k] = T( 0 );
+        xv[k] = T( 0 );
+        for ( ::std::size_t r = c; r < m; ++r )
+        {
+          vv[k] += v( r, k ) * v( r, i );
+          xv[k] += x[ r * nb + k ] * v( r, i );
+        }
+      }
+      for_each_row_tile( c + 1, n, ( m - c ) * ( n - c ), [&]( ::std::size_t first, ::std::size_t last )
+      {
+        for ( ::std::size_t col = first; col < last; ++col )
+        {
+          T sum = T( 0 );
+          for ( ::std::size_t r = c; r < m; ++r )
+          {
+            sum += block( r, col ) * v( r, i );
+          }
+          for ( ::std::size_t k = 0; k < i; ++k )
+          {
+            sum -= y[ col * nb + k ] * vv[k] + u( k, col ) * xv[k];
+          }
+          y[ col * nb + i ] = tauq[c] * sum;
+        }
+      } );
+      // Apply the updates, including the new left reflector, to row c and reflect it
+      LINALG::dyn_tensor< T, 1 > row( typename LINALG::dyn_tensor< T, 1 >::extents_type( n - c - 1 ) );
+      for ( ::std::size_t col = c + 1; col < n; ++col )
+      {
+        T sum = y[ col * nb + i ];
+        for ( ::std::size_t k = 0; k < i; ++k )
+        {
+          sum += v( c, k ) * y[ col * nb + k ] + x[ c * nb + k ] * u( k, col );
+        }
+        LINALG_DETAIL::access( row, col - c - 1 ) = block( c, col ) - sum;
+      }
+      taup[c] = householder_reflector( LINALG_DETAIL::make_block( row ) );
+      for ( ::std::size_t col = c + 1; col < n; ++col )
+      {
+        block( c, col ) = LINALG_DETAIL::access( row, col - c - 1 );
+      }
+      e[c] = block( c, c + 1 );
+      // x = taup ( A - V Y^T - X U ) u over the trailing rows
+      for ( ::std::size_t k = 0; k <= i; ++k )
+      {
+        vv[k] = T( 0 );
+        for ( ::std::size_t col = c + 1; col < n; ++col )
+        {
+          vv[k] += y[ col * nb + k ] * u( i, col );
+        }
+      }
+      for ( ::std::size_t k = 0; k < i; ++k )
+      {
+        xv[k] = T( 0 );
+        for ( ::std::size_t col = c + 1; col < n; ++col )
+        {
+          xv[k] += u( k, col ) * u( i, col );
+        }
+      }
+      for_each_row_tile( c + 1, m, ( m - c ) * ( n - c ), [&]( ::std::size_t first, ::std::size_t last )
+      {
+        for ( ::std::size_t r = first; r < last; ++r )
+        {
+          T sum = T( 0 );
+          for ( ::std::size_t col = c + 1; col < n; ++col )
+          {
+            sum += block( r, col ) * u( i, col );
+          }
+          for ( ::std::size_t k = 0; k <= i; ++k )
+          {
+            sum -= v( r, k ) * vv[k];
+          }
+          for ( ::std::size_t k = 0; k < i; ++k )
+          {
+            sum -= x[ r * nb + k ] * xv[k];
+          }
+          x[ r * nb + i ] = taup[c] * sum;
+        }
+      } );
+    }
+    // Trailing matrix update A -= V Y^T + X U
+    const ::std::size_t first_column = j + width;
+    for_each_row_tile( first_column, m, ( m - first_column ) * ( n - first_column ) * width, [&]( ::std::size_t first, ::std::size_t last )
+    {
+      for ( ::std::size_t r = first; r < last; ++r )
+      {
+        for ( ::std::size_t col = first_column; col < n; ++col )
+        {
+          T sum = T( 0 );
+          for ( ::std::size_t k = 0; k < width; ++k )
+          {
+            sum += v( r, k ) * y[ col * nb + k ] + x[ r * nb + k ] * u( k, col );
+          }
+          block( r, col ) -= sum;
+        }
+      }
+    } );
+  }
+}
+
+//--------------------
+//  Jacobi Rotations
+//--------------------
+
+/// @brief Orthogonalizes the columns of a by one-sided Jacobi rotations, accumulating them in v
+/// On return a holds A V, whose column norms are the singular values. Columns too small to be told from
+/// rounding noise are left alone.
+/// @throw domain_error if the rotations do not converge
+template < class T >
+void one_sided_jacobi( LINALG::dyn_tensor< T, 2 >& a, LINALG::dyn_tensor< T, 2 >& v )
+{
+  const ::std::size_t rows    = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( a.extent(1) );
+  const T             eps     = ::std::numeric_limits< T >::epsilon();
+  const T             tol     = ::std::sqrt( static_cast< T >( rows ) ) * eps;
+  const T             tiny    = ::std::numeric_limits< T >::min() / eps;
+  v = identity_matrix< T >( columns );
+  for ( ::std::size_t sweep = 0; sweep < jacobi_sweep_limit; ++sweep )
+  {
+    bool rotated = false;
+    for ( ::std::size_t p = 0; p < columns; ++p )
+    {
+      for ( ::std::size_t q = p + 1; q < columns; ++q )
+      {
+        T alpha = T( 0 );
+        T beta  = T( 0 );
+        T gamma = T( 0 );
+        for ( ::std::size_t i = 0; i < rows; ++i )
+        {
+          const T a_p = LINALG_DETAIL::access( a, i, p );
+          const T a_q = LINALG_DETAIL::access( a, i, q );
+          alpha += a_p * a_p;
+          beta  += a_q * a_q;
+          gamma += a_p * a_q;
+        }
+        if ( ( alpha <= tiny ) || ( beta <= tiny ) || ( ::std::abs( gamma ) <= tol * ::std::sqrt( alpha ) * ::std::sqrt( beta ) ) )
+        {
+          continue;
+        }
+        rotated = true;
+        // Rotation making columns p and q orthogonal, with the smaller angle
+        const T zeta = ( beta - alpha ) / ( T( 2 ) * gamma );
+        const T t    = ::std::copysign( T( 1 ), zeta ) / ( ::std::abs( zeta ) + ::std::sqrt( T( 1 ) + zeta * zeta ) );
+        const T c    = T( 1 ) / ::std::sqrt( T( 1 ) + t * t );
+        const T s    = c * t;
+        for ( ::std::size_t i = 0; i < rows; ++i )
+        {
+          const T a_p = LINALG_DETAIL::access( a, i, p );
+          const T a_q = LINALG_DETAIL::access( a, i, q );
+          LINALG_DETAIL::access( a, i, p ) = c * a_p - s * a_q;
+          LINALG_DETAIL::access( a, i, q ) = s * a_p + c * a_q;
+        }
+        for ( ::std::size_t i = 0; i < columns; ++i )
+        {
+          const T v_p = LINALG_DETAIL::access( v, i, p );
+          const T v_q = LINALG_DETAIL::access( v, i, q );
+          LINALG_DETAIL::access( v, i, p ) = c * v_p - s * v_q;
+          LINALG_DETAIL::access( v, i, q ) = s * v_p + c * v_q;
+        }
+      }
+    }
+    if ( !rotated )
+    {
+      return;
+    }
+  }
+  throw ::std::domain_error( "Singular value iteration did not converge." );
+}
+
+/// @brief Returns the Euclidean norms of the columns of a
+template < class T >
+[[nodiscard]] ::std::vector< T > column_norms( const LINALG::dyn_tensor< T, 2 >& a )
+{
+  ::std::vector< T > norms( static_cast< ::std::size_t >( a.extent(1) ), T( 0 ) );
+  for ( ::std::size_t j = 0; j < norms.size(); ++j )
+  {
+    for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( a.extent(0) ); ++i )
+    {
+      norms[j] += LINALG_DETAIL::access( a, i, j ) * LINALG_DETAIL::access( a, i, j );
+    }
+    norms[j] = ::std::sqrt( norms[j] );
+  }
+  return norms;
+}
+
+/// @brief Scales a so its largest element is one, returning the factor to undo it, or one for a zero matrix
+template < class T >
+[[nodiscard]] T normalize_matrix( LINALG::dyn_tensor< T, 2 >& a )
+{
+  T scale = T( 0 );
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( a.extent(0) ); ++i )
+  {
+    for ( ::std::size_t j = 0; j < static_cast< ::std::size_t >( a.extent(1) ); ++j )
+    {
+      scale = ::std::max( scale, ::std::abs( LINALG_DETAIL::access( a, i, j ) ) );
+    }
+  }
+  if ( scale == T( 0 ) )
+  {
+    return T( 1 );
+  }
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( a.extent(0) ); ++i )
+  {
+    for ( ::std::size_t j = 0; j < static_cast< ::std::size_t >( a.extent(1) ); ++j )
+    {
+      LINALG_DETAIL::access( a, i, j ) /= scale;
+    }
+  }
+  return scale;
+}
+
+/// @brief Returns the given number of orthonormal columns: the valid columns of basis, in place, and the others
+/// replaced by an orthonormal completion from the Householder factorization of the valid ones
+template < class T >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > orthonormal_completion( const LINALG::dyn_tensor< T, 2 >& basis, const ::std::vector< bool >& valid, ::std::size_t columns )
+{
+  using matrix_type  = LINALG::dyn_tensor< T, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  const ::std::size_t rows  = static_cast< ::std::size_t >( basis.extent(0) );
+  const ::std::size_t count = static_cast< ::std::size_t >( basis.extent(1) );
+  ::std::vector< ::std::size_t > kept;
+  for ( ::std::size_t j = 0; j < ::std::min( count, columns ); ++j )
+  {
+    if ( valid[j] )
+    {
+      kept.push_back( j );
+    }
+  }
+  const ::std::size_t missing = columns - kept.size();
+  // Columns of Q after the valid ones are orthogonal to them
+  matrix_type completion( extents_type( rows, missing ) );
+  for ( ::std::size_t i = 0; i < rows; ++i )
+  {
+    for ( ::std::size_t j = 0; j < missing; ++j )
+    {
+      LINALG_DETAIL::access( completion, i, j ) = T( ( i == kept.size() + j ) ? 1 : 0 );
+    }
+  }
+  if ( !kept.empty() && ( missing > 0 ) )
+  {
+    matrix_type factors( extents_type( rows, kept.size() ) );
+    for ( ::std::size_t i = 0; i < rows; ++i )
+    {
+      for ( ::std::size_t j = 0; j < kept.size(); ++j )
+      {
+        LINALG_DETAIL::access( factors, i, j ) = LINALG_DETAIL::access( basis, i, kept[j] );
+      }
+    }
+    ::std::vector< T > tau( kept.size() );
+    blocked_qr( factors, tau.data() );
+    apply_householder_q< false >( LINALG_DETAIL::make_block( factors ), tau.data(), LINALG_DETAIL::make_block( completion ) );
+  }
+  matrix_type result( extents_type( rows, columns ) );
+  ::std::size_t next = 0;
+  for ( ::std::size_t j = 0; j < columns; ++j )
+  {
+    const bool keep = ( j < count ) && valid[j];
+    for ( ::std::size_t i = 0; i < rows; ++i )
+    {
+      LINALG_DETAIL::access( result, i, j ) = keep ? LINALG_DETAIL::access( basis, i, j ) : LINALG_DETAIL::access( completion, i, next );
+    }
+    next += keep ? 0 : 1;
+  }
+  return result;
+}
+
+/// @brief Singular value decomposition of a by Jacobi rotations, with the singular values in descending order
+/// Columns of u are computed for the singular values of the given order, completed to an orthonormal basis.
+template < class T >
+void jacobi_svd( LINALG::dyn_tensor< T, 2 >& a, ::std::size_t order, T* sigma, LINALG::dyn_tensor< T, 2 >& u, LINALG::dyn_tensor< T, 2 >& v )
+{
+  const ::std::size_t rows    = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( a.extent(1) );
+  const T             scale   = normalize_matrix( a );
+  LINALG::dyn_tensor< T, 2 > w;
+  one_sided_jacobi( a, w );
+  const auto norms = column_norms( a );
+  ::std::vector< ::std::size_t > sorted( columns );
+  ::std::iota( sorted.begin(), sorted.end(), ::std::size_t( 0 ) );
+  ::std::stable_sort( sorted.begin(), sorted.end(), [&]( ::std::size_t x, ::std::size_t y ) { return norms[x] > norms[y]; } );
+  const ::std::size_t        count = ::std::min( rows, columns );
+  LINALG::dyn_tensor< T, 2 > basis( typename LINALG::dyn_tensor< T, 2 >::extents_type( rows, count ) );
+  ::std::vector< bool >      valid( count );
+  v = LINALG::dyn_tensor< T, 2 >( typename LINALG::dyn_tensor< T, 2 >::extents_type( columns, columns ) );
+  for ( ::std::size_t j = 0; j < columns; ++j )
+  {
+    const ::std::size_t source = sorted[j];
+    for ( ::std::size_t i = 0; i < columns; ++i )
+    {
+      LINALG_DETAIL::access( v, i, j ) = LINALG_DETAIL::access( w, i, source );
+    }
+    if ( j < count )
+    {
+      sigma[j] = norms[ source ] * scale;
+      valid[j] = norms[ source ] * norms[ source ] > ::std::numeric_limits< T >::min() / ::std::numeric_limits< T >::epsilon();
+      for ( ::std::size_t i = 0; i < rows; ++i )
+      {
+        LINALG_DETAIL::access( basis, i, j ) = valid[j] ? LINALG_DETAIL::access( a, i, source ) / norms[ source ] : T( 0 );
+      }
+    }
+  }
+  u = orthonormal_completion( basis, valid, order );
+}
+
+//---------------------------------
+//  Bidiagonal Divide and Conquer
+//---------------------------------
+
+/// @brief Dense n x ( n + extra ) upper bidiagonal matrix with diagonal d and superdiagonal e
+template < class T >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > bidiagonal_matrix( const T* d, const T* e, ::std::size_t n, ::std::size_t extra )
+{
+  LINALG::dyn_tensor< T, 2 > b( typename LINALG::dyn_tensor< T, 2 >::extents_type( n, n + extra ) );
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    for ( ::std::size_t j = 0; j < n + extra; ++j )
+    {
+      LINALG_DETAIL::access( b, i, j ) = ( j == i ) ? d[i] : ( j == i + 1 ) ? e[i] : T( 0 );
+    }
+  }
+  return b;
+}
+
+/// @brief Singular value decomposition of the n x ( n + extra ) upper bidiagonal matrix with diagonal d and superdiagonal e
+/// sigma receives the singular values in ascending order, u the n x n left singular vectors and v the right ones,
+/// square, with the null vector last when extra is one.
+template < class T >
+void bidiagonal_divide_and_conquer( const T* d, const T* e, ::std::size_t n, ::std::size_t extra, T* sigma, LINALG::dyn_tensor< T, 2 >& u, LINALG::dyn_tensor< T, 2 >& v )
+{
+  using matrix_type  = LINALG::dyn_tensor< T, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  const ::std::size_t columns = n + extra;
+  if ( n <= svd_leaf_extent )
+  {
+    // Jacobi rotations sort descending, so with an extra column its null vector comes last already
+    auto b = bidiagonal_matrix( d, e, n, extra );
+    jacobi_svd( b, n, sigma, u, v );
+    ::std::reverse( sigma, sigma + n );
+    for ( ::std::size_t j = 0; j < n / 2; ++j )
+    {
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        ::std::swap( LINALG_DETAIL::access( u, i, j ), LINALG_DETAIL::access( u, i, n - 1 - j ) );
+      }
+      for ( ::std::size_t i = 0; i < columns; ++i )
+      {
+        ::std::swap( LINALG_DETAIL::access( v, i, j ), LINALG_DETAIL::access( v, i, n - 1 - j ) );
+      }
+    }
+    return;
+  }
+  // Row r couples B1, rows before it with one extra column, to B2, the rows after it
+  const ::std::size_t r        = n / 2;
+  const ::std::size_t n2       = n - r - 1;
+  const ::std::size_t columns2 = n2 + extra;
+  const T             alpha    = d[r];
+  const T             beta     = e[r];
+  ::std::vector< T >  sigma1( r ), sigma2( n2 );
+  matrix_type         u1, v1, u2, v2;
+  const ::std::size_t parts[2] = { 0, 1 };
+  // Cache the last exception to be thrown, a Jacobi leaf which does not converge or a failed allocation
+  ::std::exception_ptr eptr;
+  const auto solve_half = [&]( ::std::size_t part ) noexcept
+  {
+    try
+    {
+      if ( part == 0 )
+      {
+        bidiagonal_divide_and_conquer( d, e, r, 1, sigma1.data(), u1, v1 );
+      }
+      else
+      {
+        bidiagonal_divide_and_conquer( d + r + 1, e + r + 1, n2, extra, sigma2.data(), u2, v2 );
+      }
+    }
+    catch ( ... ) { eptr = ::std::current_exception(); }
+  };
+  if ( n * n * n < parallel_product_threshold )
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_SEQ, ::std::begin( parts ), ::std::end( parts ), solve_half );
+  }
+  else
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR, ::std::begin( parts ), ::std::end( parts ), solve_half );
+  }
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+  // Bases with B v_k = z_k e_r + s_k u_k: item 0 pairs the null vectors of the halves with s_0 = 0 and u_0 = e_r
+  matrix_type        vw( extents_type( columns, columns ) );
+  matrix_type        uw( extents_type( n, n ) );
+  ::std::vector< T > s( n ), z( n );
+  for ( ::std::size_t i = 0; i < columns; ++i )
+  {
+    for ( ::std::size_t j = 0; j < columns; ++j )
+    {
+      LINALG_DETAIL::access( vw, i, j ) = T( 0 );
+    }
+  }
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    for ( ::std::size_t j = 0; j < n; ++j )
+    {
+      LINALG_DETAIL::access( uw, i, j ) = T( 0 );
+    }
+  }
+  const T z_1 = alpha * LINALG_DETAIL::access( v1, r, r );
+  const T z_2 = ( extra == 1 ) ? beta * LINALG_DETAIL::access( v2, 0, n2 ) : T( 0 );
+  const T    rho    = ::std::hypot( z_1, z_2 );
+  const bool rotate = ( extra == 1 ) && ( rho != T( 0 ) );
+  const T    c_0    = rotate ? z_1 / rho : T( 1 );
+  const T    s_0    = rotate ? z_2 / rho : T( 0 );
+  for ( ::std::size_t i = 0; i <= r; ++i )
+  {
+    LINALG_DETAIL::access( vw, i, 0 ) = c_0 * LINALG_DETAIL::access( v1, i, r );
+  }
+  if ( extra == 1 )
+  {
+    // The rotated pair leaves the null vector of B, last
+    for ( ::std::size_t i = 0; i <= r; ++i )
+    {
+      LINALG_DETAIL::access( vw, i, n ) = -s_0 * LINALG_DETAIL::access( v1, i, r );
+    }
+    for ( ::std::size_t i = 0; i < columns2; ++i )
+    {
+      LINALG_DETAIL::access( vw, r + 1 + i, 0 ) = s_0 * LINALG_DETAIL::access( v2, i, n2 );
+      LINALG_DETAIL::access( vw, r + 1 + i, n ) = c_0 * LINALG_DETAIL::access( v2, i, n2 );
+    }
+  }
+  s[0] = T( 0 );
+  z[0] = rotate ? rho : z_1;
+  LINALG_DETAIL::access( uw, r, 0 ) = T( 1 );
+  for ( ::std::size_t k = 0; k < r; ++k )
+  {
+    s[ 1 + k ] = sigma1[k];
+    z[ 1 + k ] = alpha * LINALG_DETAIL::access( v1, r, k );
+    for ( ::std::size_t i = 0; i <= r; ++i )
+    {
+      LINALG_DETAIL::access( vw, i, 1 + k ) = LINALG_DETAIL::access( v1, i, k );
+    }
+    for ( ::std::size_t i = 0; i < r; ++i )
+    {
+      LINALG_DETAIL::access( uw, i, 1 + k ) = LINALG_DETAIL::access( u1, i, k );
+    }
+  }
+  for ( ::std::size_t k = 0; k < n2; ++k )
+  {
+    s[ 1 + r + k ] = sigma2[k];
+    z[ 1 + r + k ] = beta * LINALG_DETAIL::access( v2, 0, k );
+    for ( ::std::size_t i = 0; i < columns2; ++i )
+    {
+      LINALG_DETAIL::access( vw, r + 1 + i, 1 + r + k ) = LINALG_DETAIL::access( v2, i, k );
+    }
+    for ( ::std::size_t i = 0; i < n2; ++i )
+    {
+      LINALG_DETAIL::access( uw, r + 1 + i, 1 + r + k ) = LINALG_DETAIL::access( u2, i, k );
+    }
+  }
+  // Solve the merge scaled to unit size
+  T scale = ::std::max( ::std::abs( alpha ), ::std::abs( beta ) );
+  for ( ::std::size_t k = 0; k < n; ++k )
+  {
+    scale = ::std::max( scale, s[k] );
+  }
+  if ( scale == T( 0 ) )
+  {
+    ::std::fill( sigma, sigma + n, T( 0 ) );
+    u = ::std::move( uw );
+    v = ::std::move( vw );
+    return;
+  }
+  for ( ::std::size_t k = 0; k < n; ++k )
+  {
+    s[k] /= scale;
+    z[k] /= scale;
+  }
+  const T eps = ::std::numeric_limits< T >::epsilon();
+  const T tol = T( 8 ) * eps;
+  if ( ::std::abs( z[0] ) <= tol )
+  {
+    z[0] = tol;
+  }
+  // Deflate items whose z is negligible, and one of each pair of nearly equal singular values by a rotation
+  ::std::vector< ::std::size_t > order( n - 1 );
+  ::std::iota( order.begin(), order.end(), ::std::size_t( 1 ) );
+  ::std::stable_sort( order.begin(), order.end(), [&]( ::std::size_t x, ::std::size_t y ) { return s[x] < s[y]; } );
+  ::std::vector< ::std::size_t > kept( 1, 0 );
+  ::std::vector< ::std::size_t > deflated;
+  ::std::size_t                  candidate = 0;
+  for ( ::std::size_t k : order )
+  {
+    if ( ::std::abs( z[k] ) <= tol )
+    {
+      deflated.push_back( k );
+      continue;
+    }
+    if ( ::std::abs( s[k] - s[ candidate ] ) > tol )
+    {
+      if ( candidate != 0 )
+      {
+        kept.push_back( candidate );
+      }
+      candidate = k;
+      continue;
+    }
+    const T hypotenuse = ::std::hypot( z[ candidate ], z[k] );
+    if ( candidate == 0 )
+    {
+      // s_k is negligible: rotating the right vectors folds z_k into item 0
+      const T c = z[0] / hypotenuse;
+      const T t = z[k] / hypotenuse;
+      for ( ::std::size_t i = 0; i < columns; ++i )
+      {
+        const T v_0 = LINALG_DETAIL::access( vw, i, 0 );
+        const T v_k = LINALG_DETAIL::access( vw, i, k );
+        LINALG_DETAIL::access( vw, i, 0 ) = c * v_0 + t * v_k;
+        LINALG_DETAIL::access( vw, i, k ) = ( c < T( 0 ) ) ? t * v_0 - c * v_k : c * v_k - t * v_0;
+      }
+      z[0] = hypotenuse;
+      z[k] = T( 0 );
+      s[k] = ::std::abs( c ) * s[k];
+      deflated.push_back( k );
+      continue;
+    }
+    // Rotating both sides of a pair with equal singular values moves all of z into item k
+    const ::std::size_t p = candidate;
+    const T             c = z[k] / hypotenuse;
+    const T             t = z[p] / hypotenuse;
+    for ( ::std::size_t i = 0; i < columns; ++i )
+    {
+      const T v_p = LINALG_DETAIL::access( vw, i, p );
+      const T v_k = LINALG_DETAIL::access( vw, i, k );
+      LINALG_DETAIL::access( vw, i, p ) = c * v_p - t * v_k;
+      LINALG_DETAIL::access( vw, i, k ) = t * v_p + c * v_k;
+    }
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      const T u_p = LINALG_DETAIL::access( uw, i, p );
+      const T u_k = LINALG_DETAIL::access( uw, i, k );
+      LINALG_DETAIL::access( uw, i, p ) = c * u_p - t * u_k;
+      LINALG_DETAIL::access( uw, i, k ) = t * u_p + c * u_k;
+    }
+    const T s_p = s[p] * c * c + s[k] * t * t;
+    const T s_k = s[p] * t * t + s[k] * c * c;
+    s[p] = s_p;
+    s[k] = s_k;
+    z[p] = T( 0 );
+    z[k] = hypotenuse;
+    deflated.push_back( p );
+    candidate = k;
+  }
+  if ( candidate != 0 )
+  {
+    kept.push_back( candidate );
+  }
+  ::std::stable_sort( kept.begin() + 1, kept.end(), [&]( ::std::size_t x, ::std::size_t y ) { return s[x] < s[y]; } );
+  // Secular equation 1 + sum( z_j^2 / ( s_j^2 - sigma^2 ) ) = 0, each root found relative to its nearest pole
+  const ::std::size_t count = kept.size();
+  ::std::vector< T > sk( count ), zk( count );
+  T norm = T( 0 );
+  for ( ::std::size_t i = 0; i < count; ++i )
+  {
+    sk[i] = s[ kept[i] ];
+    zk[i] = z[ kept[i] ];
+    norm += zk[i] * zk[i];
+  }
+  ::std::vector< ::std::size_t > origin( count );
+  ::std::vector< T >             shift( count );
+  for_each_row_tile( 0, count, count * count * 16, [&]( ::std::size_t first, ::std::size_t last )
+  {
+    for ( ::std::size_t i = first; i < last; ++i )
+    {
+      ::std::size_t o;
+      T             lo;
+      T             hi;
+      if ( i + 1 < count )
+      {
+        const T middle = ( sk[ i + 1 ] - sk[i] ) / T( 2 );
+        T f = T( 1 );
+        for ( ::std::size_t j = 0; j < count; ++j )
+        {
+          f += zk[j] * zk[j] / ( ( ( sk[j] - sk[i] ) - middle ) * ( ( sk[j] + sk[i] ) + middle ) );
+        }
+        if ( f >= T( 0 ) )
+        {
+          o  = i;
+          lo = T( 0 );
+          hi = middle;
+        }
+        else
+        {
+          o  = i + 1;
+          lo = ( sk[i] - sk[ i + 1 ] ) + middle;
+          hi = T( 0 );
+        }
+      }
+      else
+      {
+        o  = i;
+        lo = T( 0 );
+        hi = norm / ( sk[i] + ::std::sqrt( sk[i] * sk[i] + norm ) );
+      }
+      // Newton's method, safeguarded by bisection of the bracket
+      T tau = ( lo + hi ) / T( 2 );
+      for ( ::std::size_t iteration = 0; iteration < 200; ++iteration )
+      {
+        const T root  = sk[o] + tau;
+        T       g     = T( 1 );
+        T       slope = T( 0 );
+        for ( ::std::size_t j = 0; j < count; ++j )
+        {
+          const T ratio = zk[j] / ( ( ( sk[j] - sk[o] ) - tau ) * ( ( sk[j] + sk[o] ) + tau ) );
+          g     += zk[j] * ratio;
+          slope += T( 2 ) * root * ratio * ratio;
+        }
+        if ( g == T( 0 ) )
+        {
+          break;
+        }
+        ( ( g > T( 0 ) ) ? hi : lo ) = tau;
+        T next = tau - g / slope;
+        if ( !( ( next > lo ) && ( next < hi ) ) )
+        {
+          next = ( lo + hi ) / T( 2 );
+        }
+        const bool converged = ( ::std::abs( next - tau ) <= eps * ::std::abs( next ) ) ||
+                               ( hi - lo <= eps * ::std::max( ::std::abs( lo ), ::std::abs( hi ) ) );
+        tau = next;
+        if ( converged )
+        {
+          break;
+        }
+      }
+      origin[i] = o;
+      shift[i]  = tau;
+    }
+  } );
+  // sigma_i^2 - s_j^2, accurate when sigma_i is close to s_j
+  const auto gap = [&]( ::std::size_t i, ::std::size_t j ) { return ( ( sk[ origin[i] ] - sk[j] ) + shift[i] ) * ( ( sk[ origin[i] ] + sk[j] ) + shift[i] ); };
+  // Recompute z for which the computed roots are exact, so the singular vectors are orthogonal
+  ::std::vector< T > z_hat( count );
+  for ( ::std::size_t j = 0; j < count; ++j )
+  {
+    T product = gap( j, j );
+    for ( ::std::size_t i = 0; i < count; ++i )
+    {
+      if ( i != j )
+      {
+        product *= gap( i, j ) / ( ( sk[i] - sk[j] ) * ( sk[i] + sk[j] ) );
+      }
+    }
+    z_hat[j] = ::std::copysign( ::std::sqrt( ::std::abs( product ) ), zk[j] );
+  }
+  // Right vectors z_j / ( s_j^2 - sigma^2 ) and left vectors ( -1, s_j z_j / ( s_j^2 - sigma^2 ) )
+  matrix_type right( extents_type( count, count ) );
+  matrix_type left( extents_type( count, count ) );
+  for ( ::std::size_t i = 0; i < count; ++i )
+  {
+    T right_norm = T( 0 );
+    T left_norm  = T( 0 );
+    for ( ::std::size_t j = 0; j < count; ++j )
+    {
+      const T x = -z_hat[j] / gap( i, j );
+      const T y = ( j == 0 ) ? T( -1 ) : sk[j] * x;
+      LINALG_DETAIL::access( right, j, i ) = x;
+      LINALG_DETAIL::access( left, j, i )  = y;
+      right_norm += x * x;
+      left_norm  += y * y;
+    }
+    right_norm = T( 1 ) / ::std::sqrt( right_norm );
+    left_norm  = T( 1 ) / ::std::sqrt( left_norm );
+    for ( ::std::size_t j = 0; j < count; ++j )
+    {
+      LINALG_DETAIL::access( right, j, i ) *= right_norm;
+      LINALG_DETAIL::access( left, j, i )  *= left_norm;
+    }
+  }
+  matrix_type v_kept( extents_type( columns, count ) );
+  matrix_type u_kept( extents_type( n, count ) );
+  matrix_type v_merged( extents_type( columns, count ) );
+  matrix_type u_merged( extents_type( n, count ) );
+  for ( ::std::size_t j = 0; j < count; ++j )
+  {
+    for ( ::std::size_t i = 0; i < columns; ++i )
+    {
+      LINALG_DETAIL::access( v_kept, i, j )   = LINALG_DETAIL::access( vw, i, kept[j] );
+      LINALG_DETAIL::access( v_merged, i, j ) = T( 0 );
+    }
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      LINALG_DETAIL::access( u_kept, i, j )   = LINALG_DETAIL::access( uw, i, kept[j] );
+      LINALG_DETAIL::access( u_merged, i, j ) = T( 0 );
+    }
+  }
+  block_product_update( make_block( v_merged ), make_block( v_kept ), make_block( right ), T( 1 ) );
+  block_product_update( make_block( u_merged ), make_block( u_kept ), make_block( left ), T( 1 ) );
+  // Order all triplets, merged ones being numbered after the deflated
+  ::std::vector< ::std::pair< T, ::std::size_t > > pairs;
+  pairs.reserve( n );
+  for ( ::std::size_t k : deflated )
+  {
+    pairs.emplace_back( s[k], k );
+  }
+  for ( ::std::size_t i = 0; i < count; ++i )
+  {
+    pairs.emplace_back( sk[ origin[i] ] + shift[i], n + i );
+  }
+  ::std::stable_sort( pairs.begin(), pairs.end(), []( const auto& x, const auto& y ) { return x.first < y.first; } );
+  u = matrix_type( extents_type( n, n ) );
+  v = matrix_type( extents_type( columns, columns ) );
+  for ( ::std::size_t col = 0; col < n; ++col )
+  {
+    sigma[col] = pairs[col].first * scale;
+    const ::std::size_t source = pairs[col].second;
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      LINALG_DETAIL::access( u, i, col ) = ( source < n ) ? LINALG_DETAIL::access( uw, i, source ) : LINALG_DETAIL::access( u_merged, i, source - n );
+    }
+    for ( ::std::size_t i = 0; i < columns; ++i )
+    {
+      LINALG_DETAIL::access( v, i, col ) = ( source < n ) ? LINALG_DETAIL::access( vw, i, source ) : LINALG_DETAIL::access( v_merged, i, source - n );
+    }
+  }
+  if ( extra == 1 )
+  {
+    for ( ::std::size_t i = 0; i < columns; ++i )
+    {
+      LINALG_DETAIL::access( v, i, n ) = LINALG_DETAIL::access( vw, i, n );
+    }
+  }
+}
+
+//--------------------------------
+//  Singular Value Decomposition
+//--------------------------------
+
+/// @brief Returns a copy of a, transposed if it has fewer rows than columns
+template < class T, class Matrix >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > tall_copy( const Matrix& a )
+{
+  const ::std::size_t rows       = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t columns    = static_cast< ::std::size_t >( a.extent(1) );
+  const bool          transposed = rows < columns;
+  LINALG::dyn_tensor< T, 2 > copy( typename LINALG::dyn_tensor< T, 2 >::extents_type( ::std::max( rows, columns ), ::std::min( rows, columns ) ) );
+  for ( ::std::size_t i = 0; i < rows; ++i )
+  {
+    for ( ::std::size_t j = 0; j < columns; ++j )
+    {
+      ( transposed ? LINALG_DETAIL::access( copy, j, i ) : LINALG_DETAIL::access( copy, i, j ) ) = static_cast< T >( LINALG_DETAIL::access( a, i, j ) );
+    }
+  }
+  return copy;
+}
+
+/// @brief Singular value decomposition of a, with at least as many rows as columns, overwriting it
+/// sigma receives the singular values in descending order.
+template < class T >
+void tall_svd( LINALG::dyn_tensor< T, 2 >& a, LINALG::svd_mode mode, LINALG::svd_method method, T* sigma, LINALG::dyn_tensor< T, 2 >& u, LINALG::dyn_tensor< T, 2 >& v )
+{
+  using matrix_type  = LINALG::dyn_tensor< T, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  const ::std::size_t m    = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t n    = static_cast< ::std::size_t >( a.extent(1) );
+  const ::std::size_t vecs = ( mode == LINALG::svd_mode::full ) ? m : n;
+  if ( method == LINALG::svd_method::jacobi )
+  {
+    jacobi_svd( a, vecs, sigma, u, v );
+    return;
+  }
+  ::std::vector< T > d( n ), e( n, T( 0 ) ), tauq( n, T( 0 ) ), taup( n, T( 0 ) );
+  bidiagonalize( a, d.data(), e.data(), tauq.data(), taup.data() );
+  matrix_type left;
+  matrix_type right;
+  bidiagonal_divide_and_conquer( d.data(), e.data(), n, 0, sigma, left, right );
+  ::std::reverse( sigma, sigma + n );
+  // U = Q diag( left, I ) and V = P right, in descending order
+  u = matrix_type( extents_type( m, vecs ) );
+  v = matrix_type( extents_type( n, n ) );
+  for ( ::std::size_t i = 0; i < m; ++i )
+  {
+    for ( ::std::size_t j = 0; j < vecs; ++j )
+    {
+      LINALG_DETAIL::access( u, i, j ) = ( ( i < n ) && ( j < n ) ) ? LINALG_DETAIL::access( left, i, n - 1 - j ) : T( ( i == j ) ? 1 : 0 );
+    }
+  }
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    for ( ::std::size_t j = 0; j < n; ++j )
+    {
+      LINALG_DETAIL::access( v, i, j ) = LINALG_DETAIL::access( right, i, n - 1 - j );
+    }
+  }
+  apply_householder_q< false >( LINALG_DETAIL::make_block( a ), tauq.data(), LINALG_DETAIL::make_block( u ) );
+  if ( n > 1 )
+  {
+    // The right reflectors are stored along rows: transpose them into columns acting on rows 1 to n - 1
+    matrix_type factors( extents_type( n - 1, n - 1 ) );
+    for ( ::std::size_t i = 0; i + 1 < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j + 1 < n; ++j )
+      {
+        LINALG_DETAIL::access( factors, i, j ) = ( i < j ) ? T( 0 ) : LINALG_DETAIL::access( a, j, i + 1 );
+      }
+    }
+    apply_householder_q< false >( LINALG_DETAIL::make_block( factors ), taup.data(), LINALG_DETAIL::make_block( v ).block( 1, 0, n - 1, n ) );
+  }
+}
+
+/// @brief Returns left( :, 0:count ) diag( w ) right( :, 0:count )^T
+template < class T >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > weighted_outer_product( const LINALG::dyn_tensor< T, 2 >& left, const ::std::vector< T >& w, const LINALG::dyn_tensor< T, 2 >& right, ::std::size_t count )
+{
+  using matrix_type  = LINALG::dyn_tensor< T, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  const ::std::size_t rows    = static_cast< ::std::size_t >( left.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( right.extent(0) );
+  matrix_type scaled( extents_type( rows, count ) );
+  matrix_type transposed( extents_type( count, columns ) );
+  matrix_type result( extents_type( rows, columns ) );
+  for ( ::std::size_t k = 0; k < count; ++k )
+  {
+    for ( ::std::size_t i = 0; i < rows; ++i )
+    {
+      LINALG_DETAIL::access( scaled, i, k ) = LINALG_DETAIL::access( left, i, k ) * w[k];
+    }
+    for ( ::std::size_t j = 0; j < columns; ++j )
+    {
+      LINALG_DETAIL::access( transposed, k, j ) = LINALG_DETAIL::access( right, j, k );
+    }
+  }
+  for ( ::std::size_t i = 0; i < rows; ++i )
+  {
+    for ( ::std::size_t j = 0; j < columns; ++j )
+    {
+      LINALG_DETAIL::access( result, i, j ) = T( 0 );
+    }
+  }
+  if ( count > 0 )
+  {
+    block_product_update( make_block( result ), make_block( scaled ), make_block( transposed ), T( 1 ) );
+  }
+  return result;
+}
+
+/// @brief Returns the leading columns of a
+template < class T >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > leading_columns( const LINALG::dyn_tensor< T, 2 >& a, ::std::size_t count )
+{
+  LINALG::dyn_tensor< T, 2 > result( typename LINALG::dyn_tensor< T, 2 >::extents_type( a.extent(0), count ) );
+  for ( ::std::size_t i = 0; i < static_cast< ::std::size_t >( a.extent(0) ); ++i )
+  {
+    for ( ::std::size_t j = 0; j < count; ++j )
+    {
+      LINALG_DETAIL::access( result, i, j ) = LINALG_DETAIL::access( a, i, j );
+    }
+  }
+  return result;
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//--------------------------------
+//  Singular Value Decomposition
+//--------------------------------
+
+/// @brief Singular value decomposition A = U diag( s ) V^T of a real matrix, with the singular values s descending
+/// @tparam Matrix decomposed matrix type
+template < class Matrix >
+class singular_value_decomposition
+{
+  public:
+    //- Aliases
+    using matrix_type  = ::std::decay_t< Matrix >;
+    using value_type   = ::std::remove_cv_t< typename matrix_type::value_type >;
+    using values_type  = LINALG::dyn_tensor< value_type, 1 >;
+    using vectors_type = LINALG::dyn_tensor< value_type, 2 >;
+
+    //- Constructors
+    /// @brief Decomposes a
+    /// @throw domain_error if the Jacobi rotations do not converge
+    explicit singular_value_decomposition( const matrix_type& a, svd_mode mode = svd_mode::thin, svd_method method = svd_method::divide_and_conquer ) :
+      rows_( static_cast< ::std::size_t >( a.extent(0) ) ), columns_( static_cast< ::std::size_t >( a.extent(1) ) )
+    {
+      auto                        work = LINALG_DETAIL::tall_copy< value_type >( a );
+      ::std::vector< value_type > sigma( ::std::min( this->rows_, this->columns_ ) );
+      if ( this->rows_ >= this->columns_ )
+      {
+        LINALG_DETAIL::tall_svd( work, mode, method, sigma.data(), this->u_, this->v_ );
+      }
+      else
+      {
+        // A^T = U' S V'^T, so U = V' and V = U'
+        LINALG_DETAIL::tall_svd( work, mode, method, sigma.data(), this->v_, this->u_ );
+      }
+      this->values_ = values_type( typename values_type::extents_type( sigma.size() ) );
+      for ( ::std::size_t i = 0; i < sigma.size(); ++i )
+      {
+        LINALG_DETAIL::access( this->values_, i ) = sigma[i];
+      }
+    }
+
+    /// @brief Holds singular triplets of a rows x columns matrix computed elsewhere, the values descending
+    singular_value_decomposition( ::std::size_t rows, ::std::size_t columns, values_type values, vectors_type u, vectors_type v ) :
+      rows_( rows ), columns_( columns ), values_( ::std::move( values ) ), u_( ::std::move( u ) ), v_( ::std::move( v ) ) { }
+
+    //- Decomposition
+    /// @brief Returns the singular values in descending order
+    [[nodiscard]] constexpr const values_type& values() const noexcept { return this->values_; }
+    /// @brief Returns the left singular vectors as columns, in the order of the singular values
+    [[nodiscard]] constexpr const vectors_type& u() const noexcept { return this->u_; }
+    /// @brief Returns the right singular vectors as columns, in the order of the singular values
+    [[nodiscard]] constexpr const vectors_type& v() const noexcept { return this->v_; }
+
+    /// @brief Returns the default tolerance below which singular values are taken as zero, max( m, n ) eps s_0
+    [[nodiscard]] value_type default_tolerance() const noexcept
+    {
+      const value_type largest = ( this->values_.extent(0) == 0 ) ? value_type( 0 ) : LINALG_DETAIL::access( this->values_, 0 );
+      return static_cast< value_type >( ::std::max( this->rows_, this->columns_ ) ) * ::std::numeric_limits< value_type >::epsilon() * largest;
+    }
+    /// @brief Returns the number of singular values above the tolerance
+    [[nodiscard]] ::std::size_t rank( value_type tolerance ) const noexcept
+    {
+      ::std::size_t count = 0;
+      while ( ( count < static_cast< ::std::size_t >( this->values_.extent(0) ) ) && ( LINALG_DETAIL::access( this->values_, count ) > tolerance ) )
+      {
+        ++count;
+      }
+      return count;
+    }
+    /// @brief Returns the number of singular values above the default tolerance
+    [[nodiscard]] ::std::size_t rank() const noexcept { return this->rank( this->default_tolerance() ); }
+
+    /// @brief Keeps the leading count singular triplets, dropping the rest
+    void truncate( ::std::size_t count )
+    {
+      count = ::std::min( count, static_cast< ::std::size_t >( this->values_.extent(0) ) );
+      values_type values { typename values_type::extents_type( count ) };
+      for ( ::std::size_t i = 0; i < count; ++i )
+      {
+        LINALG_DETAIL::access( values, i ) = LINALG_DETAIL::access( this->values_, i );
+      }
+      this->values_ = ::std::move( values );
+      this->u_      = LINALG_DETAIL::leading_columns( this->u_, count );
+      this->v_      = LINALG_DETAIL::leading_columns( this->v_, count );
+    }
+
+    /// @brief Returns U( :, 0:k ) diag( s ) V( :, 0:k )^T over the singular triplets kept
+    [[nodiscard]] vectors_type reconstruct() const
+    {
+      return LINALG_DETAIL::weighted_outer_product( this->u_, this->weights( []( value_type s ) { return s; } ), this->v_, static_cast< ::std::size_t >( this->values_.extent(0) ) );
+    }
+
+    /// @brief Returns the pseudo-inverse V diag( 1 / s ) U^T over the singular values above the tolerance
+    [[nodiscard]] vectors_type pseudo_inverse( value_type tolerance ) const
+    {
+      return LINALG_DETAIL::weighted_outer_product( this->v_, this->weights( []( value_type s ) { return value_type( 1 ) / s; } ), this->u_, this->rank( tolerance ) );
+    }
+
+  private:
+    //- Implementation
+    template < class F >
+    [[nodiscard]] ::std::vector< value_type > weights( F f ) const
+    {
+      ::std::vector< value_type > w( static_cast< ::std::size_t >( this->values_.extent(0) ) );
+      for ( ::std::size_t i = 0; i < w.size(); ++i )
+      {
+        const value_type s = LINALG_DETAIL::access( this->values_, i );
+        w[i] = ( s == value_type( 0 ) ) ? value_type( 0 ) : f( s );
+      }
+      return w;
+    }
+
+    //- Data
+    ::std::size_t rows_;
+    ::std::size_t columns_;
+    values_type   values_;
+    vectors_type  u_;
+    vectors_type  v_;
+};
+
+//--------------------------
+//  Singular Value Solvers
+//--------------------------
+
+/// @brief Returns the singular value decomposition of a real matrix
+/// @throw domain_error if the Jacobi rotations do not converge
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::matrix_expression< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] singular_value_decomposition< Matrix > svd( const Matrix& a, svd_mode mode = svd_mode::thin, svd_method method = svd_method::divide_and_conquer )
+{
+  return singular_value_decomposition< Matrix >( a, mode, method );
+}
+
+/// @brief Returns the singular values of a real matrix in descending order
+/// The singular vectors are never formed: the bidiagonal matrix is solved by QL iteration alone.
+/// @throw domain_error if an eigenvalue of the permuted tridiagonal matrix does not converge
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::matrix_expression< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] LINALG::dyn_tensor< ::std::remove_cv_t< typename Matrix::value_type >, 1 > singular_values( const Matrix& a )
+{
+  using value_type = ::std::remove_cv_t< typename Matrix::value_type >;
+  auto                work = LINALG_DETAIL::tall_copy< value_type >( a );
+  const ::std::size_t n    = static_cast< ::std::size_t >( work.extent(1) );
+  LINALG::dyn_tensor< value_type, 1 > values { typename LINALG::dyn_tensor< value_type, 1 >::extents_type( n ) };
+  if ( n == 0 )
+  {
+    return values;
+  }
+  ::std::vector< value_type > d( n ), e( n, value_type( 0 ) ), tauq( n ), taup( n );
+  LINALG_DETAIL::bidiagonalize( work, d.data(), e.data(), tauq.data(), taup.data() );
+  // [ 0 B; B^T 0 ] permuted to tridiagonal form has a zero diagonal and d_0, e_0, d_1, e_1, ... below it
+  ::std::vector< value_type > diagonal( 2 * n, value_type( 0 ) ), subdiagonal( 2 * n, value_type( 0 ) );
+  value_type                  norm = value_type( 0 );
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    subdiagonal[ 2 * i ] = d[i];
+    if ( i + 1 < n )
+    {
+      subdiagonal[ 2 * i + 1 ] = e[i];
+    }
+    norm = ::std::max( norm, ::std::abs( d[i] ) + ::std::abs( e[i] ) );
+  }
+  // QL iteration splits relative to the diagonal, which is zero here: split elements negligible next to B beforehand,
+  // so the zero singular values of a rank deficient matrix deflate
+  for ( value_type& sub : subdiagonal )
+  {
+    if ( ::std::abs( sub ) <= ::std::numeric_limits< value_type >::epsilon() * norm )
+    {
+      sub = value_type( 0 );
+    }
+  }
+  LINALG_DETAIL::tridiagonal_ql( diagonal.data(), subdiagonal.data(), 2 * n, static_cast< LINALG::dyn_tensor< value_type, 2 >* >( nullptr ) );
+  ::std::sort( diagonal.begin(), diagonal.end(), ::std::greater<>() );
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    LINALG_DETAIL::access( values, i ) = ::std::abs( diagonal[i] );
+  }
+  return values;
+}
+
+/// @brief Returns the Moore-Penrose pseudo-inverse of a real matrix
+/// Singular values at most the tolerance, by default max( m, n ) eps times the largest, are taken as zero.
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::matrix_expression< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] LINALG::dyn_tensor< ::std::remove_cv_t< typename Matrix::value_type >, 2 > pinv( const Matrix& a )
+{
+  const auto decomposition = LINALG::svd( a );
+  return decomposition.pseudo_inverse( decomposition.default_tolerance() );
+}
+
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::matrix_expression< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] LINALG::dyn_tensor< ::std::remove_cv_t< typename Matrix::value_type >, 2 > pinv( const Matrix& a, ::std::remove_cv_t< typename Matrix::value_type > tolerance )
+{
+  return LINALG::svd( a ).pseudo_inverse( tolerance );
+}
+
+/// @brief Returns the best approximation of a real matrix of at most the given rank, in the 2 and Frobenius norms
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::matrix_expression< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] LINALG::dyn_tensor< ::std::remove_cv_t< typename Matrix::value_type >, 2 > low_rank_approximation( const Matrix& a, ::std::size_t rank )
+{
+  auto decomposition = LINALG::svd( a );
+  decomposition.truncate( rank );
+  return decomposition.reconstruct();
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_SVD_HPP
@@ -0,0 +1,883 @@
+//==================================================================================================
+//  File:       symmetric_eigen.hpp
+//
+//  Summary:    This header defines the eigendecomposition of real symmetric matrices:
+//              symmetric_eigendecomposition< Matrix >
+//              symmetric_eigen( const Matrix& a )
+//              symmetric_eigenvalues( const Matrix& a )
+//
+//              Only the lower triangle of the matrix is read. It is reduced to tridiagonal form T =
+//              Q^T A Q by Householder reflectors, applied a panel of tridiagonal_block_extent columns
+//              at a time: the panel is reduced with its updates deferred, then the trailing matrix is
+//              updated with one symmetric rank 2k product over tiles of rows run in parallel.
+//
+//              The eigenpairs of T are found by divide and conquer: T is split into two halves by a
+//              rank one tear, the halves are solved recursively, in parallel for large matrices, and
+//              merged by solving the secular equation of the rank one modification. The eigenvectors
+//              of the merge are computed from a recomputed z, after Gu and Eisenstat, so they stay
+//              orthogonal without reorthogonalization. Halves of at most eigen_leaf_extent rows, and
+//              symmetric_eigenvalues, use the implicit QL iteration instead. Matrices of static
+//              extents up to 4 x 4 skip the reduction and are diagonalized by cyclic Jacobi rotations.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_SYMMETRIC_EIGEN_HPP
+#define LINEAR_ALGEBRA_SYMMETRIC_EIGEN_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//----------------------------------
+//  Householder Tridiagonalization
+//----------------------------------
+
+// Columns reduced before the trailing matrix is updated
+inline constexpr ::std::size_t tridiagonal_block_extent = 32;
+
+// Rows of the tridiagonal matrix below which divide and conquer solves by QL iteration
+inline constexpr ::std::size_t eigen_leaf_extent = 32;
+
+// Largest static extent diagonalized by Jacobi rotations
+inline constexpr ::std::size_t jacobi_extent = 4;
+
+// Sweeps of Jacobi rotations before giving up
+inline constexpr ::std::size_t jacobi_eigen_sweep_limit = 50;
+
+/// @brief Runs f( first, last ) over tiles of [begin, end), in parallel if work is at least the product threshold
+template < class F >
+void for_each_row_tile( ::std::size_t begin, ::std::size_t end, ::std::size_t work, F f )
+{
+  ::std::vector< ::std::size_t > tiles( ( end - begin + parallel_tile_extent - 1 ) / parallel_tile_extent );
+  ::std::iota( tiles.begin(), tiles.end(), ::std::size_t( 0 ) );
+  // Cache the last exception to be thrown
+  ::std::exception_ptr eptr;
+  const auto run_tile = [&]( ::std::size_t tile ) noexcept
+  {
+    try
+    {
+      const ::std::size_t first = begin + tile * parallel_tile_extent;
+      f( first, ::std::min( end, first + parallel_tile_extent ) );
+    }
+    catch ( ... ) { eptr = ::std::current_exception(); }
+  };
+  if ( work < parallel_product_threshold )
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_SEQ, tiles.begin(), tiles.end(), run_tile );
+  }
+  else
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR, tiles.begin(), tiles.end(), run_tile );
+  }
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+}
+
+/// @brief Reduces the symmetric a, held in full, to tridiagonal form with diagonal d and subdiagonal e
+/// The reflectors are left below the subdiagonal of a, with their scalar factors in tau.
+template < class T >
+void tridiagonalize( LINALG::dyn_tensor< T, 2 >& a, T* d, T* e, T* tau )
+{
+  const ::std::size_t n     = static_cast< ::std::size_t >( a.extent(0) );
+  const ::std::size_t nb    = tridiagonal_block_extent;
+  const auto          block = LINALG_DETAIL::make_block( a );
+  // Reflectors V and the W with A - V W^T - W V^T equal to the partially reduced matrix, n x nb row major
+  ::std::vector< T > v( n * nb ), w( n * nb ), p( n ), wv( nb ), vv( nb );
+  for ( ::std::size_t j = 0; j < n; j += nb )
+  {
+    const ::std::size_t width = ::std::min( nb, n - j );
+    ::std::fill( v.begin(), v.end(), T( 0 ) );
+    ::std::fill( w.begin(), w.end(), T( 0 ) );
+    for ( ::std::size_t i = 0; i < width; ++i )
+    {
+      const ::std::size_t c = j + i;
+      // Apply the updates deferred by the panel to column c
+      for ( ::std::size_t r = c; r < n; ++r )
+      {
+        T sum = T( 0 );
+        for ( ::std::size_t k = 0; k < i; ++k )
+        {
+          sum += v[ r * nb + k ] * w[ c * nb + k ] + w[ r * nb + k ] * v[ c * nb + k ];
+        }
+        block( r, c ) -= sum;
+      }
+      d[c] = block( c, c );
+      if ( c + 1 == n )
+      {
+        break;
+      }
+      tau[c] = householder_reflector( block.block( c + 1, c, n - c - 1, 1 ) );
+      e[c]   = block( c + 1, c );
+      v[ ( c + 1 ) * nb + i ] = T( 1 );
+      for ( ::std::size_t r = c + 2; r < n; ++r )
+      {
+        v[ r * nb + i ] = block( r, c );
+      }
+      // p = tau ( A - V W^T - W V^T ) v over the trailing rows and columns
+      for_each_row_tile( c + 1, n, ( n - c ) * ( n - c ), [&]( ::std::size_t first, ::std::size_t last )
+      {
+        for ( ::std::size_t r = first; r < last; ++r )
+        {
+          T sum = T( 0 );
+          for ( ::std::size_t k = c + 1; k < n; ++k )
+          {
+            sum += block( r, k ) * v[ k * nb + i ];
+          }
+          p[r] = sum;
+        }
+      } );
+      for ( ::std::size_t k = 0; k < i; ++k )
+      {
+        wv[k] = T( 0 );
+        vv[k] = T( 0 );
+        for ( ::std::size_t r = c + 1; r < n; ++r )
+        {
+          wv[k] += w[ r * nb + k ] * v[ r * nb + i ];
+          vv[k] += v[ r * nb + k ] * v[ r * nb + i ];
+        }
+      }
+      T dot = T( 0 );
+      for ( ::std::size_t r = c + 1; r < n; ++r )
+      {
+        T sum = p[r];
+        for ( ::std::size_t k = 0; k < i; ++k )
+        {
+          sum -= v[ r * nb + k ] * wv[k] + w[ r * nb + k ] * vv[k];
+        }
+        p[r] = tau[c] * sum;
+        dot += p[r] * v[ r * nb + i ];
+      }
+      // w = p - ( tau / 2 ) ( p^T v ) v
+      const T alpha = -T( 0.5 ) * tau[c] * dot;
+      for ( ::std::size_t r = c + 1; r < n; ++r )
+      {
+        w[ r * nb + i ] = p[r] + alpha * v[ r * nb + i ];
+      }
+    }
+    // Trailing matrix update A -= V W^T + W V^T, kept in full so later products read rows
+    const ::std::size_t first_row = j + width;
+    for_each_row_tile( first_row, n, ( n - first_row ) * ( n - first_row ) * width, [&]( ::std::size_t first, ::std::size_t last )
+    {
+      for ( ::std::size_t r = first; r < last; ++r )
+      {
+        for ( ::std::size_t col = first_row; col < n; ++col )
+        {
+          T sum = T( 0 );
+          for ( ::std::size_t k = 0; k < width; ++k )
+          {
+            sum += v[ r * nb + k ] * w[ col * nb + k ] + w[ r * nb + k ] * v[ col * nb + k ];
+          }
+          block( r, col ) -= sum;
+        }
+      }
+    } );
+  }
+}
+
+//-----------------------
+//  Tridiagonal Solvers
+//-----------------------
+
+/// @brief Implicit QL iteration on the tridiagonal matrix with diagonal d and subdiagonal e, e[n-1] = 0
+/// d is overwritten with the eigenvalues, unordered, and the rotations are applied to the columns of z if given
+/// @throw domain_error if an eigenvalue does not converge
+template < class T >
+void tridiagonal_ql( T* d, T* e, ::std::size_t n, LINALG::dyn_tensor< T, 2 >* z )
+{
+  const T eps = ::std::numeric_limits< T >::epsilon();
+  for ( ::std::size_t l = 0; l < n; ++l )
+  {
+    ::std::size_t iterations = 0;
+    ::std::size_t m;
+    do
+    {
+      // Find a negligible subdiagonal element to split at
+      for ( m = l; m + 1 < n; ++m )
+      {
+        if ( ::std::abs( e[m] ) <= eps * ( ::std::abs( d[m] ) + ::std::abs( d[ m + 1 ] ) ) )
+        {
+          break;
+        }
+      }
+      if ( m == l )
+      {
+        break;
+      }
+      if ( iterations++ == 60 ) LINALG_UNLIKELY
+      {
+        throw ::std::domain_error( "Eigenvalue iteration did not converge." );
+      }
+      // Wilkinson shift
+      T g = ( d[ l + 1 ] - d[l] ) / ( T( 2 ) * e[l] );
+      T r = ::std::hypot( g, T( 1 ) );
+      g = d[m] - d[l] + e[l] / ( g + ::std::copysign( r, g ) );
+      T    s         = T( 1 );
+      T    c         = T( 1 );
+      T    p         = T( 0 );
+      bool underflow = false;
+      for ( ::std::size_t i = m; i-- > l; )
+      {
+        const T f = s * e[i];
+        const T b = c * e[i];
+        r = ::std::hypot( f, g );
+        e[ i + 1 ] = r;
+        if ( r == T( 0 ) )
+        {
+          d[ i + 1 ] -= p;
+          e[m] = T( 0 );
+          underflow = true;
+          break;
+        }
+        s = f / r;
+        c = g / r;
+        g = d[ i + 1 ] - p;
+        r = ( d[i] - g ) * s + T( 2 ) * c * b;
+        p = s * r;
+        d[ i + 1 ] = g + p;
+        g = c * r - b;
+        if ( z != nullptr )
+        {
+          for ( ::std::size_t k = 0; k < static_cast< ::std::size_t >( z->extent(0) ); ++k )
+          {
+            const T z_k = LINALG_DETAIL::access( *z, k, i + 1 );
+            LINALG_DETAIL::access( *z, k, i + 1 ) = s * LINALG_DETAIL::access( *z, k, i ) + c * z_k;
+            LINALG_DETAIL::access( *z, k, i )     = c * LINALG_DETAIL::access( *z, k, i ) - s * z_k;
+          }
+        }
+      }
+      if ( !underflow )
+      {
+        d[l] -= p;
+        e[l] = g;
+        e[m] = T( 0 );
+      }
+    }
+    while ( m != l );
+  }
+}
+
+/// @brief Returns the identity matrix of order n
+template < class T >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > identity_matrix( ::std::size_t n )
+{
+  LINALG::dyn_tensor< T, 2 > q( typename LINALG::dyn_tensor< T, 2 >::extents_type( n, n ) );
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    for ( ::std::size_t j = 0; j < n; ++j )
+    {
+      LINALG_DETAIL::access( q, i, j ) = T( ( i == j ) ? 1 : 0 );
+    }
+  }
+  return q;
+}
+
+/// @brief Merges the eigendecompositions of diag( T1, T2 ) = Q diag( d ) Q^T torn from T by rho z z^T
+/// d is overwritten with the eigenvalues of Q ( diag( d ) + rho z z^T ) Q^T in ascending order, and the
+/// eigenvectors are returned as columns.
+template < class T >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > rank_one_merge( T* d, ::std::vector< T >& z, T rho, LINALG::dyn_tensor< T, 2 >& q )
+{
+  using matrix_type  = LINALG::dyn_tensor< T, 2 >;
+  using extents_type = typename matrix_type::extents_type;
+  const ::std::size_t n   = z.size();
+  const T             eps = ::std::numeric_limits< T >::epsilon();
+  ::std::vector< ::std::size_t > order( n );
+  ::std::iota( order.begin(), order.end(), ::std::size_t( 0 ) );
+  ::std::stable_sort( order.begin(), order.end(), [&]( ::std::size_t x, ::std::size_t y ) { return d[x] < d[y]; } );
+  T largest = rho;
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    largest = ::std::max( largest, ::std::abs( d[i] ) );
+  }
+  const T tol = T( 8 ) * eps * largest;
+  // Deflate components of z too small to matter, and one of each pair of nearly equal d by a rotation
+  ::std::vector< T >             values( d, d + n );
+  ::std::vector< ::std::size_t > kept;
+  ::std::vector< ::std::size_t > deflated;
+  bool                           have_candidate = false;
+  ::std::size_t                  candidate      = 0;
+  for ( ::std::size_t k : order )
+  {
+    if ( rho * ::std::abs( z[k] ) <= tol )
+    {
+      deflated.push_back( k );
+      continue;
+    }
+    if ( !have_candidate )
+    {
+      have_candidate = true;
+      candidate      = k;
+      continue;
+    }
+    const ::std::size_t j = candidate;
+    const T r = ::std::hypot( z[j], z[k] );
+    const T c = z[k] / r;
+    const T s = z[j] / r;
+    if ( ::std::abs( ( values[j] - values[k] ) * c * s ) <= tol )
+    {
+      for ( ::std::size_t row = 0; row < n; ++row )
+      {
+        const T q_j = LINALG_DETAIL::access( q, row, j );
+        const T q_k = LINALG_DETAIL::access( q, row, k );
+        LINALG_DETAIL::access( q, row, j ) = c * q_j - s * q_k;
+        LINALG_DETAIL::access( q, row, k ) = s * q_j + c * q_k;
+      }
+      const T d_j = values[j] * c * c + values[k] * s * s;
+      const T d_k = values[j] * s * s + values[k] * c * c;
+      values[j] = d_j;
+      values[k] = d_k;
+      z[j]      = T( 0 );
+      z[k]      = r;
+      deflated.push_back( j );
+    }
+    else
+    {
+      kept.push_back( j );
+    }
+    candidate = k;
+  }
+  if ( have_candidate )
+  {
+    kept.push_back( candidate );
+  }
+  ::std::stable_sort( kept.begin(), kept.end(), [&]( ::std::size_t x, ::std::size_t y ) { return values[x] < values[y]; } );
+  // Secular equation 1 + rho sum( z_j^2 / ( d_j - lambda ) ) = 0, each root found relative to its nearest pole
+  const ::std::size_t count = kept.size();
+  ::std::vector< T > dk( count ), zk( count );
+  T norm = T( 0 );
+  for ( ::std::size_t i = 0; i < count; ++i )
+  {
+    dk[i] = values[ kept[i] ];
+    zk[i] = z[ kept[i] ];
+    norm += zk[i] * zk[i];
+  }
+  ::std::vector< ::std::size_t > origin( count );
+  ::std::vector< T >             shift( count );
+  for_each_row_tile( 0, count, count * count * 16, [&]( ::std::size_t first, ::std::size_t last )
+  {
+    for ( ::std::size_t i = first; i < last; ++i )
+    {
+      ::std::size_t o;
+      T             lo;
+      T             hi;
+      if ( i + 1 < count )
+      {
+        const T middle = ( dk[ i + 1 ] - dk[i] ) / T( 2 );
+        T f = T( 1 );
+        for ( ::std::size_t j = 0; j < count; ++j )
+        {
+          f += rho * zk[j] * zk[j] / ( ( dk[j] - dk[i] ) - middle );
+        }
+        if ( f >= T( 0 ) )
+        {
+          o  = i;
+          lo = T( 0 );
+          hi = middle;
+        }
+        else
+        {
+          o  = i + 1;
+          lo = ( dk[i] - dk[ i + 1 ] ) + middle;
+          hi = T( 0 );
+        }
+      }
+      else
+      {
+        o  = i;
+        lo = T( 0 );
+        hi = rho * norm;
+      }
+      // Newton's method, safeguarded by bisection of the bracket
+      T tau = ( lo + hi ) / T( 2 );
+      for ( ::std::size_t iteration = 0; iteration < 200; ++iteration )
+      {
+        T g     = T( 1 );
+        T slope = T( 0 );
+        for ( ::std::size_t j = 0; j < count; ++j )
+        {
+          const T ratio = zk[j] / ( ( dk[j] - dk[o] ) - tau );
+          g     += rho * zk[j] * ratio;
+          slope += rho * ratio * ratio;
+        }
+        if ( g == T( 0 ) )
+        {
+          break;
+        }
+        ( ( g > T( 0 ) ) ? hi : lo ) = tau;
+        T next = tau - g / slope;
+        if ( !( ( next > lo ) && ( next < hi ) ) )
+        {
+          next = ( lo + hi ) / T( 2 );
+        }
+        const bool converged = ( ::std::abs( next - tau ) <= eps * ::std::abs( next ) ) ||
+                               ( hi - lo <= eps * ::std::max( ::std::abs( lo ), ::std::abs( hi ) ) );
+        tau = next;
+        if ( converged )
+        {
+          break;
+        }
+      }
+      origin[i] = o;
+      shift[i]  = tau;
+    }
+  } );
+  // lambda_i - d_j, accurate when lambda_i is close to d_j
+  const auto gap = [&]( ::std::size_t i, ::std::size_t j ) { return ( dk[ origin[i] ] - dk[j] ) + shift[i]; };
+  // Recompute z for which the computed roots are exact, so the eigenvectors are orthogonal
+  ::std::vector< T > z_hat( count );
+  for ( ::std::size_t j = 0; j < count; ++j )
+  {
+    T product = gap( j, j ) / rho;
+    for ( ::std::size_t i = 0; i < count; ++i )
+    {
+      if ( i != j )
+      {
+        product *= gap( i, j ) / ( dk[i] - dk[j] );
+      }
+    }
+    z_hat[j] = ::std::copysign( ::std::sqrt( ::std::abs( product ) ), zk[j] );
+  }
+  matrix_type u( extents_type( count, count ) );
+  for ( ::std::size_t i = 0; i < count; ++i )
+  {
+    T sum = T( 0 );
+    for ( ::std::size_t j = 0; j < count; ++j )
+    {
+      const T u_ji = -z_hat[j] / gap( i, j );
+      LINALG_DETAIL::access( u, j, i ) = u_ji;
+      sum += u_ji * u_ji;
+    }
+    const T scale = T( 1 ) / ::std::sqrt( sum );
+    for ( ::std::size_t j = 0; j < count; ++j )
+    {
+      LINALG_DETAIL::access( u, j, i ) *= scale;
+    }
+  }
+  // Eigenvectors of the kept components are Q( :, kept ) U
+  matrix_type q_kept( extents_type( n, count ) );
+  matrix_type vectors( extents_type( n, count ) );
+  for ( ::std::size_t row = 0; row < n; ++row )
+  {
+    for ( ::std::size_t j = 0; j < count; ++j )
+    {
+      LINALG_DETAIL::access( q_kept, row, j )  = LINALG_DETAIL::access( q, row, kept[j] );
+      LINALG_DETAIL::access( vectors, row, j ) = T( 0 );
+    }
+  }
+  block_product_update( make_block( vectors ), make_block( q_kept ), make_block( u ), T( 1 ) );
+  // Order all eigenpairs, kept ones being numbered after the deflated
+  ::std::vector< ::std::pair< T, ::std::size_t > > pairs;
+  pairs.reserve( n );
+  for ( ::std::size_t k : deflated )
+  {
+    pairs.emplace_back( values[k], k );
+  }
+  for ( ::std::size_t i = 0; i < count; ++i )
+  {
+    pairs.emplace_back( dk[ origin[i] ] + shift[i], n + i );
+  }
+  ::std::stable_sort( pairs.begin(), pairs.end(), []( const auto& x, const auto& y ) { return x.first < y.first; } );
+  matrix_type result( extents_type( n, n ) );
+  for ( ::std::size_t col = 0; col < n; ++col )
+  {
+    d[col] = pairs[col].first;
+    const ::std::size_t source = pairs[col].second;
+    for ( ::std::size_t row = 0; row < n; ++row )
+    {
+      LINALG_DETAIL::access( result, row, col ) = ( source < n ) ? LINALG_DETAIL::access( q, row, source ) : LINALG_DETAIL::access( vectors, row, source - n );
+    }
+  }
+  return result;
+}
+
+/// @brief Sorts the eigenvalues d in ascending order, permuting the columns of z to match
+template < class T >
+void sort_eigenpairs( T* d, ::std::size_t n, LINALG::dyn_tensor< T, 2 >& z )
+{
+  ::std::vector< ::std::size_t > order( n );
+  ::std::iota( order.begin(), order.end(), ::std::size_t( 0 ) );
+  ::std::stable_sort( order.begin(), order.end(), [&]( ::std::size_t x, ::std::size_t y ) { return d[x] < d[y]; } );
+  const ::std::vector< T > values( d, d + n );
+  const auto               vectors = z;
+  for ( ::std::size_t col = 0; col < n; ++col )
+  {
+    d[col] = values[ order[col] ];
+    for ( ::std::size_t row = 0; row < static_cast< ::std::size_t >( z.extent(0) ); ++row )
+    {
+      LINALG_DETAIL::access( z, row, col ) = LINALG_DETAIL::access( vectors, row, order[col] );
+    }
+  }
+}
+
+/// @brief Divide and conquer eigendecomposition of the tridiagonal matrix with diagonal d and subdiagonal e
+/// d is overwritten with the eigenvalues in ascending order, and the eigenvectors are returned as columns.
+template < class T >
+[[nodiscard]] LINALG::dyn_tensor< T, 2 > tridiagonal_divide_and_conquer( T* d, const T* e, ::std::size_t n )
+{
+  if ( n <= eigen_leaf_extent )
+  {
+    auto               q = identity_matrix< T >( n );
+    ::std::vector< T > subdiagonal( e, e + n );
+    subdiagonal[ n - 1 ] = T( 0 );
+    tridiagonal_ql( d, subdiagonal.data(), n, &q );
+    sort_eigenpairs( d, n, q );
+    return q;
+  }
+  // T = diag( T1, T2 ) + |rho| u u^T, u = e_m-1 + sign( rho ) e_m
+  const ::std::size_t m   = n / 2;
+  const T             rho = e[ m - 1 ];
+  const T             tear = ::std::abs( rho );
+  d[ m - 1 ] -= tear;
+  d[m]       -= tear;
+  LINALG::dyn_tensor< T, 2 > halves[2];
+  const ::std::size_t parts[2] = { 0, 1 };
+  // Cache the last exception to be thrown, a leaf which does not converge or a failed allocation
+  ::std::exception_ptr eptr;
+  const auto solve_half = [&]( ::std::size_t part ) noexcept
+  {
+    try
+    {
+      halves[part] = ( part == 0 ) ? tridiagonal_divide_and_conquer( d, e, m ) : tridiagonal_divide_and_conquer( d + m, e + m, n - m );
+    }
+    catch ( ... ) { eptr = ::std::current_exception(); }
+  };
+  if ( n * n * n < parallel_product_threshold )
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_SEQ, ::std::begin( parts ), ::std::end( parts ), solve_half );
+  }
+  else
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR, ::std::begin( parts ), ::std::end( parts ), solve_half );
+  }
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+  // Q = diag( Q1, Q2 ) and z = Q^T u, normalized
+  LINALG::dyn_tensor< T, 2 > q( typename LINALG::dyn_tensor< T, 2 >::extents_type( n, n ) );
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    for ( ::std::size_t j = 0; j < n; ++j )
+    {
+      LINALG_DETAIL::access( q, i, j ) = ( ( i < m ) == ( j < m ) ) ?
+        ( ( i < m ) ? LINALG_DETAIL::access( halves[0], i, j ) : LINALG_DETAIL::access( halves[1], i - m, j - m ) ) : T( 0 );
+    }
+  }
+  ::std::vector< T > z( n );
+  T norm = T( 0 );
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    z[i] = ( i < m ) ? LINALG_DETAIL::access( halves[0], m - 1, i ) : ::std::copysign( T( 1 ), rho ) * LINALG_DETAIL::access( halves[1], 0, i - m );
+    norm += z[i] * z[i];
+  }
+  const T scale = T( 1 ) / ::std::sqrt( norm );
+  for ( T& z_i : z )
+  {
+    z_i *= scale;
+  }
+  return rank_one_merge( d, z, tear * norm, q );
+}
+
+//--------------------
+//  Jacobi Rotations
+//--------------------
+
+/// @brief Diagonalizes the symmetric n x n block a in place by cyclic Jacobi rotations
+/// w receives the eigenvalues, unordered, and v the eigenvectors as columns.
+/// @throw domain_error if the rotations do not converge
+template < class A, class V, class T >
+void jacobi_eigen( const matrix_block< A >& a, const matrix_block< V >& v, T* w )
+{
+  const ::std::size_t n   = a.extent(0);
+  const T             eps = ::std::numeric_limits< T >::epsilon();
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    for ( ::std::size_t j = 0; j < n; ++j )
+    {
+      v( i, j ) = T( ( i == j ) ? 1 : 0 );
+    }
+  }
+  for ( ::std::size_t sweep = 0; ; ++sweep )
+  {
+    T off      = T( 0 );
+    T diagonal = T( 0 );
+    for ( ::std::size_t p = 0; p < n; ++p )
+    {
+      diagonal += a( p, p ) * a( p, p );
+      for ( ::std::size_t q = p + 1; q < n; ++q )
+      {
+        off += a( p, q ) * a( p, q );
+      }
+    }
+    if ( off <= eps * eps * diagonal )
+    {
+      break;
+    }
+    if ( sweep == jacobi_eigen_sweep_limit ) LINALG_UNLIKELY
+    {
+      throw ::std::domain_error( "Eigenvalue iteration did not converge." );
+    }
+    for ( ::std::size_t p = 0; p < n; ++p )
+    {
+      for ( ::std::size_t q = p + 1; q < n; ++q )
+      {
+        if ( a( p, q ) == T( 0 ) )
+        {
+          continue;
+        }
+        // Rotation annihilating a( p, q ), with the smaller angle
+        const T theta = ( a( q, q ) - a( p, p ) ) / ( T( 2 ) * a( p, q ) );
+        const T t     = ::std::copysign( T( 1 ), theta ) / ( ::std::abs( theta ) + ::std::sqrt( theta * theta + T( 1 ) ) );
+        const T c     = T( 1 ) / ::std::sqrt( t * t + T( 1 ) );
+        const T s     = t * c;
+        for ( ::std::size_t k = 0; k < n; ++k )
+        {
+          const T a_kp = a( k, p );
+          const T a_kq = a( k, q );
+          a( k, p ) = c * a_kp - s * a_kq;
+          a( k, q ) = s * a_kp + c * a_kq;
+        }
+        for ( ::std::size_t k = 0; k < n; ++k )
+        {
+          const T a_pk = a( p, k );
+          const T a_qk = a( q, k );
+          a( p, k ) = c * a_pk - s * a_qk;
+          a( q, k ) = s * a_pk + c * a_qk;
+        }
+        for ( ::std::size_t k = 0; k < n; ++k )
+        {
+          const T v_kp = v( k, p );
+          const T v_kq = v( k, q );
+          v( k, p ) = c * v_kp - s * v_kq;
+          v( k, q ) = s * v_kp + c * v_kq;
+        }
+      }
+    }
+  }
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    w[i] = a( i, i );
+  }
+}
+
+//----------------------
+//  Eigendecomposition
+//----------------------
+
+/// @brief Returns the static order of a matrix type, or dynamic_extent
+template < class Extents >
+inline constexpr ::std::size_t static_order_v = ( Extents::static_extent(0) == Extents::static_extent(1) ) ? Extents::static_extent(0) : ::std::dynamic_extent;
+
+/// @brief True if a matrix type is diagonalized by Jacobi rotations
+template < class Extents >
+inline constexpr bool is_jacobi_order_v = ( static_order_v< Extents > != ::std::dynamic_extent ) && ( static_order_v< Extents > <= jacobi_extent );
+
+/// @brief Returns a vector with the extent of the order of the matrix a
+/// @throw length_error if a is not square
+template < class Values, class Matrix >
+[[nodiscard]] Values make_eigenvalues( const Matrix& a )
+{
+  if ( a.extent(0) != a.extent(1) ) LINALG_UNLIKELY
+  {
+    throw ::std::length_error( "Tensor extents are incompatable." );
+  }
+  if constexpr ( Values::extents_type::rank_dynamic() == 0 )
+  {
+    return Values();
+  }
+  else
+  {
+    return Values( typename Values::extents_type( a.extent(0) ) );
+  }
+}
+
+/// @brief Eigenvalues, ascending, of the lower triangle of the n x n matrix a, and its eigenvectors if z is given
+template < class T, class Matrix >
+void symmetric_eigen_solve( const Matrix& a, ::std::size_t n, T* values, LINALG::dyn_tensor< T, 2 >* z )
+{
+  if ( n == 0 )
+  {
+    return;
+  }
+  // Work on a full symmetric copy, so the reduction reads rows
+  LINALG::dyn_tensor< T, 2 > work( typename LINALG::dyn_tensor< T, 2 >::extents_type( n, n ) );
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    for ( ::std::size_t j = 0; j <= i; ++j )
+    {
+      LINALG_DETAIL::access( work, i, j ) = LINALG_DETAIL::access( work, j, i ) = static_cast< T >( LINALG_DETAIL::access( a, i, j ) );
+    }
+  }
+  ::std::vector< T > e( n, T( 0 ) ), tau( n, T( 0 ) );
+  tridiagonalize( work, values, e.data(), tau.data() );
+  // The reduction is accurate relative to the norm of A only: split at subdiagonal elements negligible next to it
+  // beforehand, since QL iteration splits relative to the diagonal and stalls on clusters of eigenvalues near zero
+  T norm = T( 0 );
+  for ( ::std::size_t i = 0; i < n; ++i )
+  {
+    norm = ::std::max( norm, ::std::abs( values[i] ) + ::std::abs( e[i] ) );
+  }
+  for ( T& e_i : e )
+  {
+    if ( ::std::abs( e_i ) <= ::std::numeric_limits< T >::epsilon() * norm )
+    {
+      e_i = T( 0 );
+    }
+  }
+  if ( z == nullptr )
+  {
+    tridiagonal_ql( values, e.data(), n, static_cast< LINALG::dyn_tensor< T, 2 >* >( nullptr ) );
+    ::std::sort( values, values + n );
+    return;
+  }
+  *z = tridiagonal_divide_and_conquer( values, e.data(), n );
+  // Eigenvectors of A are Q times those of T, Q = diag( 1, H_0 H_1 ... H_n-2 )
+  if ( n > 1 )
+  {
+    const auto factors = LINALG_DETAIL::make_block( work ).block( 1, 0, n - 1, n - 1 );
+    apply_householder_q< false >( factors, tau.data(), LINALG_DETAIL::make_block( *z ).block( 1, 0, n - 1, n ) );
+  }
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//--------------------------------
+//  Symmetric Eigendecomposition
+//--------------------------------
+
+/// @brief Eigendecomposition A = V diag( w ) V^T of a real symmetric matrix, with the eigenvalues w ascending
+/// @tparam Matrix decomposed matrix type
+template < class Matrix >
+class symmetric_eigendecomposition
+{
+  public:
+    //- Aliases
+    using matrix_type  = ::std::decay_t< Matrix >;
+    using value_type   = ::std::remove_cv_t< typename matrix_type::value_type >;
+    using extents_type = typename matrix_type::extents_type;
+    using values_type  = typename LINALG_DETAIL::solution_type< value_type, ::std::extents< typename extents_type::index_type, extents_type::static_extent(0) > >::type;
+    using vectors_type = LINALG_DETAIL::solution_type_t< value_type, matrix_type >;
+
+    //- Constructors
+    /// @brief Decomposes the lower triangle of a
+    /// @throw length_error if a is not square
+    /// @throw domain_error if an eigenvalue does not converge
+    explicit symmetric_eigendecomposition( const matrix_type& a ) :
+      values_( LINALG_DETAIL::make_eigenvalues< values_type >( a ) ), vectors_( LINALG_DETAIL::make_solution< value_type >( a ) )
+    {
+      [[maybe_unused]] const ::std::size_t n = static_cast< ::std::size_t >( a.extent(0) );
+      if constexpr ( LINALG_DETAIL::is_jacobi_order_v< extents_type > )
+      {
+        constexpr ::std::size_t N = LINALG_DETAIL::static_order_v< extents_type >;
+        LINALG::fs_matrix< value_type, N, N > elements;
+        LINALG::fs_matrix< value_type, N, N > v;
+        ::std::array< value_type, N >         w {};
+        for ( ::std::size_t i = 0; i < N; ++i )
+        {
+          for ( ::std::size_t j = 0; j <= i; ++j )
+          {
+            LINALG_DETAIL::access( elements, i, j ) = LINALG_DETAIL::access( elements, j, i ) = static_cast< value_type >( LINALG_DETAIL::access( a, i, j ) );
+          }
+        }
+        LINALG_DETAIL::jacobi_eigen( LINALG_DETAIL::make_block( elements ), LINALG_DETAIL::make_block( v ), w.data() );
+        // Order the eigenpairs by eigenvalue
+        ::std::array< ::std::size_t, N > order {};
+        ::std::iota( order.begin(), order.end(), ::std::size_t( 0 ) );
+        ::std::sort( order.begin(), order.end(), [&]( ::std::size_t x, ::std::size_t y ) { return w[x] < w[y]; } );
+        for ( ::std::size_t j = 0; j < N; ++j )
+        {
+          LINALG_DETAIL::access( this->values_, j ) = w[ order[j] ];
+          for ( ::std::size_t i = 0; i < N; ++i )
+          {
+            LINALG_DETAIL::access( this->vectors_, i, j ) = LINALG_DETAIL::access( v, i, order[j] );
+          }
+        }
+      }
+      else
+      {
+        ::std::vector< value_type > w( n );
+        LINALG::dyn_tensor< value_type, 2 > z;
+        LINALG_DETAIL::symmetric_eigen_solve( a, n, w.data(), &z );
+        for ( ::std::size_t j = 0; j < n; ++j )
+        {
+          LINALG_DETAIL::access( this->values_, j ) = w[j];
+          for ( ::std::size_t i = 0; i < n; ++i )
+          {
+            LINALG_DETAIL::access( this->vectors_, i, j ) = LINALG_DETAIL::access( z, i, j );
+          }
+        }
+      }
+    }
+
+    //- Decomposition
+    /// @brief Returns the eigenvalues in ascending order
+    [[nodiscard]] constexpr const values_type& values() const noexcept { return this->values_; }
+    /// @brief Returns the orthonormal eigenvectors as columns, in the order of the eigenvalues
+    [[nodiscard]] constexpr const vectors_type& vectors() const noexcept { return this->vectors_; }
+
+  private:
+    //- Data
+    values_type  values_;
+    vectors_type vectors_;
+};
+
+//--------------------------
+//  Symmetric Eigensolvers
+//--------------------------
+
+/// @brief Returns the eigendecomposition of a real symmetric matrix, reading only its lower triangle
+/// @throw length_error if a is not square
+/// @throw domain_error if an eigenvalue does not converge
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::matrix_expression< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] symmetric_eigendecomposition< Matrix > symmetric_eigen( const Matrix& a )
+{
+  return symmetric_eigendecomposition< Matrix >( a );
+}
+
+/// @brief Returns the eigenvalues, ascending, of a real symmetric matrix, reading only its lower triangle
+/// The eigenvectors are never formed: the tridiagonal matrix is solved by QL iteration alone.
+/// @throw length_error if a is not square
+/// @throw domain_error if an eigenvalue does not converge
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix >
+  requires ( LINALG_CONCEPTS::matrix_expression< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > )
+#else
+template < class Matrix,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< Matrix > && ::std::is_floating_point_v< ::std::remove_cv_t< typename Matrix::value_type > > > >
+#endif
+[[nodiscard]] auto symmetric_eigenvalues( const Matrix& a )
+{
+  using decomposition_type = symmetric_eigendecomposition< Matrix >;
+  using value_type         = typename decomposition_type::value_type;
+  if constexpr ( LINALG_DETAIL::is_jacobi_order_v< typename decomposition_type::extents_type > )
+  {
+    return decomposition_type( a ).values();
+  }
+  else
+  {
+    auto                        values = LINALG_DETAIL::make_eigenvalues< typename decomposition_type::values_type >( a );
+    const ::std::size_t         n      = static_cast< ::std::size_t >( a.extent(0) );
+    ::std::vector< value_type > w( n );
+    LINALG_DETAIL::symmetric_eigen_solve( a, n, w.data(), static_cast< LINALG::dyn_tensor< value_type, 2 >* >( nullptr ) );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      LINALG_DETAIL::access( values, i ) = w[i];
+    }
+    return values;
+  }
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_SYMMETRIC_EIGEN_HPP
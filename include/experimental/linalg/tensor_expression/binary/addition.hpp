@@ -6,6 +6,8 @@
 //              LINALG::allocator_result< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor > >
 //              LINALG::layout_result< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor > >
 //              LINALG::is_alias_assignable< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor > >
+//              LINALG::is_commutative< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor > >
+//              LINALG::is_associative< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor >, TE >
 //              LINALG_EXPRESSIONS_DETAIL::addition_tensor_expression_traits< FirstTensor, SecondTensor >
 //              LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor >
 //              LINALG::operator + ( const T1& t1, const T2& t2 )
@@ -227,6 +229,33 @@ struct is_alias_assignable< LINALG_EXPRESSIONS::addition_tensor_expression< Firs
                                                      ::std::true_type > >
 { };
 
+//------------------
+//  Is Commutative
+//------------------
+
+// Addition may be evaluated with its operands in either order
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class FirstTensor, class SecondTensor >
+struct is_commutative< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor > > : public ::std::true_type { };
+#else
+template < class FirstTensor, class SecondTensor, class Enable >
+struct is_commutative< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor, Enable > > : public ::std::true_type { };
+#endif
+
+//------------------
+//  Is Associative
+//------------------
+
+// Nested additions may be regrouped
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class FirstTensor, class SecondTensor, class TE >
+  requires ( LINALG_EXPRESSIONS_DETAIL::is_addition_expression_v< TE > )
+struct is_associative< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor >, TE > : public ::std::true_type { };
+#else
+template < class FirstTensor, class SecondTensor, class Enable, class TE >
+struct is_associative< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor, Enable >, TE, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_addition_expression_v< TE > > > : public ::std::true_type { };
+#endif
+
 LINALG_END // linalg namespace
 
 LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
@@ -5,8 +5,12 @@
 //              LINALG::accessor_result< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix > >
 //              LINALG::allocator_result< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix > >
 //              LINALG::layout_result< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix > >
+//              LINALG::is_associative< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix >, TE >
+//              LINALG::is_left_distributive< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix >, TE >
+//              LINALG::is_right_distributive< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix >, TE >
 //              LINALG_EXPRESSIONS_DETAIL::matrix_product_expression_traits< FirstMatrix, SecondMatrix >
 //              LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix >
+//              LINALG::in_place_assignment< Tensor, LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix > >
 //              LINALG::operator * ( const M1& m1, const M2& m2 )
 //              LINALG::operator *= ( M1& m1, const M2& m2 )
 //==================================================================================================
@@ -197,6 +201,44 @@ public:
 
 #endif
 
+//------------------
+//  Is Associative
+//------------------
+
+// A product of matrix products may be regrouped, ( a * b ) * c = a * ( b * c )
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class FirstMatrix, class SecondMatrix, class TE >
+  requires ( LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< TE > )
+struct is_associative< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix >, TE > : public ::std::true_type { };
+#else
+template < class FirstMatrix, class SecondMatrix, class Enable, class TE >
+struct is_associative< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix, Enable >, TE, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< TE > > > : public ::std::true_type { };
+#endif
+
+//-------------------
+//  Is Distributive
+//-------------------
+
+// Matrix products distribute over sums of matrices, a * ( b + c ) = a * b + a * c
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class FirstMatrix, class SecondMatrix, class TE >
+  requires ( LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > )
+struct is_left_distributive< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix >, TE > : public ::std::true_type { };
+#else
+template < class FirstMatrix, class SecondMatrix, class Enable, class TE >
+struct is_left_distributive< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix, Enable >, TE, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > > > : public ::std::true_type { };
+#endif
+
+// ( b + c ) * a = b * a + c * a
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class FirstMatrix, class SecondMatrix, class TE >
+  requires ( LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > )
+struct is_right_distributive< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix >, TE > : public ::std::true_type { };
+#else
+template < class FirstMatrix, class SecondMatrix, class Enable, class TE >
+struct is_right_distributive< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix, Enable >, TE, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > > > : public ::std::true_type { };
+#endif
+
 LINALG_END // linalg namespace
 
 LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
@@ -307,22 +349,46 @@ class matrix_product_expression :
       noexcept( noexcept( LINALG_DETAIL::access( ::std::declval< FirstMatrix >(), index1, ::std::declval< index_type >() ) ) &&
                 noexcept( LINALG_DETAIL::access( ::std::declval< SecondMatrix >(), ::std::declval< index_type >(), index2 ) ) )
     {
-      value_type val { 0 };
-      if constexpr ( ::std::remove_reference_t< FirstMatrix >::static_extent(1) != ::std::dynamic_extent )
+      // Accumulate in a possibly wider type so long reductions neither lose precision nor overflow
+      using accumulator_type = LINALG::accumulation_result_t< self_type >;
+      // Read through transposed, conjugated, negated or scaled operands to their leaves, applying the scaling once
+      using first_operand    = LINALG_EXPRESSIONS_DETAIL::product_operand_t< FirstMatrix >;
+      using second_operand   = LINALG_EXPRESSIONS_DETAIL::product_operand_t< SecondMatrix >;
+      const auto& a = first_operand::leaf( this->m1_ );
+      const auto& b = second_operand::leaf( this->m2_ );
+      accumulator_type val { 0 };
+      constexpr ::std::size_t inner_extent = ( ::std::remove_reference_t< FirstMatrix >::static_extent(1) != ::std::dynamic_extent ) ?
+                                             ::std::remove_reference_t< FirstMatrix >::static_extent(1) :
+                                             ::std::remove_reference_t< SecondMatrix >::static_extent(0);
+      if constexpr ( LINALG_DETAIL::is_unrollable_extent_v< inner_extent > )
+      {
+        // Fully unroll the dot product for small static extents
+        LINALG_DETAIL::constexpr_for< ::std::size_t( 0 ), inner_extent, ::std::size_t( 1 ) >( [&]( auto count ) constexpr
+          { val += accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< FirstMatrix >( a, index1, count ) ) *
+                   accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< SecondMatrix >( b, count, index2 ) ); } );
+      }
+      else if constexpr ( ::std::remove_reference_t< FirstMatrix >::static_extent(1) != ::std::dynamic_extent )
       {
         for ( typename ::std::remove_reference_t< FirstMatrix >::index_type count = 0; count < this->m1_.extent(1); ++count )
         {
-          val += LINALG_DETAIL::access( this->m1_, index1, count ) * LINALG_DETAIL::access( this->m2_, count, index2 );
+          val += accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< FirstMatrix >( a, index1, count ) ) *
+                 accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< SecondMatrix >( b, count, index2 ) );
         }
       }
       else
       {
         for ( typename ::std::remove_reference_t< SecondMatrix >::index_type count = 0; count < this->m2_.extent(0); ++count )
         {
-          val += LINALG_DETAIL::access( this->m1_, index1, count ) * LINALG_DETAIL::access( this->m2_, count, index2 );
+          val += accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< FirstMatrix >( a, index1, count ) ) *
+                 accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< SecondMatrix >( b, count, index2 ) );
         }
       }
-      return val;
+      if constexpr ( first_operand::scaled || second_operand::scaled )
+      {
+        val = LINALG_EXPRESSIONS_DETAIL::operand_alpha< FirstMatrix, accumulator_type >( this->m1_ ) *
+              LINALG_EXPRESSIONS_DETAIL::operand_alpha< SecondMatrix, accumulator_type >( this->m2_ ) * val;
+      }
+      return static_cast< value_type >( val );
     }
     // Define noexcept specification of conversion operator
     [[nodiscard]] static inline constexpr bool conversion_is_noexcept() noexcept
@@ -382,8 +448,147 @@ class matrix_product_expression :
 
 LINALG_EXPRESSIONS_END // end expressions namespace
 
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//-----------------------------
+//  In Place Matrix Products
+//-----------------------------
+
+// Number of rows or columns of the result buffered at a time by the in place products
+inline constexpr ::std::size_t in_place_panel_extent = 8;
+
+// Computes a = a * b for square b, buffering one panel of rows of the result at a time
+template < class Accumulator, class Matrix, class OtherMatrix >
+void right_multiply_in_place( Matrix& a, const OtherMatrix& b )
+{
+  using index_type = typename Matrix::index_type;
+  using value_type = typename Matrix::value_type;
+  const index_type rows  = a.extent(0);
+  const index_type cols  = a.extent(1);
+  const index_type panel = static_cast< index_type >( ::std::min( static_cast< ::std::size_t >( rows ), in_place_panel_extent ) );
+  ::std::vector< Accumulator > buffer( static_cast< ::std::size_t >( panel ) * static_cast< ::std::size_t >( cols ) );
+  for ( index_type first_row = 0; first_row < rows; first_row += panel )
+  {
+    const index_type height = ::std::min( panel, static_cast< index_type >( rows - first_row ) );
+    ::std::fill( buffer.begin(), buffer.end(), Accumulator( 0 ) );
+    // Each row of b is reused across the panel
+    for ( index_type k = 0; k < cols; ++k )
+    {
+      for ( index_type r = 0; r < height; ++r )
+      {
+        const Accumulator a_rk = Accumulator( LINALG_DETAIL::access( a, first_row + r, k ) );
+        Accumulator*      row  = buffer.data() + static_cast< ::std::size_t >( r ) * cols;
+        for ( index_type j = 0; j < cols; ++j )
+        {
+          row[j] += a_rk * Accumulator( LINALG_DETAIL::access( b, k, j ) );
+        }
+      }
+    }
+    // The panel rows of a are no longer needed so may be overwritten
+    for ( index_type r = 0; r < height; ++r )
+    {
+      for ( index_type j = 0; j < cols; ++j )
+      {
+        LINALG_DETAIL::access( a, first_row + r, j ) = static_cast< value_type >( buffer[ static_cast< ::std::size_t >( r ) * cols + j ] );
+      }
+    }
+  }
+}
+
+// Computes a = b * a for square b, buffering one panel of columns of the result at a time
+template < class Accumulator, class Matrix, class OtherMatrix >
+void left_multiply_in_place( const OtherMatrix& b, Matrix& a )
+{
+  using index_type = typename Matrix::index_type;
+  using value_type = typename Matrix::value_type;
+  const index_type rows  = a.extent(0);
+  const index_type cols  = a.extent(1);
+  const index_type panel = static_cast< index_type >( ::std::min( static_cast< ::std::size_t >( cols ), in_place_panel_extent ) );
+  ::std::vector< Accumulator > buffer( static_cast< ::std::size_t >( rows ) * static_cast< ::std::size_t >( panel ) );
+  for ( index_type first_col = 0; first_col < cols; first_col += panel )
+  {
+    const index_type width = ::std::min( panel, static_cast< index_type >( cols - first_col ) );
+    ::std::fill( buffer.begin(), buffer.end(), Accumulator( 0 ) );
+    for ( index_type i = 0; i < rows; ++i )
+    {
+      Accumulator* row = buffer.data() + static_cast< ::std::size_t >( i ) * panel;
+      for ( index_type k = 0; k < rows; ++k )
+      {
+        const Accumulator b_ik = Accumulator( LINALG_DETAIL::access( b, i, k ) );
+        for ( index_type c = 0; c < width; ++c )
+        {
+          row[c] += b_ik * Accumulator( LINALG_DETAIL::access( a, k, first_col + c ) );
+        }
+      }
+    }
+    // The panel columns of a are no longer needed so may be overwritten
+    for ( index_type i = 0; i < rows; ++i )
+    {
+      for ( index_type c = 0; c < width; ++c )
+      {
+        LINALG_DETAIL::access( a, i, first_col + c ) = static_cast< value_type >( buffer[ static_cast< ::std::size_t >( i ) * panel + c ] );
+      }
+    }
+  }
+}
+
+template < class Tensor, class Expression >
+[[nodiscard]] bool matrix_product_in_place( Tensor& t, const Expression& expr )
+{
+  using accumulator_type = LINALG::accumulation_result_t< Expression >;
+  if ( LINALG_IS_CONSTANT_EVALUATED() ||
+       ( static_cast< ::std::size_t >( t.extent(0) ) != static_cast< ::std::size_t >( expr.extent(0) ) ) ||
+       ( static_cast< ::std::size_t >( t.extent(1) ) != static_cast< ::std::size_t >( expr.extent(1) ) ) )
+  {
+    return false;
+  }
+  // t = t * m2, which requires m2 to be square since the extents are unchanged
+  if ( LINALG_DETAIL::is_same_view( expr.first(), t ) && !LINALG_DETAIL::overlaps( expr.second(), t ) )
+  {
+    right_multiply_in_place< accumulator_type >( t, expr.second() );
+    return true;
+  }
+  // t = m1 * t, which requires m1 to be square since the extents are unchanged
+  if ( LINALG_DETAIL::is_same_view( expr.second(), t ) && !LINALG_DETAIL::overlaps( expr.first(), t ) )
+  {
+    left_multiply_in_place< accumulator_type >( expr.first(), t );
+    return true;
+  }
+  return false;
+}
+
+LINALG_DETAIL_END
+
 LINALG_BEGIN // linalg namespace
 
+//-----------------------
+//  In Place Assignment
+//-----------------------
+
+#ifdef LINALG_ENABLE_CONCEPTS
+
+template < class Tensor, class FirstMatrix, class SecondMatrix >
+struct in_place_assignment< Tensor, LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix > >
+{
+  [[nodiscard]] static bool apply( Tensor& t, const LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix >& expr )
+  {
+    return LINALG_DETAIL::matrix_product_in_place( t, expr );
+  }
+};
+
+#else
+
+template < class Tensor, class FirstMatrix, class SecondMatrix, class Enable >
+struct in_place_assignment< Tensor, LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix, Enable > >
+{
+  [[nodiscard]] static bool apply( Tensor& t, const LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix, Enable >& expr )
+  {
+    return LINALG_DETAIL::matrix_product_in_place( t, expr );
+  }
+};
+
+#endif
+
 //-----------------------------
 //  Matrix product operators
 //-----------------------------
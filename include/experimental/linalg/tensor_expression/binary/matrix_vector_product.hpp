@@ -5,6 +5,9 @@
 //              LINALG::accessor_result< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector > >
 //              LINALG::allocator_result< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector > >
 //              LINALG::layout_result< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector > >
+//              LINALG::is_associative< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector >, TE >
+//              LINALG::is_left_distributive< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector >, TE >
+//              LINALG::is_right_distributive< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector >, TE >
 //              LINALG_EXPRESSIONS_DETAIL::vector_matrix_product_expression_traits< Vector, Matrix >
 //              LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector >
 //              LINALG::operator * ( const M& m, const V& v )
@@ -201,6 +204,45 @@ public:
 
 #endif
 
+//------------------
+//  Is Associative
+//------------------
+
+// A matrix vector product of a matrix product, or of a matrix vector product, may be regrouped,
+// ( a * b ) * x = a * ( b * x )
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix, class Vector, class TE >
+  requires ( LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< TE > || LINALG_EXPRESSIONS_DETAIL::is_matrix_vector_product_expression_v< TE > )
+struct is_associative< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector >, TE > : public ::std::true_type { };
+#else
+template < class Matrix, class Vector, class Enable, class TE >
+struct is_associative< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector, Enable >, TE, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< TE > || LINALG_EXPRESSIONS_DETAIL::is_matrix_vector_product_expression_v< TE > > > : public ::std::true_type { };
+#endif
+
+//-------------------
+//  Is Distributive
+//-------------------
+
+// Matrix vector products distribute over sums of vectors, a * ( x + y ) = a * x + a * y
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix, class Vector, class TE >
+  requires ( LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > )
+struct is_left_distributive< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector >, TE > : public ::std::true_type { };
+#else
+template < class Matrix, class Vector, class Enable, class TE >
+struct is_left_distributive< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector, Enable >, TE, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > > > : public ::std::true_type { };
+#endif
+
+// ( a + b ) * x = a * x + b * x
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Matrix, class Vector, class TE >
+  requires ( LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > )
+struct is_right_distributive< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector >, TE > : public ::std::true_type { };
+#else
+template < class Matrix, class Vector, class Enable, class TE >
+struct is_right_distributive< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector, Enable >, TE, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > > > : public ::std::true_type { };
+#endif
+
 LINALG_END // linalg namespace
 
 LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
@@ -310,22 +352,43 @@ class matrix_vector_product_expression :
       noexcept( noexcept( LINALG_DETAIL::access( ::std::declval< Matrix >(), index, ::std::declval< index_type >() ) ) &&
                 noexcept( LINALG_DETAIL::access( ::std::declval< Vector >(), ::std::declval< index_type >() ) ) )
     {
-      value_type val { 0 };
-      if constexpr ( ::std::remove_reference_t< Vector >::static_extent(0) != ::std::dynamic_extent )
+      // Accumulate in a possibly wider type so long reductions neither lose precision nor overflow
+      using accumulator_type = LINALG::accumulation_result_t< self_type >;
+      // Read through transposed, conjugated, negated or scaled operands to their leaves, applying the scaling once
+      using matrix_operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< Matrix >;
+      using vector_operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< Vector >;
+      const auto& m = matrix_operand::leaf( this->m_ );
+      const auto& v = vector_operand::leaf( this->v_ );
+      accumulator_type val { 0 };
+      constexpr ::std::size_t inner_extent = ( ::std::remove_reference_t< Vector >::static_extent(0) != ::std::dynamic_extent ) ?
+                                             ::std::remove_reference_t< Vector >::static_extent(0) :
+                                             ::std::remove_reference_t< Matrix >::static_extent(1);
+      if constexpr ( LINALG_DETAIL::is_unrollable_extent_v< inner_extent > )
+      {
+        // Fully unroll the dot product for small static extents
+        LINALG_DETAIL::constexpr_for< ::std::size_t( 0 ), inner_extent, ::std::size_t( 1 ) >( [&]( auto count ) constexpr
+          { val += accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Matrix >( m, index, count ) ) * accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Vector >( v, count ) ); } );
+      }
+      else if constexpr ( ::std::remove_reference_t< Vector >::static_extent(0) != ::std::dynamic_extent )
       {
         for ( typename ::std::remove_reference_t< Vector >::index_type count = 0; count < this->v_.extent(0); ++count )
         {
-          val += LINALG_DETAIL::access( this->m_, index, count ) * LINALG_DETAIL::access( this->v_, count );
+          val += accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Matrix >( m, index, count ) ) * accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Vector >( v, count ) );
         }
       }
       else
       {
         for ( typename ::std::remove_reference_t< Matrix >::index_type count = 0; count < this->m_.extent(1); ++count )
         {
-          val += LINALG_DETAIL::access( this->m_, index, count ) * LINALG_DETAIL::access( this->v_, count );
+          val += accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Matrix >( m, index, count ) ) * accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Vector >( v, count ) );
         }
       }
-      return val;
+      if constexpr ( matrix_operand::scaled || vector_operand::scaled )
+      {
+        val = LINALG_EXPRESSIONS_DETAIL::operand_alpha< Matrix, accumulator_type >( this->m_ ) *
+              LINALG_EXPRESSIONS_DETAIL::operand_alpha< Vector, accumulator_type >( this->v_ ) * val;
+      }
+      return static_cast< value_type >( val );
     }
     // Define noexcept specification of conversion operator
     [[nodiscard]] static inline constexpr bool conversion_is_noexcept() noexcept
@@ -309,7 +309,28 @@ operator / ( const T& t, const S& s ) noexcept
   requires ::std::is_constructible_v< LINALG_EXPRESSIONS::scalar_division_tensor_expression< const T&, const S& >, const T&, const S& >
 #endif
 {
-  return LINALG_EXPRESSIONS::scalar_division_tensor_expression< const T&, const S& >( t, s );
+  using value_type = typename T::value_type;
+  // Where allowed, fold the divisor into a scalar factor or multiply by its reciprocal
+  if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_reciprocal_divisible_v< value_type, S > &&
+                 LINALG_EXPRESSIONS_DETAIL::is_scalar_postprod_expression_v< T > &&
+                 LINALG_EXPRESSIONS_DETAIL::scalars_are_foldable_v< S, LINALG_EXPRESSIONS_DETAIL::expression_scalar_t< T > > )
+  {
+    return LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< decltype( t.first() ), ::std::decay_t< S > >( t.first(), t.second() / s );
+  }
+  else if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_reciprocal_divisible_v< value_type, S > &&
+                      LINALG_EXPRESSIONS_DETAIL::is_scalar_preprod_expression_v< T > &&
+                      LINALG_EXPRESSIONS_DETAIL::scalars_are_foldable_v< S, LINALG_EXPRESSIONS_DETAIL::expression_scalar_t< T > > )
+  {
+    return LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< ::std::decay_t< S >, decltype( t.second() ) >( t.first() / s, t.second() );
+  }
+  else if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_reciprocal_divisible_v< value_type, S > )
+  {
+    return LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< const T&, ::std::decay_t< S > >( t, ::std::decay_t< S >( 1 ) / s );
+  }
+  else
+  {
+    return LINALG_EXPRESSIONS::scalar_division_tensor_expression< const T&, const S& >( t, s );
+  }
 }
 
 #ifdef LINALG_ENABLE_CONCEPTS
@@ -283,9 +283,9 @@ class scalar_postprod_tensor_expression :
       return evaluated_type( *this );
     }
   private:
-    // Data
+    // Data, with the scalar held by value when it was folded from several factors
     Tensor& t_;
-    Scalar& s_;
+    Scalar  s_;
 };
 
 LINALG_EXPRESSIONS_END // end expressions namespace
@@ -310,7 +310,21 @@ operator * ( const T& t, const S& s ) noexcept
   requires ::std::is_constructible_v< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< const T&, const S& >, const T&, const S& >
 #endif
 {
-  return LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< const T&, const S& >( t, s );
+  // Fold chained scalar factors into a single factor
+  if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_scalar_postprod_expression_v< T > &&
+                 LINALG_EXPRESSIONS_DETAIL::scalars_are_foldable_v< S, LINALG_EXPRESSIONS_DETAIL::expression_scalar_t< T > > )
+  {
+    return LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< decltype( t.first() ), ::std::decay_t< S > >( t.first(), t.second() * s );
+  }
+  else if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_scalar_preprod_expression_v< T > &&
+                      LINALG_EXPRESSIONS_DETAIL::scalars_are_foldable_v< S, LINALG_EXPRESSIONS_DETAIL::expression_scalar_t< T > > )
+  {
+    return LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< ::std::decay_t< S >, decltype( t.second() ) >( t.first() * s, t.second() );
+  }
+  else
+  {
+    return LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< const T&, const S& >( t, s );
+  }
 }
 
 #ifdef LINALG_ENABLE_CONCEPTS
@@ -282,8 +282,8 @@ class scalar_preprod_tensor_expression :
       return evaluated_type( *this );
     }
   private:
-    // Data
-    Scalar& s_;
+    // Data, with the scalar held by value when it was folded from several factors
+    Scalar  s_;
     Tensor& t_;
 };
 
@@ -308,7 +308,21 @@ operator * ( const S& s, const T& t ) noexcept
   requires ::std::is_constructible_v< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< const S&, const T& >, const S&, const T& >
 #endif
 {
-  return LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< const S&, const T& >( s, t );
+  // Fold chained scalar factors into a single factor
+  if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_scalar_preprod_expression_v< T > &&
+                 LINALG_EXPRESSIONS_DETAIL::scalars_are_foldable_v< S, LINALG_EXPRESSIONS_DETAIL::expression_scalar_t< T > > )
+  {
+    return LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< ::std::decay_t< S >, decltype( t.second() ) >( s * t.first(), t.second() );
+  }
+  else if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_scalar_postprod_expression_v< T > &&
+                      LINALG_EXPRESSIONS_DETAIL::scalars_are_foldable_v< S, LINALG_EXPRESSIONS_DETAIL::expression_scalar_t< T > > )
+  {
+    return LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< ::std::decay_t< S >, decltype( t.first() ) >( s * t.second(), t.first() );
+  }
+  else
+  {
+    return LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< const S&, const T& >( s, t );
+  }
 }
 
 LINALG_END // linalg namespace
@@ -5,6 +5,9 @@
 //              LINALG::accessor_result< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix > >
 //              LINALG::allocator_result< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix > >
 //              LINALG::layout_result< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix > >
+//              LINALG::is_associative< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix >, TE >
+//              LINALG::is_left_distributive< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix >, TE >
+//              LINALG::is_right_distributive< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix >, TE >
 //              LINALG_EXPRESSIONS_DETAIL::vector_matrix_product_expression_traits< Vector, Matrix >
 //              LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix >
 //              LINALG::operator * ( const V& v, const M& m )
@@ -202,6 +205,45 @@ public:
 
 #endif
 
+//------------------
+//  Is Associative
+//------------------
+
+// A vector matrix product of a matrix product, or of a vector matrix product, may be regrouped,
+// x * ( a * b ) = ( x * a ) * b
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Vector, class Matrix, class TE >
+  requires ( LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< TE > || LINALG_EXPRESSIONS_DETAIL::is_vector_matrix_product_expression_v< TE > )
+struct is_associative< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix >, TE > : public ::std::true_type { };
+#else
+template < class Vector, class Matrix, class Enable, class TE >
+struct is_associative< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix, Enable >, TE, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression_v< TE > || LINALG_EXPRESSIONS_DETAIL::is_vector_matrix_product_expression_v< TE > > > : public ::std::true_type { };
+#endif
+
+//-------------------
+//  Is Distributive
+//-------------------
+
+// Vector matrix products distribute over sums of matrices, x * ( a + b ) = x * a + x * b
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Vector, class Matrix, class TE >
+  requires ( LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > )
+struct is_left_distributive< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix >, TE > : public ::std::true_type { };
+#else
+template < class Vector, class Matrix, class Enable, class TE >
+struct is_left_distributive< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix, Enable >, TE, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > > > : public ::std::true_type { };
+#endif
+
+// ( x + y ) * a = x * a + y * a
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Vector, class Matrix, class TE >
+  requires ( LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > )
+struct is_right_distributive< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix >, TE > : public ::std::true_type { };
+#else
+template < class Vector, class Matrix, class Enable, class TE >
+struct is_right_distributive< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix, Enable >, TE, ::std::enable_if_t< LINALG_EXPRESSIONS_DETAIL::is_sum_expression_v< TE > > > : public ::std::true_type { };
+#endif
+
 LINALG_END // linalg namespace
 
 LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
@@ -311,22 +353,43 @@ class vector_matrix_product_expression :
       noexcept( noexcept( LINALG_DETAIL::access( ::std::declval< Vector >(), ::std::declval< index_type >() ) ) &&
                 noexcept( LINALG_DETAIL::access( ::std::declval< Matrix >(), ::std::declval< index_type >(), index ) ) )
     {
-      value_type val { 0 };
-      if constexpr ( ::std::remove_reference_t< Vector >::static_extent(0) != ::std::dynamic_extent )
+      // Accumulate in a possibly wider type so long reductions neither lose precision nor overflow
+      using accumulator_type = LINALG::accumulation_result_t< self_type >;
+      // Read through transposed, conjugated, negated or scaled operands to their leaves, applying the scaling once
+      using vector_operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< Vector >;
+      using matrix_operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< Matrix >;
+      const auto& v = vector_operand::leaf( this->v_ );
+      const auto& m = matrix_operand::leaf( this->m_ );
+      accumulator_type val { 0 };
+      constexpr ::std::size_t inner_extent = ( ::std::remove_reference_t< Vector >::static_extent(0) != ::std::dynamic_extent ) ?
+                                             ::std::remove_reference_t< Vector >::static_extent(0) :
+                                             ::std::remove_reference_t< Matrix >::static_extent(0);
+      if constexpr ( LINALG_DETAIL::is_unrollable_extent_v< inner_extent > )
+      {
+        // Fully unroll the dot product for small static extents
+        LINALG_DETAIL::constexpr_for< ::std::size_t( 0 ), inner_extent, ::std::size_t( 1 ) >( [&]( auto count ) constexpr
+          { val += accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Vector >( v, count ) ) * accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Matrix >( m, count, index ) ); } );
+      }
+      else if constexpr ( ::std::remove_reference_t< Vector >::static_extent(0) != ::std::dynamic_extent )
       {
         for ( typename ::std::remove_reference_t< Vector >::index_type count = 0; count < this->v_.extent(0); ++count )
         {
-          val += LINALG_DETAIL::access( this->v_, count ) * LINALG_DETAIL::access( this->m_, count, index );
+          val += accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Vector >( v, count ) ) * accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Matrix >( m, count, index ) );
         }
       }
       else
       {
         for ( typename ::std::remove_reference_t< Matrix >::index_type count = 0; count < this->m_.extent(0); ++count )
         {
-          val += LINALG_DETAIL::access( this->v_, count ) * LINALG_DETAIL::access( this->m_, count, index );
+          val += accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Vector >( v, count ) ) * accumulator_type( LINALG_EXPRESSIONS_DETAIL::read_operand< Matrix >( m, count, index ) );
         }
       }
-      return val;
+      if constexpr ( vector_operand::scaled || matrix_operand::scaled )
+      {
+        val = LINALG_EXPRESSIONS_DETAIL::operand_alpha< Vector, accumulator_type >( this->v_ ) *
+              LINALG_EXPRESSIONS_DETAIL::operand_alpha< Matrix, accumulator_type >( this->m_ ) * val;
+      }
+      return static_cast< value_type >( val );
     }
     // Define noexcept specification of conversion operator
     [[nodiscard]] static inline constexpr bool conversion_is_noexcept() noexcept
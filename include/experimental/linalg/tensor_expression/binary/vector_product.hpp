@@ -8,7 +8,7 @@
 //              LINALG_EXPRESSIONS_DETAIL::outer_product_expression_traits< FirstVector, SecondVector >
 //              LINALG_EXPRESSIONS::outer_product_expression< FirstVector, SecondVector >
 //              LINALG::outer_product( const V1& v1, const V2& v2 )
-//              LINALG::inner_product( const V1& v1, const V2& v2 )
+//              LINALG::inner_prod< Accumulator >( const V1& v1, const V2& v2 )
 //==================================================================================================
 
 #ifndef LINEAR_ALGEBRA_TENSOR_EXPRESSION_BINARY_VECTOR_PRODUCT_HPP
@@ -374,10 +374,12 @@ outer_prod( const V1& v1, const V2& v2 ) noexcept
 //  Inner product operators
 //-----------------------------
 
+// The dot product is accumulated in accumulation_type_t of the element product type unless an
+// accumulator type is explicitly provided, e.g. inner_prod< double >( v1, v2 ).
 #ifdef LINALG_ENABLE_CONCEPTS
-template < class FirstVector, class SecondVector >
+template < class Accumulator = void, class FirstVector, class SecondVector >
 #else
-template < class FirstVector, class SecondVector,
+template < class Accumulator = void, class FirstVector, class SecondVector,
            typename = ::std::enable_if_t< LINALG_CONCEPTS::vector_expression_v< ::std::remove_reference_t< FirstVector > > &&
                                           LINALG_CONCEPTS::vector_expression_v< ::std::remove_reference_t< SecondVector > > &&
                                           LINALG_CONCEPTS::elements_are_multiplicative_v< ::std::remove_reference_t< FirstVector >, ::std::remove_reference_t< SecondVector > > &&
@@ -401,22 +403,33 @@ inner_prod( const FirstVector& v1, const SecondVector& v2 ) noexcept( LINALG_DET
       throw ::std::length_error( "Vector extents are incompatable." );
     }
   }
-  decltype( LINALG_DETAIL::access( v1, 0 ) * LINALG_DETAIL::access( v2, 0 ) ) val { 0 };
-  if constexpr ( ::std::remove_reference_t< SecondVector >::static_extent(0) == ::std::dynamic_extent )
+  using value_type       = decltype( LINALG_DETAIL::access( v1, 0 ) * LINALG_DETAIL::access( v2, 0 ) );
+  using accumulator_type = ::std::conditional_t< ::std::is_void_v< Accumulator >, LINALG::accumulation_type_t< value_type >, Accumulator >;
+  accumulator_type val { 0 };
+  constexpr ::std::size_t inner_extent = ( ::std::remove_reference_t< FirstVector >::static_extent(0) != ::std::dynamic_extent ) ?
+                                         ::std::remove_reference_t< FirstVector >::static_extent(0) :
+                                         ::std::remove_reference_t< SecondVector >::static_extent(0);
+  if constexpr ( LINALG_DETAIL::is_unrollable_extent_v< inner_extent > )
+  {
+    // Fully unroll the dot product for small static extents
+    LINALG_DETAIL::constexpr_for< ::std::size_t( 0 ), inner_extent, ::std::size_t( 1 ) >( [&]( auto count ) constexpr
+      { val += accumulator_type( LINALG_DETAIL::access( v1, count ) ) * accumulator_type( LINALG_DETAIL::access( v2, count ) ); } );
+  }
+  else if constexpr ( ::std::remove_reference_t< SecondVector >::static_extent(0) == ::std::dynamic_extent )
   {
     for ( typename ::std::remove_reference_t< FirstVector >::index_type count = 0; count < v1.extent(0); ++count )
     {
-      val += LINALG_DETAIL::access( v1, count ) * LINALG_DETAIL::access( v2, count );
+      val += accumulator_type( LINALG_DETAIL::access( v1, count ) ) * accumulator_type( LINALG_DETAIL::access( v2, count ) );
     }
   }
   else
   {
     for ( typename ::std::remove_reference_t< SecondVector >::index_type count = 0; count < v2.extent(0); ++count )
     {
-      val += LINALG_DETAIL::access( v1, count ) * LINALG_DETAIL::access( v2, count );
+      val += accumulator_type( LINALG_DETAIL::access( v1, count ) ) * accumulator_type( LINALG_DETAIL::access( v2, count ) );
     }
   }
-  return val;
+  return static_cast< value_type >( val );
 }
 
 LINALG_END // linalg namespace
@@ -0,0 +1,319 @@
+//==================================================================================================
+//  File:       epilogue.hpp
+//
+//  Summary:    This header defines:
+//              LINALG_DETAIL::product_rows< Accumulator >( const Expression& expr, WriteBack&& write_back )
+//              LINALG_EXPRESSIONS_DETAIL::has_epilogue_product< Expression >()
+//              LINALG_EXPRESSIONS_DETAIL::epilogue_product( const Expression& expr )
+//              LINALG_EXPRESSIONS_DETAIL::epilogue_element( const Expression& expr, const Value& product, i, j )
+//              LINALG_EXPRESSIONS_DETAIL::is_epilogue_safe( const Tensor& t, const Expression& expr )
+//              LINALG_EXPRESSIONS_DETAIL::fused_epilogue( Tensor& t, const Expression& expr )
+//
+//              A matrix product reached from the root of an assigned expression only through
+//              element-wise nodes (addition, subtraction, negation and scalar multiplication or
+//              division) is evaluated a row at a time, and the element-wise nodes are applied as each
+//              element of the product is written back. Assignments such as c = a * ( x * y ) + b * c
+//              or y = x * w + bias then make a single pass over the destination, with the terms which
+//              read the destination itself accumulated in place. Trees which read an inverse are left
+//              to solve_inverse_products, as reading its elements would form the explicit inverse.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_TENSOR_EXPRESSION_EPILOGUE_HPP
+#define LINEAR_ALGEBRA_TENSOR_EXPRESSION_EPILOGUE_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//----------------------
+//  Product Row Kernel
+//----------------------
+
+// Computes the matrix product a row at a time, handing each element to write_back( i, j, value ) once its row is complete.
+// Blocks of rows are independent, and are run in parallel for products above parallel_product_threshold.
+template < class Accumulator, class Expression, class WriteBack >
+void product_rows( const Expression& expr, WriteBack&& write_back )
+{
+  using first_type     = decltype( expr.first() );
+  using second_type    = decltype( expr.second() );
+  using first_operand  = LINALG_EXPRESSIONS_DETAIL::product_operand_t< first_type >;
+  using second_operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< second_type >;
+  const auto& a = first_operand::leaf( expr.first() );
+  const auto& b = second_operand::leaf( expr.second() );
+  Accumulator alpha = Accumulator( 1 );
+  if constexpr ( first_operand::scaled || second_operand::scaled )
+  {
+    alpha = LINALG_EXPRESSIONS_DETAIL::operand_alpha< first_type, Accumulator >( expr.first() ) *
+            LINALG_EXPRESSIONS_DETAIL::operand_alpha< second_type, Accumulator >( expr.second() );
+  }
+  const ::std::size_t rows    = static_cast< ::std::size_t >( expr.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( expr.extent(1) );
+  const ::std::size_t inner   = static_cast< ::std::size_t >( expr.first().extent(1) );
+  ::std::vector< ::std::size_t > blocks( ( rows + parallel_tile_extent - 1 ) / parallel_tile_extent );
+  ::std::iota( blocks.begin(), blocks.end(), ::std::size_t( 0 ) );
+  // Cache the last exception to be thrown
+  ::std::exception_ptr eptr;
+  const auto evaluate_block = [&]( ::std::size_t block ) noexcept
+  {
+    try
+    {
+      ::std::vector< Accumulator > row( columns );
+      const ::std::size_t last_row = ::std::min( rows, ( block + 1 ) * parallel_tile_extent );
+      for ( ::std::size_t i = block * parallel_tile_extent; i < last_row; ++i )
+      {
+        ::std::fill( row.begin(), row.end(), Accumulator( 0 ) );
+        for ( ::std::size_t k = 0; k < inner; ++k )
+        {
+          const Accumulator a_ik = Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< first_type >( a, i, k ) );
+          for ( ::std::size_t j = 0; j < columns; ++j )
+          {
+            row[j] += a_ik * Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< second_type >( b, k, j ) );
+          }
+        }
+        for ( ::std::size_t j = 0; j < columns; ++j )
+        {
+          write_back( i, j, alpha * row[j] );
+        }
+      }
+    }
+    catch ( ... ) { eptr = ::std::current_exception(); }
+  };
+  if ( rows * columns * inner < parallel_product_threshold )
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_SEQ, blocks.begin(), blocks.end(), evaluate_block );
+  }
+  else
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR, blocks.begin(), blocks.end(), evaluate_block );
+  }
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
+
+//----------------------
+//  Epilogue Structure
+//----------------------
+
+// True if a matrix product is reached from the root through element-wise nodes only
+// A product reading an inverse is not fused, since its kernel would read the inverse element by element.
+template < class Expression >
+[[nodiscard]] constexpr bool has_epilogue_product() noexcept
+{
+  using expression_type = ::std::decay_t< Expression >;
+  if constexpr ( is_matrix_product_expression_v< expression_type > )
+  {
+    return !reads_inverse< expression_type >();
+  }
+  else if constexpr ( is_sum_expression_v< expression_type > )
+  {
+    return has_epilogue_product< decltype( ::std::declval< const expression_type& >().first() ) >() ||
+           has_epilogue_product< decltype( ::std::declval< const expression_type& >().second() ) >();
+  }
+  else if constexpr ( is_scalar_preprod_expression_v< expression_type > )
+  {
+    return has_epilogue_product< decltype( ::std::declval< const expression_type& >().second() ) >();
+  }
+  else if constexpr ( is_scalar_postprod_expression_v< expression_type > || is_scalar_division_expression_v< expression_type > )
+  {
+    return has_epilogue_product< decltype( ::std::declval< const expression_type& >().first() ) >();
+  }
+  else if constexpr ( is_negate_expression_v< expression_type > )
+  {
+    return has_epilogue_product< decltype( ::std::declval< const expression_type& >().underlying() ) >();
+  }
+  else
+  {
+    return false;
+  }
+}
+
+// The product fused into the write back, the first reached from the root
+template < class Expression >
+[[nodiscard]] constexpr const auto& epilogue_product( const Expression& expr ) noexcept
+{
+  if constexpr ( is_matrix_product_expression_v< Expression > )
+  {
+    return expr;
+  }
+  else if constexpr ( is_sum_expression_v< Expression > )
+  {
+    if constexpr ( has_epilogue_product< decltype( expr.first() ) >() )
+    {
+      return epilogue_product( expr.first() );
+    }
+    else
+    {
+      return epilogue_product( expr.second() );
+    }
+  }
+  else if constexpr ( is_scalar_preprod_expression_v< Expression > )
+  {
+    return epilogue_product( expr.second() );
+  }
+  else if constexpr ( is_scalar_postprod_expression_v< Expression > || is_scalar_division_expression_v< Expression > )
+  {
+    return epilogue_product( expr.first() );
+  }
+  else
+  {
+    return epilogue_product( expr.underlying() );
+  }
+}
+
+// Element ( i, j ) of the expression, given the matching element of its fused product
+template < class Expression, class Value, class IndexType >
+[[nodiscard]] auto epilogue_element( const Expression& expr, const Value& product, IndexType i, IndexType j )
+{
+  using value_type = typename Expression::value_type;
+  if constexpr ( !has_epilogue_product< Expression >() )
+  {
+    return static_cast< value_type >( LINALG_DETAIL::access( expr, i, j ) );
+  }
+  else if constexpr ( is_matrix_product_expression_v< Expression > )
+  {
+    return static_cast< value_type >( product );
+  }
+  else if constexpr ( is_addition_expression_v< Expression > )
+  {
+    if constexpr ( has_epilogue_product< decltype( expr.first() ) >() )
+    {
+      return static_cast< value_type >( epilogue_element( expr.first(), product, i, j ) + LINALG_DETAIL::access( expr.second(), i, j ) );
+    }
+    else
+    {
+      return static_cast< value_type >( LINALG_DETAIL::access( expr.first(), i, j ) + epilogue_element( expr.second(), product, i, j ) );
+    }
+  }
+  else if constexpr ( is_subtraction_expression_v< Expression > )
+  {
+    if constexpr ( has_epilogue_product< decltype( expr.first() ) >() )
+    {
+      return static_cast< value_type >( epilogue_element( expr.first(), product, i, j ) - LINALG_DETAIL::access( expr.second(), i, j ) );
+    }
+    else
+    {
+      return static_cast< value_type >( LINALG_DETAIL::access( expr.first(), i, j ) - epilogue_element( expr.second(), product, i, j ) );
+    }
+  }
+  else if constexpr ( is_scalar_preprod_expression_v< Expression > )
+  {
+    return static_cast< value_type >( expr.first() * epilogue_element( expr.second(), product, i, j ) );
+  }
+  else if constexpr ( is_scalar_postprod_expression_v< Expression > )
+  {
+    return static_cast< value_type >( epilogue_element( expr.first(), product, i, j ) * expr.second() );
+  }
+  else if constexpr ( is_scalar_division_expression_v< Expression > )
+  {
+    return static_cast< value_type >( epilogue_element( expr.first(), product, i, j ) / expr.second() );
+  }
+  else
+  {
+    return static_cast< value_type >( - epilogue_element( expr.underlying(), product, i, j ) );
+  }
+}
+
+//---------------------
+//  Epilogue Aliasing
+//---------------------
+
+// True if element ( i, j ) of the expression reads at most element ( i, j ) of t
+template < class Tensor, class Expression >
+[[nodiscard]] bool is_elementwise_safe( const Tensor& t, const Expression& expr )
+{
+  if constexpr ( LINALG_DETAIL::has_mapped_buffer< Expression >::value )
+  {
+    return LINALG_DETAIL::is_same_view( expr, t ) || !LINALG_DETAIL::overlaps( expr, t );
+  }
+  else if constexpr ( is_sum_expression_v< Expression > )
+  {
+    return is_elementwise_safe( t, expr.first() ) && is_elementwise_safe( t, expr.second() );
+  }
+  else if constexpr ( is_scalar_preprod_expression_v< Expression > )
+  {
+    return is_elementwise_safe( t, expr.second() );
+  }
+  else if constexpr ( is_scalar_postprod_expression_v< Expression > || is_scalar_division_expression_v< Expression > )
+  {
+    return is_elementwise_safe( t, expr.first() );
+  }
+  else if constexpr ( is_negate_expression_v< Expression > )
+  {
+    return is_elementwise_safe( t, expr.underlying() );
+  }
+  else
+  {
+    return !LINALG_DETAIL::overlaps( expr, t );
+  }
+}
+
+// True if t may be written element by element as the rows of the fused product complete
+template < class Tensor, class Expression >
+[[nodiscard]] bool is_epilogue_safe( const Tensor& t, const Expression& expr )
+{
+  if constexpr ( !has_epilogue_product< Expression >() )
+  {
+    return is_elementwise_safe( t, expr );
+  }
+  else if constexpr ( is_matrix_product_expression_v< Expression > )
+  {
+    return !LINALG_DETAIL::overlaps( expr, t );
+  }
+  else if constexpr ( is_sum_expression_v< Expression > )
+  {
+    return is_epilogue_safe( t, expr.first() ) && is_epilogue_safe( t, expr.second() );
+  }
+  else if constexpr ( is_scalar_preprod_expression_v< Expression > )
+  {
+    return is_epilogue_safe( t, expr.second() );
+  }
+  else if constexpr ( is_scalar_postprod_expression_v< Expression > || is_scalar_division_expression_v< Expression > )
+  {
+    return is_epilogue_safe( t, expr.first() );
+  }
+  else
+  {
+    return is_epilogue_safe( t, expr.underlying() );
+  }
+}
+
+//------------------
+//  Fused Epilogue
+//------------------
+
+// Assigns a product rooted tree in one pass over t, applying the element-wise nodes in the product's write back
+template < class Tensor, class Expression >
+[[nodiscard]] bool fused_epilogue( Tensor& t, const Expression& expr )
+{
+  // Products of static extents are unrolled element by element already
+  if constexpr ( ( Expression::rank() == 2 ) && ( Expression::extents_type::rank_dynamic() > 0 ) &&
+                 !is_matrix_product_expression_v< Expression > && has_epilogue_product< Expression >() && !reads_inverse< Expression >() )
+  {
+    if ( ( static_cast< ::std::size_t >( t.extent(0) ) != static_cast< ::std::size_t >( expr.extent(0) ) ) ||
+         ( static_cast< ::std::size_t >( t.extent(1) ) != static_cast< ::std::size_t >( expr.extent(1) ) ) ||
+         !is_epilogue_safe( t, expr ) )
+    {
+      return false;
+    }
+    using value_type       = typename Tensor::value_type;
+    using accumulator_type = LINALG::accumulation_result_t< ::std::decay_t< decltype( epilogue_product( expr ) ) > >;
+    LINALG_DETAIL::product_rows< accumulator_type >( epilogue_product( expr ),
+                                                     [&]( ::std::size_t i, ::std::size_t j, const accumulator_type& value )
+                                                     {
+                                                       LINALG_DETAIL::access( t, i, j ) = static_cast< value_type >( epilogue_element( expr, value, i, j ) );
+                                                     } );
+    return true;
+  }
+  return false;
+}
+
+LINALG_EXPRESSIONS_DETAIL_END // expressions detail namespace
+
+#endif  //- LINEAR_ALGEBRA_TENSOR_EXPRESSION_EPILOGUE_HPP
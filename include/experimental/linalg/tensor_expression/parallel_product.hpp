@@ -0,0 +1,298 @@
+//==================================================================================================
+//  File:       parallel_product.hpp
+//
+//  Summary:    This header defines:
+//              LINALG_DETAIL::parallel_product_partition
+//              LINALG_DETAIL::partition_product( rows, columns, inner, workers )
+//              LINALG_DETAIL::pack_product_panels< Accumulator, Operand >( const Leaf& b, const parallel_product_partition& p )
+//              LINALG_DETAIL::parallel_matrix_product< Accumulator[, Update] >( Tensor& t, const Expression& expr, const parallel_product_partition& p )
+//              LINALG_EXPRESSIONS_DETAIL::parallel_product( Tensor& t, const Expression& expr )
+//
+//              Large matrix products are split into tasks run under the parallel execution policy.
+//              The output is tiled over its rows and columns; when there are too few tiles to occupy
+//              the workers, the inner dimension is split as well and the partial products reduced.
+//              The second operand is packed once into column panels shared read only by every task.
+//              Transposed operands are read along the rows of their leaves.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_TENSOR_EXPRESSION_PARALLEL_PRODUCT_HPP
+#define LINEAR_ALGEBRA_TENSOR_EXPRESSION_PARALLEL_PRODUCT_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//----------------------------
+//  Parallel Matrix Products
+//----------------------------
+
+// Products with fewer multiply-adds than this are left to the single threaded evaluation
+inline constexpr ::std::size_t parallel_product_threshold = ::std::size_t( 1 ) << 18;
+
+// Rows and columns of the output tile computed by one task
+inline constexpr ::std::size_t parallel_tile_extent = 64;
+
+// Smallest slice of the inner dimension given to one task
+inline constexpr ::std::size_t parallel_depth_extent = 256;
+
+/// @brief Partition of a matrix product into output tiles and slices of the inner dimension
+struct parallel_product_partition
+{
+  ::std::size_t rows;
+  ::std::size_t columns;
+  ::std::size_t inner;
+  ::std::size_t row_tiles;
+  ::std::size_t column_tiles;
+  ::std::size_t depth_slices;
+  ::std::size_t depth;
+  [[nodiscard]] constexpr ::std::size_t tiles() const noexcept { return this->row_tiles * this->column_tiles; }
+  [[nodiscard]] constexpr ::std::size_t tasks() const noexcept { return this->tiles() * this->depth_slices; }
+};
+
+/// @brief Partitions a rows x inner by inner x columns product between workers
+[[nodiscard]] inline constexpr parallel_product_partition
+partition_product( ::std::size_t rows, ::std::size_t columns, ::std::size_t inner, ::std::size_t workers ) noexcept
+{
+  parallel_product_partition p { rows,
+                                 columns,
+                                 inner,
+                                 ( rows + parallel_tile_extent - 1 ) / parallel_tile_extent,
+                                 ( columns + parallel_tile_extent - 1 ) / parallel_tile_extent,
+                                 1,
+                                 inner };
+  // Too few tiles to occupy the workers, so split the inner dimension and reduce the partial products
+  if ( ( p.tiles() < workers ) && ( inner >= 2 * parallel_depth_extent ) )
+  {
+    const ::std::size_t slices = ::std::min( ( workers + p.tiles() - 1 ) / p.tiles(), inner / parallel_depth_extent );
+    p.depth        = ( inner + slices - 1 ) / slices;
+    p.depth_slices = ( inner + p.depth - 1 ) / p.depth;
+  }
+  return p;
+}
+
+/// @brief Packs the second operand into zero padded panels of parallel_tile_extent columns, each stored inner index major
+template < class Accumulator, class Operand, class Leaf >
+[[nodiscard]] ::std::vector< Accumulator > pack_product_panels( const Leaf& b, const parallel_product_partition& p )
+{
+  ::std::vector< Accumulator > panels( p.column_tiles * p.inner * parallel_tile_extent, Accumulator( 0 ) );
+  ::std::vector< ::std::size_t > tiles( p.column_tiles );
+  ::std::iota( tiles.begin(), tiles.end(), ::std::size_t( 0 ) );
+  // Cache the last exception to be thrown
+  ::std::exception_ptr eptr;
+  LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR,
+                           tiles.begin(),
+                           tiles.end(),
+                           [&]( ::std::size_t tile ) noexcept
+                           {
+                             try
+                             {
+                               Accumulator*        panel = panels.data() + tile * p.inner * parallel_tile_extent;
+                               const ::std::size_t first = tile * parallel_tile_extent;
+                               const ::std::size_t width = ::std::min( parallel_tile_extent, p.columns - first );
+                               if constexpr ( LINALG_EXPRESSIONS_DETAIL::product_operand_t< Operand >::transposed )
+                               {
+                                 // Transposed leaves are read along their rows
+                                 for ( ::std::size_t c = 0; c < width; ++c )
+                                 {
+                                   for ( ::std::size_t k = 0; k < p.inner; ++k )
+                                   {
+                                     panel[ k * parallel_tile_extent + c ] = Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< Operand >( b, k, first + c ) );
+                                   }
+                                 }
+                               }
+                               else
+                               {
+                                 for ( ::std::size_t k = 0; k < p.inner; ++k )
+                                 {
+                                   for ( ::std::size_t c = 0; c < width; ++c )
+                                   {
+                                     panel[ k * parallel_tile_extent + c ] = Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< Operand >( b, k, first + c ) );
+                                   }
+                                 }
+                               }
+                             }
+                             catch ( ... ) { eptr = ::std::current_exception(); }
+                           } );
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+  return panels;
+}
+
+/// @brief Evaluates a matrix product into t with the tasks of the partition run in parallel
+/// @tparam Update adds the product to t rather than assigning it
+template < class Accumulator, bool Update = false, class Tensor, class Expression >
+void parallel_matrix_product( Tensor& t, const Expression& expr, const parallel_product_partition& p )
+{
+  using value_type     = typename Tensor::value_type;
+  using first_type     = decltype( expr.first() );
+  using second_type    = decltype( expr.second() );
+  using first_operand  = LINALG_EXPRESSIONS_DETAIL::product_operand_t< first_type >;
+  using second_operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< second_type >;
+  const auto& a = first_operand::leaf( expr.first() );
+  Accumulator alpha = Accumulator( 1 );
+  if constexpr ( first_operand::scaled || second_operand::scaled )
+  {
+    alpha = LINALG_EXPRESSIONS_DETAIL::operand_alpha< first_type, Accumulator >( expr.first() ) *
+            LINALG_EXPRESSIONS_DETAIL::operand_alpha< second_type, Accumulator >( expr.second() );
+  }
+  const ::std::vector< Accumulator > panels = pack_product_panels< Accumulator, second_type >( second_operand::leaf( expr.second() ), p );
+  // Partial products of each slice of the inner dimension, reduced once every task has finished
+  ::std::vector< Accumulator > partial( ( p.depth_slices > 1 ) ? p.depth_slices * p.rows * p.columns : 0 );
+  ::std::vector< ::std::size_t > tasks( p.tasks() );
+  ::std::iota( tasks.begin(), tasks.end(), ::std::size_t( 0 ) );
+  // Cache the last exception to be thrown
+  ::std::exception_ptr eptr;
+  LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR,
+                           tasks.begin(),
+                           tasks.end(),
+                           [&]( ::std::size_t task ) noexcept
+                           {
+                             try
+                             {
+                               const ::std::size_t slice       = task / p.tiles();
+                               const ::std::size_t tile        = task % p.tiles();
+                               const ::std::size_t column_tile = tile % p.column_tiles;
+                               const ::std::size_t first_row   = ( tile / p.column_tiles ) * parallel_tile_extent;
+                               const ::std::size_t first_col   = column_tile * parallel_tile_extent;
+                               const ::std::size_t height      = ::std::min( parallel_tile_extent, p.rows - first_row );
+                               const ::std::size_t width       = ::std::min( parallel_tile_extent, p.columns - first_col );
+                               const ::std::size_t first_k     = slice * p.depth;
+                               const ::std::size_t last_k      = ::std::min( p.inner, first_k + p.depth );
+                               const Accumulator*  panel       = panels.data() + column_tile * p.inner * parallel_tile_extent;
+                               ::std::vector< Accumulator > c( height * parallel_tile_extent, Accumulator( 0 ) );
+                               if constexpr ( first_operand::transposed )
+                               {
+                                 // Transposed leaves are read along their rows, each updating every row of the tile
+                                 for ( ::std::size_t k = first_k; k < last_k; ++k )
+                                 {
+                                   const Accumulator* b_row = panel + k * parallel_tile_extent;
+                                   for ( ::std::size_t r = 0; r < height; ++r )
+                                   {
+                                     const Accumulator a_rk  = Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< first_type >( a, first_row + r, k ) );
+                                     Accumulator*      c_row = c.data() + r * parallel_tile_extent;
+                                     for ( ::std::size_t j = 0; j < parallel_tile_extent; ++j )
+                                     {
+                                       c_row[j] += a_rk * b_row[j];
+                                     }
+                                   }
+                                 }
+                               }
+                               else
+                               {
+                                 for ( ::std::size_t r = 0; r < height; ++r )
+                                 {
+                                   Accumulator* c_row = c.data() + r * parallel_tile_extent;
+                                   for ( ::std::size_t k = first_k; k < last_k; ++k )
+                                   {
+                                     const Accumulator  a_rk  = Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< first_type >( a, first_row + r, k ) );
+                                     const Accumulator* b_row = panel + k * parallel_tile_extent;
+                                     for ( ::std::size_t j = 0; j < parallel_tile_extent; ++j )
+                                     {
+                                       c_row[j] += a_rk * b_row[j];
+                                     }
+                                   }
+                                 }
+                               }
+                               for ( ::std::size_t r = 0; r < height; ++r )
+                               {
+                                 const Accumulator* c_row = c.data() + r * parallel_tile_extent;
+                                 for ( ::std::size_t j = 0; j < width; ++j )
+                                 {
+                                   if ( p.depth_slices > 1 )
+                                   {
+                                     partial[ ( slice * p.rows + first_row + r ) * p.columns + first_col + j ] = c_row[j];
+                                   }
+                                   else if constexpr ( Update )
+                                   {
+                                     LINALG_DETAIL::access( t, first_row + r, first_col + j ) += static_cast< value_type >( alpha * c_row[j] );
+                                   }
+                                   else
+                                   {
+                                     LINALG_DETAIL::access( t, first_row + r, first_col + j ) = static_cast< value_type >( alpha * c_row[j] );
+                                   }
+                                 }
+                               }
+                             }
+                             catch ( ... ) { eptr = ::std::current_exception(); }
+                           } );
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+  if ( p.depth_slices > 1 )
+  {
+    ::std::vector< ::std::size_t > rows( p.rows );
+    ::std::iota( rows.begin(), rows.end(), ::std::size_t( 0 ) );
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR,
+                             rows.begin(),
+                             rows.end(),
+                             [&]( ::std::size_t i ) noexcept
+                             {
+                               try
+                               {
+                                 for ( ::std::size_t j = 0; j < p.columns; ++j )
+                                 {
+                                   Accumulator sum = Accumulator( 0 );
+                                   for ( ::std::size_t slice = 0; slice < p.depth_slices; ++slice )
+                                   {
+                                     sum += partial[ ( slice * p.rows + i ) * p.columns + j ];
+                                   }
+                                   if constexpr ( Update )
+                                   {
+                                     LINALG_DETAIL::access( t, i, j ) += static_cast< value_type >( alpha * sum );
+                                   }
+                                   else
+                                   {
+                                     LINALG_DETAIL::access( t, i, j ) = static_cast< value_type >( alpha * sum );
+                                   }
+                                 }
+                               }
+                               catch ( ... ) { eptr = ::std::current_exception(); }
+                             } );
+    // If exceptions were thrown, rethrow the last
+    if ( eptr ) LINALG_UNLIKELY
+    {
+      ::std::rethrow_exception( eptr );
+    }
+  }
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
+
+//-----------------------------
+//  Parallel Product Dispatch
+//-----------------------------
+
+// Assigns a matrix product large enough to be worth evaluating in parallel
+// Products which read an inverse are left to solve_inverse_products.
+template < class Tensor, class Expression >
+[[nodiscard]] bool parallel_product( Tensor& t, const Expression& expr )
+{
+  if constexpr ( reads_inverse< Expression >() )
+  {
+    return false;
+  }
+  else
+  {
+    const ::std::size_t rows    = static_cast< ::std::size_t >( expr.extent(0) );
+    const ::std::size_t columns = static_cast< ::std::size_t >( expr.extent(1) );
+    const ::std::size_t inner   = static_cast< ::std::size_t >( expr.first().extent(1) );
+    if ( ( rows * columns * inner < LINALG_DETAIL::parallel_product_threshold ) || !is_directly_assignable( t, expr ) )
+    {
+      return false;
+    }
+    const ::std::size_t workers = ::std::max( ::std::size_t( ::std::thread::hardware_concurrency() ), ::std::size_t( 1 ) );
+    LINALG_DETAIL::parallel_matrix_product< LINALG::accumulation_result_t< Expression > >( t, expr, LINALG_DETAIL::partition_product( rows, columns, inner, workers ) );
+    return true;
+  }
+}
+
+LINALG_EXPRESSIONS_DETAIL_END // expressions detail namespace
+
+#endif  //- LINEAR_ALGEBRA_TENSOR_EXPRESSION_PARALLEL_PRODUCT_HPP
@@ -0,0 +1,271 @@
+//==================================================================================================
+//  File:       product_operand.hpp
+//
+//  Summary:    This header defines:
+//              LINALG_EXPRESSIONS_DETAIL::leaf_operand< Operand >
+//              LINALG_EXPRESSIONS_DETAIL::product_operand< Operand >
+//              LINALG_EXPRESSIONS_DETAIL::product_operand_t< Operand >
+//              LINALG_EXPRESSIONS_DETAIL::operand_layout_t< T >
+//              LINALG_EXPRESSIONS_DETAIL::read_operand< Operand >( const Leaf& leaf, IndexType ... indices )
+//              LINALG_EXPRESSIONS_DETAIL::operand_alpha< Operand, Alpha >( const Operand& op )
+//
+//              Product kernels use these to see through transpose, conjugate transpose, negate and
+//              scalar product expressions wrapping an operand.  Each wrapper is recorded as an op flag
+//              (N, T or C in BLAS terms) or folded into a scalar alpha, and the kernel reads the
+//              underlying leaf in its own index order, applying alpha once to the accumulated result.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_TENSOR_EXPRESSION_PRODUCT_OPERAND_HPP
+#define LINEAR_ALGEBRA_TENSOR_EXPRESSION_PRODUCT_OPERAND_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
+
+//----------------
+//  Leaf Operand
+//----------------
+
+/// @brief Operand read as is by a product kernel
+/// @tparam Operand tensor expression without cv or reference qualifiers
+template < class Operand >
+struct leaf_operand
+{
+  using leaf_type = Operand;
+  static constexpr bool transposed = false;
+  static constexpr bool conjugated = false;
+  static constexpr bool scaled     = false;
+  [[nodiscard]] static constexpr const leaf_type& leaf( const Operand& op ) noexcept { return op; }
+  template < class Alpha >
+  [[nodiscard]] static constexpr Alpha alpha( [[maybe_unused]] const Operand& op ) noexcept { return Alpha( 1 ); }
+};
+
+//-------------------
+//  Product Operand
+//-------------------
+
+/// @brief Decomposes a product operand into the leaf read by the kernel, its op flags and its scaling
+/// Wrappers are only seen through when they leave the value type unchanged, so the leaf reads convert
+/// exactly as the wrapped reads would.
+template < class Operand >
+struct product_operand : public leaf_operand< Operand > { };
+
+template < class Operand >
+using product_operand_t = product_operand< ::std::decay_t< Operand > >;
+
+// Transposed operand
+template < class Tensor >
+struct transposed_operand
+{
+  private:
+    using inner_type = product_operand_t< Tensor >;
+  public:
+    using leaf_type = typename inner_type::leaf_type;
+    static constexpr bool transposed = ( ::std::remove_reference_t< Tensor >::rank() == 2 ) ? !inner_type::transposed : inner_type::transposed;
+    static constexpr bool conjugated = inner_type::conjugated;
+    static constexpr bool scaled     = inner_type::scaled;
+    template < class Op >
+    [[nodiscard]] static constexpr const leaf_type& leaf( const Op& op ) noexcept { return inner_type::leaf( op.underlying() ); }
+    template < class Alpha, class Op >
+    [[nodiscard]] static constexpr Alpha alpha( const Op& op ) { return inner_type::template alpha< Alpha >( op.underlying() ); }
+};
+
+// Conjugate transposed operand
+template < class Tensor >
+struct conjugate_transposed_operand
+{
+  private:
+    using inner_type = product_operand_t< Tensor >;
+  public:
+    using leaf_type = typename inner_type::leaf_type;
+    static constexpr bool transposed = ( ::std::remove_reference_t< Tensor >::rank() == 2 ) ? !inner_type::transposed : inner_type::transposed;
+    static constexpr bool conjugated = !inner_type::conjugated;
+    static constexpr bool scaled     = inner_type::scaled;
+    template < class Op >
+    [[nodiscard]] static constexpr const leaf_type& leaf( const Op& op ) noexcept { return inner_type::leaf( op.underlying() ); }
+    template < class Alpha, class Op >
+    [[nodiscard]] static constexpr Alpha alpha( const Op& op )
+    {
+      if constexpr ( LINALG_DETAIL::is_complex_v< Alpha > )
+      {
+        return ::std::conj( inner_type::template alpha< Alpha >( op.underlying() ) );
+      }
+      else
+      {
+        return inner_type::template alpha< Alpha >( op.underlying() );
+      }
+    }
+};
+
+// Negated operand
+template < class Tensor >
+struct negated_operand
+{
+  private:
+    using inner_type = product_operand_t< Tensor >;
+  public:
+    using leaf_type = typename inner_type::leaf_type;
+    static constexpr bool transposed = inner_type::transposed;
+    static constexpr bool conjugated = inner_type::conjugated;
+    static constexpr bool scaled     = true;
+    template < class Op >
+    [[nodiscard]] static constexpr const leaf_type& leaf( const Op& op ) noexcept { return inner_type::leaf( op.underlying() ); }
+    template < class Alpha, class Op >
+    [[nodiscard]] static constexpr Alpha alpha( const Op& op ) { return - inner_type::template alpha< Alpha >( op.underlying() ); }
+};
+
+// Scalar pre-multiplied operand
+template < class Tensor >
+struct premultiplied_operand
+{
+  private:
+    using inner_type = product_operand_t< Tensor >;
+  public:
+    using leaf_type = typename inner_type::leaf_type;
+    static constexpr bool transposed = inner_type::transposed;
+    static constexpr bool conjugated = inner_type::conjugated;
+    static constexpr bool scaled     = true;
+    template < class Op >
+    [[nodiscard]] static constexpr const leaf_type& leaf( const Op& op ) noexcept { return inner_type::leaf( op.second() ); }
+    template < class Alpha, class Op >
+    [[nodiscard]] static constexpr Alpha alpha( const Op& op ) { return Alpha( op.first() ) * inner_type::template alpha< Alpha >( op.second() ); }
+};
+
+// Scalar post-multiplied operand
+template < class Tensor >
+struct postmultiplied_operand
+{
+  private:
+    using inner_type = product_operand_t< Tensor >;
+  public:
+    using leaf_type = typename inner_type::leaf_type;
+    static constexpr bool transposed = inner_type::transposed;
+    static constexpr bool conjugated = inner_type::conjugated;
+    static constexpr bool scaled     = true;
+    template < class Op >
+    [[nodiscard]] static constexpr const leaf_type& leaf( const Op& op ) noexcept { return inner_type::leaf( op.first() ); }
+    template < class Alpha, class Op >
+    [[nodiscard]] static constexpr Alpha alpha( const Op& op ) { return inner_type::template alpha< Alpha >( op.first() ) * Alpha( op.second() ); }
+};
+
+template < class Wrapper, class Tensor >
+inline constexpr bool preserves_value_type_v = ::std::is_same_v< ::std::remove_cv_t< typename Wrapper::value_type >,
+                                                                 ::std::remove_cv_t< typename ::std::remove_reference_t< Tensor >::value_type > >;
+
+#ifdef LINALG_ENABLE_CONCEPTS
+
+template < class Tensor >
+struct product_operand< LINALG_EXPRESSIONS::transpose_tensor_expression< Tensor, transpose_indices_t<> > > :
+  public transposed_operand< Tensor > { };
+
+template < class Tensor >
+struct product_operand< LINALG_EXPRESSIONS::conjugate_tensor_expression< Tensor, transpose_indices_t<> > > :
+  public ::std::conditional_t< preserves_value_type_v< LINALG_EXPRESSIONS::conjugate_tensor_expression< Tensor, transpose_indices_t<> >, Tensor >,
+                               conjugate_transposed_operand< Tensor >,
+                               leaf_operand< LINALG_EXPRESSIONS::conjugate_tensor_expression< Tensor, transpose_indices_t<> > > > { };
+
+template < class Tensor >
+struct product_operand< LINALG_EXPRESSIONS::negate_tensor_expression< Tensor > > :
+  public ::std::conditional_t< preserves_value_type_v< LINALG_EXPRESSIONS::negate_tensor_expression< Tensor >, Tensor >,
+                               negated_operand< Tensor >,
+                               leaf_operand< LINALG_EXPRESSIONS::negate_tensor_expression< Tensor > > > { };
+
+template < class Scalar, class Tensor >
+struct product_operand< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Tensor > > :
+  public ::std::conditional_t< preserves_value_type_v< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Tensor >, Tensor >,
+                               premultiplied_operand< Tensor >,
+                               leaf_operand< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Tensor > > > { };
+
+template < class Tensor, class Scalar >
+struct product_operand< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Tensor, Scalar > > :
+  public ::std::conditional_t< preserves_value_type_v< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Tensor, Scalar >, Tensor >,
+                               postmultiplied_operand< Tensor >,
+                               leaf_operand< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Tensor, Scalar > > > { };
+
+#else
+
+template < class Tensor, class Enable >
+struct product_operand< LINALG_EXPRESSIONS::transpose_tensor_expression< Tensor, transpose_indices_t<>, Enable > > :
+  public transposed_operand< Tensor > { };
+
+template < class Tensor, class Enable >
+struct product_operand< LINALG_EXPRESSIONS::conjugate_tensor_expression< Tensor, transpose_indices_t<>, Enable > > :
+  public ::std::conditional_t< preserves_value_type_v< LINALG_EXPRESSIONS::conjugate_tensor_expression< Tensor, transpose_indices_t<>, Enable >, Tensor >,
+                               conjugate_transposed_operand< Tensor >,
+                               leaf_operand< LINALG_EXPRESSIONS::conjugate_tensor_expression< Tensor, transpose_indices_t<>, Enable > > > { };
+
+template < class Tensor, class Enable >
+struct product_operand< LINALG_EXPRESSIONS::negate_tensor_expression< Tensor, Enable > > :
+  public ::std::conditional_t< preserves_value_type_v< LINALG_EXPRESSIONS::negate_tensor_expression< Tensor, Enable >, Tensor >,
+                               negated_operand< Tensor >,
+                               leaf_operand< LINALG_EXPRESSIONS::negate_tensor_expression< Tensor, Enable > > > { };
+
+template < class Scalar, class Tensor, class Enable >
+struct product_operand< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Tensor, Enable > > :
+  public ::std::conditional_t< preserves_value_type_v< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Tensor, Enable >, Tensor >,
+                               premultiplied_operand< Tensor >,
+                               leaf_operand< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Tensor, Enable > > > { };
+
+template < class Tensor, class Scalar, class Enable >
+struct product_operand< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Tensor, Scalar, Enable > > :
+  public ::std::conditional_t< preserves_value_type_v< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Tensor, Scalar, Enable >, Tensor >,
+                               postmultiplied_operand< Tensor >,
+                               leaf_operand< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Tensor, Scalar, Enable > > > { };
+
+#endif
+
+//-------------------
+//  Operand Layout
+//-------------------
+
+// Layout of an evaluated tensor, void for any other expression
+template < class T, class = void >
+struct operand_layout { using type = void; };
+template < class T >
+struct operand_layout< T, ::std::void_t< typename T::layout_type > > { using type = typename T::layout_type; };
+
+template < class T >
+using operand_layout_t = typename operand_layout< ::std::decay_t< T > >::type;
+
+//----------------
+//  Read Operand
+//----------------
+
+/// @brief Reads an element of a product operand from its leaf, applying its op flags
+/// @tparam Operand product operand type, possibly cv or reference qualified
+/// @param leaf leaf of the operand as returned by product_operand_t< Operand >::leaf
+/// @param indices indices of the element in the operand
+template < class Operand, class Leaf, class ... IndexType >
+[[nodiscard]] inline constexpr LINALG_FORCE_INLINE_FUNCTION decltype(auto)
+read_operand( const Leaf& leaf, IndexType ... indices )
+{
+  using operand_type = product_operand_t< Operand >;
+  if constexpr ( operand_type::transposed && operand_type::conjugated )
+  {
+    return conjugate_value( [&]( auto index1, auto index2 ) constexpr { return LINALG_DETAIL::access( leaf, index2, index1 ); }( indices ... ) );
+  }
+  else if constexpr ( operand_type::transposed )
+  {
+    return [&]( auto index1, auto index2 ) constexpr -> decltype(auto) { return LINALG_DETAIL::access( leaf, index2, index1 ); }( indices ... );
+  }
+  else if constexpr ( operand_type::conjugated )
+  {
+    return conjugate_value( LINALG_DETAIL::access( leaf, indices ... ) );
+  }
+  else
+  {
+    return LINALG_DETAIL::access( leaf, indices ... );
+  }
+}
+
+/// @brief Returns the scaling folded out of a product operand
+/// @tparam Alpha type the scaling is computed in
+template < class Operand, class Alpha >
+[[nodiscard]] inline constexpr Alpha operand_alpha( const Operand& op )
+{
+  return product_operand_t< Operand >::template alpha< Alpha >( op );
+}
+
+LINALG_EXPRESSIONS_DETAIL_END // expressions detail namespace
+
+#endif  //- LINEAR_ALGEBRA_TENSOR_EXPRESSION_PRODUCT_OPERAND_HPP
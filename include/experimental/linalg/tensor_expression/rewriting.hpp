@@ -0,0 +1,914 @@
+//==================================================================================================
+//  File:       rewriting.hpp
+//
+//  Summary:    This header defines:
+//              LINALG_EXPRESSIONS_DETAIL::expression_cost
+//              LINALG_EXPRESSIONS_DETAIL::element_cost( const Expression& expr )
+//              LINALG_EXPRESSIONS_DETAIL::evaluation_cost( const Expression& expr )
+//              LINALG_EXPRESSIONS_DETAIL::factor_common_operand( Tensor& t, const Sum& expr )
+//              LINALG_EXPRESSIONS_DETAIL::regroup_product_chain( Tensor& t, const Expression& expr )
+//              LINALG_EXPRESSIONS_DETAIL::group_sum_by_layout( Tensor& t, const Sum& expr )
+//              LINALG_EXPRESSIONS_DETAIL::solved_operand( const Operand& op )
+//              LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( Tensor& t, const Expression& expr )
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS_DETAIL::binary_tensor_expression_base< Expression, Traits > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::subtraction_tensor_expression< FirstTensor, SecondTensor > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Matrix > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Matrix, Scalar > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::scalar_division_tensor_expression< Matrix, Scalar > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::negate_tensor_expression< Matrix > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::transpose_tensor_expression< Matrix, transpose_indices_t<> > >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::conjugate_tensor_expression< Matrix, transpose_indices_t<> > >
+//
+//              Assignment of an expression tree is rewritten into an equivalent tree where the
+//              is_commutative, is_associative and is_left_distributive / is_right_distributive traits
+//              of its nodes permit it, and where the estimated flops and bytes moved are reduced:
+//              a * b + a * c is factored into a * ( b + c ), a chain of products has its inner product
+//              evaluated once in the cheaper grouping, and the operands of a sum are read in passes
+//              grouped by their layout. Trees which read an inverse are first rewritten so that each
+//              product with the inverse is solved against its factorization, wherever it sits.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_TENSOR_EXPRESSION_REWRITING_HPP
+#define LINEAR_ALGEBRA_TENSOR_EXPRESSION_REWRITING_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
+
+//-------------------
+//  Cost Estimation
+//-------------------
+
+// Flops which may be performed in the time taken to move one byte to or from memory
+inline constexpr double flops_per_byte = 4.0;
+// Bytes moved by an access which does not follow the layout of its tensor, one cache line
+inline constexpr double strided_access_bytes = 64.0;
+
+// Estimated flops performed and bytes moved by an evaluation
+struct expression_cost
+{
+  double flops = 0.0;
+  double bytes = 0.0;
+  [[nodiscard]] constexpr double total() const noexcept { return this->flops + flops_per_byte * this->bytes; }
+  constexpr expression_cost& operator += ( const expression_cost& c ) noexcept { this->flops += c.flops; this->bytes += c.bytes; return *this; }
+  [[nodiscard]] friend constexpr expression_cost operator + ( expression_cost c1, const expression_cost& c2 ) noexcept { return c1 += c2; }
+  [[nodiscard]] friend constexpr expression_cost operator * ( double n, const expression_cost& c ) noexcept { return expression_cost { n * c.flops, n * c.bytes }; }
+};
+
+// Cost of reading or writing one element of an evaluated tensor
+template < class T >
+[[nodiscard]] constexpr expression_cost access_cost() noexcept
+{
+  return expression_cost { 0.0, static_cast< double >( sizeof( T ) ) };
+}
+
+// Cost of computing one element of an expression, which is paid each time an unevaluated operand is read
+template < class Expression >
+[[nodiscard]] constexpr expression_cost element_cost( const Expression& expr ) noexcept
+{
+  if constexpr ( is_sum_expression_v< Expression > )
+  {
+    return element_cost( expr.first() ) + element_cost( expr.second() ) + expression_cost { 1.0, 0.0 };
+  }
+  else if constexpr ( is_matrix_product_expression_v< Expression > || is_matrix_vector_product_expression_v< Expression > )
+  {
+    // An inner product along a row of the matrix
+    return static_cast< double >( expr.first().extent(1) ) * ( element_cost( expr.first() ) + element_cost( expr.second() ) + expression_cost { 2.0, 0.0 } );
+  }
+  else if constexpr ( is_vector_matrix_product_expression_v< Expression > )
+  {
+    // An inner product along a column of the matrix
+    return static_cast< double >( expr.first().extent(0) ) * ( element_cost( expr.first() ) + element_cost( expr.second() ) + expression_cost { 2.0, 0.0 } );
+  }
+  else if constexpr ( is_scalar_preprod_expression_v< Expression > )
+  {
+    return element_cost( expr.second() ) + expression_cost { 1.0, 0.0 };
+  }
+  else if constexpr ( is_scalar_postprod_expression_v< Expression > || is_scalar_division_expression_v< Expression > )
+  {
+    return element_cost( expr.first() ) + expression_cost { 1.0, 0.0 };
+  }
+  else if constexpr ( is_transpose_expression_v< Expression > )
+  {
+    return element_cost( expr.underlying() );
+  }
+  else if constexpr ( is_conjugate_expression_v< Expression > || is_negate_expression_v< Expression > )
+  {
+    return element_cost( expr.underlying() ) + expression_cost { 1.0, 0.0 };
+  }
+  else
+  {
+    // Evaluated tensors, and any other expression which is treated as one
+    return access_cost< typename Expression::value_type >();
+  }
+}
+
+// Number of elements of an expression
+template < class Expression >
+[[nodiscard]] constexpr double element_count( const Expression& expr ) noexcept
+{
+  double count = 1.0;
+  for ( typename Expression::rank_type n = 0; n < Expression::rank(); ++n )
+  {
+    count *= static_cast< double >( expr.extent(n) );
+  }
+  return count;
+}
+
+// Cost of evaluating an expression into a tensor as written
+template < class Expression >
+[[nodiscard]] constexpr expression_cost evaluation_cost( const Expression& expr ) noexcept
+{
+  return element_count( expr ) * ( element_cost( expr ) + access_cost< typename Expression::value_type >() );
+}
+
+// Cost of evaluating a rows by columns product with the given inner extent from operands of the given element costs
+[[nodiscard]] constexpr expression_cost product_cost( double                 rows,
+                                                      double                 inner,
+                                                      double                 columns,
+                                                      const expression_cost& first,
+                                                      const expression_cost& second,
+                                                      const expression_cost& result ) noexcept
+{
+  return ( rows * columns ) * ( inner * ( first + second + expression_cost { 2.0, 0.0 } ) + result );
+}
+
+//----------------------------
+//  Common Operand Factoring
+//----------------------------
+
+template < class T1, class T2, class = void >
+struct is_addable : public ::std::false_type { };
+template < class T1, class T2 >
+struct is_addable< T1, T2, ::std::void_t< decltype( ::std::declval< const T1& >() + ::std::declval< const T2& >() ) > > : public ::std::true_type { };
+
+template < class T1, class T2, class = void >
+struct is_subtractable : public ::std::false_type { };
+template < class T1, class T2 >
+struct is_subtractable< T1, T2, ::std::void_t< decltype( ::std::declval< const T1& >() - ::std::declval< const T2& >() ) > > : public ::std::true_type { };
+
+// Operands which may be combined by the same operation as Sum
+template < class Sum, class T1, class T2 >
+inline constexpr bool is_combinable_v = is_addition_expression_v< Sum > ? is_addable< ::std::decay_t< T1 >, ::std::decay_t< T2 > >::value :
+                                                                          is_subtractable< ::std::decay_t< T1 >, ::std::decay_t< T2 > >::value;
+
+// Combines two operands by the same operation as Sum
+template < class Sum, class T1, class T2 >
+[[nodiscard]] constexpr auto combine( const T1& t1, const T2& t2 )
+{
+  if constexpr ( is_addition_expression_v< Sum > )
+  {
+    return t1 + t2;
+  }
+  else
+  {
+    return t1 - t2;
+  }
+}
+
+template < class T1, class T2 >
+inline constexpr bool is_same_product_v = ( is_matrix_product_expression_v< T1 > && is_matrix_product_expression_v< T2 > ) ||
+                                          ( is_matrix_vector_product_expression_v< T1 > && is_matrix_vector_product_expression_v< T2 > ) ||
+                                          ( is_vector_matrix_product_expression_v< T1 > && is_vector_matrix_product_expression_v< T2 > );
+
+// Assigns a * b ± a * c as a * ( b ± c ), or b * a ± c * a as ( b ± c ) * a, if the shared operand is the
+// same view and the single product is estimated to be cheaper
+template < class Tensor, class Sum >
+[[nodiscard]] bool factor_common_operand( Tensor& t, const Sum& expr )
+{
+  using first_type  = ::std::decay_t< decltype( expr.first() ) >;
+  using second_type = ::std::decay_t< decltype( expr.second() ) >;
+  if constexpr ( is_same_product_v< first_type, second_type > )
+  {
+    const auto& p1 = expr.first();
+    const auto& p2 = expr.second();
+    if constexpr ( LINALG::is_left_distributive_v< first_type, Sum > && LINALG::is_left_distributive_v< second_type, Sum > &&
+                   is_combinable_v< Sum, decltype( p1.second() ), decltype( p2.second() ) > )
+    {
+      if ( LINALG_DETAIL::is_same_view( p1.first(), p2.first() ) )
+      {
+        const auto sum       = combine< Sum >( p1.second(), p2.second() );
+        const auto rewritten = p1.first() * sum;
+        if ( evaluation_cost( rewritten ).total() < evaluation_cost( expr ).total() )
+        {
+          t = rewritten;
+          return true;
+        }
+      }
+    }
+    if constexpr ( LINALG::is_right_distributive_v< first_type, Sum > && LINALG::is_right_distributive_v< second_type, Sum > &&
+                   is_combinable_v< Sum, decltype( p1.first() ), decltype( p2.first() ) > )
+    {
+      if ( LINALG_DETAIL::is_same_view( p1.second(), p2.second() ) )
+      {
+        const auto sum       = combine< Sum >( p1.first(), p2.first() );
+        const auto rewritten = sum * p1.second();
+        if ( evaluation_cost( rewritten ).total() < evaluation_cost( expr ).total() )
+        {
+          t = rewritten;
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+//----------------------------
+//  Product Chain Regrouping
+//----------------------------
+
+// Assigns the product chain x * y * z, given as expr, with its inner product evaluated once into a
+// temporary in whichever grouping is estimated to be cheapest, or returns false if evaluating it as
+// written is. The grouping other than the written one is only considered if MayRegroup.
+template < bool GroupedRight, bool MayRegroup, class Tensor, class Expression, class X, class Y, class Z >
+[[nodiscard]] bool regroup_product_chain( Tensor& t, const Expression& expr, const X& x, const Y& y, const Z& z )
+{
+  const expression_cost result = access_cost< typename Expression::value_type >();
+  // A vector is a row if it is the leftmost factor and a column if it is the rightmost
+  const double d0 = ( X::rank() == 1 ) ? 1.0 : static_cast< double >( x.extent(0) );
+  const double d1 = static_cast< double >( x.extent( X::rank() - 1 ) );
+  const double d2 = static_cast< double >( y.extent(1) );
+  const double d3 = ( Z::rank() == 1 ) ? 1.0 : static_cast< double >( z.extent(1) );
+  // ( x * y ) * z and x * ( y * z ), with the inner product read from a temporary
+  const double left  = ( product_cost( d0, d1, d2, element_cost( x ), element_cost( y ), result ) +
+                         product_cost( d0, d2, d3, result, element_cost( z ), result ) ).total();
+  const double right = ( product_cost( d1, d2, d3, element_cost( y ), element_cost( z ), result ) +
+                         product_cost( d0, d1, d3, element_cost( x ), result, result ) ).total();
+  const double written   = GroupedRight ? right : left;
+  const double regrouped = MayRegroup ? ( GroupedRight ? left : right ) : ::std::numeric_limits< double >::infinity();
+  if ( ::std::min( written, regrouped ) >= evaluation_cost( expr ).total() )
+  {
+    return false;
+  }
+  if ( ( regrouped < written ) != GroupedRight )
+  {
+    if constexpr ( GroupedRight || MayRegroup )
+    {
+      const auto inner = ( y * z ).evaluate();
+      t = x * inner;
+      return true;
+    }
+  }
+  else
+  {
+    if constexpr ( !GroupedRight || MayRegroup )
+    {
+      const auto inner = ( x * y ).evaluate();
+      t = inner * z;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Assigns a product of which one operand is itself a product, as permitted by is_associative
+template < class Tensor, class Expression >
+[[nodiscard]] bool regroup_product_chain( Tensor& t, const Expression& expr )
+{
+  using first_type  = ::std::decay_t< decltype( expr.first() ) >;
+  using second_type = ::std::decay_t< decltype( expr.second() ) >;
+  if constexpr ( is_product_expression_v< first_type > )
+  {
+    return regroup_product_chain< false, LINALG::is_associative_v< Expression, first_type > >( t, expr, expr.first().first(), expr.first().second(), expr.second() );
+  }
+  else if constexpr ( is_product_expression_v< second_type > )
+  {
+    return regroup_product_chain< true, LINALG::is_associative_v< Expression, second_type > >( t, expr, expr.first(), expr.second().first(), expr.second().second() );
+  }
+  else
+  {
+    return false;
+  }
+}
+
+//------------------------
+//  Sum Operand Grouping
+//------------------------
+
+template < class T >
+inline constexpr bool is_row_or_column_major_v = ::std::is_same_v< operand_layout_t< T >, ::std::layout_right > ||
+                                                 ::std::is_same_v< operand_layout_t< T >, ::std::layout_left >;
+
+// Flattens the operands of a tree of additions into a tuple, where commutativity and associativity permit
+template < class Parent, class Operand >
+[[nodiscard]] constexpr auto sum_operands( const Operand& op ) noexcept
+{
+  if constexpr ( is_addition_expression_v< Operand > )
+  {
+    if constexpr ( LINALG::is_commutative_v< Parent > && LINALG::is_associative_v< Parent, Operand > )
+    {
+      return ::std::tuple_cat( sum_operands< Operand >( op.first() ), sum_operands< Operand >( op.second() ) );
+    }
+    else
+    {
+      return ::std::tuple< const Operand& >( op );
+    }
+  }
+  else
+  {
+    return ::std::tuple< const Operand& >( op );
+  }
+}
+
+// Adds an operand to an element of the sum if it has the given layout
+template < class Layout, class Value, class Operand, class IndexType >
+constexpr void add_if_layout( Value& sum, const Operand& op, IndexType i, IndexType j )
+{
+  if constexpr ( ::std::is_same_v< operand_layout_t< Operand >, Layout > )
+  {
+    sum += LINALG_DETAIL::access( op, i, j );
+  }
+}
+
+// Assigns, or adds if Accumulate, the operands with the given layout to the tensor, traversing the
+// elements in the order of that layout
+template < class Layout, bool Accumulate, class Value, class Tensor, class Operands, ::std::size_t ... Indices >
+void add_operands_in_layout( Tensor& t, const Operands& operands, ::std::index_sequence< Indices ... > )
+{
+  using index_type = typename Tensor::index_type;
+  using value_type = typename Tensor::value_type;
+  const auto update = [&t,&operands]( index_type i, index_type j )
+  {
+    Value sum {};
+    ( add_if_layout< Layout >( sum, ::std::get< Indices >( operands ), i, j ), ... );
+    if constexpr ( Accumulate )
+    {
+      LINALG_DETAIL::access( t, i, j ) = static_cast< value_type >( LINALG_DETAIL::access( t, i, j ) + sum );
+    }
+    else
+    {
+      LINALG_DETAIL::access( t, i, j ) = static_cast< value_type >( sum );
+    }
+  };
+  const index_type rows    = t.extent(0);
+  const index_type columns = t.extent(1);
+  if constexpr ( ::std::is_same_v< Layout, ::std::layout_right > )
+  {
+    for ( index_type i = 0; i < rows; ++i )
+    {
+      for ( index_type j = 0; j < columns; ++j )
+      {
+        update( i, j );
+      }
+    }
+  }
+  else
+  {
+    for ( index_type j = 0; j < columns; ++j )
+    {
+      for ( index_type i = 0; i < rows; ++i )
+      {
+        update( i, j );
+      }
+    }
+  }
+}
+
+template < class Tensor, class Sum, class Operands, ::std::size_t ... Indices >
+[[nodiscard]] bool group_sum_by_layout( Tensor& t, const Sum& expr, const Operands& operands, ::std::index_sequence< Indices ... > indices )
+{
+  if constexpr ( is_row_or_column_major_v< Tensor > && ( is_row_or_column_major_v< ::std::tuple_element_t< Indices, Operands > > && ... ) )
+  {
+    using tensor_layout = operand_layout_t< Tensor >;
+    using other_layout  = ::std::conditional_t< ::std::is_same_v< tensor_layout, ::std::layout_right >, ::std::layout_left, ::std::layout_right >;
+    constexpr ::std::size_t same_count  = ( static_cast< ::std::size_t >( ::std::is_same_v< operand_layout_t< ::std::tuple_element_t< Indices, Operands > >, tensor_layout > ) + ... );
+    constexpr ::std::size_t other_count = sizeof...( Indices ) - same_count;
+    if constexpr ( other_count != 0 )
+    {
+      if ( LINALG_IS_CONSTANT_EVALUATED() ||
+           ( static_cast< ::std::size_t >( t.extent(0) ) != static_cast< ::std::size_t >( expr.extent(0) ) ) ||
+           ( static_cast< ::std::size_t >( t.extent(1) ) != static_cast< ::std::size_t >( expr.extent(1) ) ) ||
+           LINALG_DETAIL::overlaps( expr, t ) )
+      {
+        return false;
+      }
+      const double count = element_count( expr );
+      const double size  = static_cast< double >( sizeof( typename Sum::value_type ) );
+      const double flops = count * static_cast< double >( sizeof...( Indices ) - 1 );
+      // As written, operands in the other layout are read across it
+      const expression_cost written { flops, count * ( static_cast< double >( same_count ) * size + static_cast< double >( other_count ) * strided_access_bytes + size ) };
+      // Grouped, every operand is read along its layout, while the pass in the other layout updates the tensor across its own
+      const expression_cost grouped { flops, count * ( static_cast< double >( sizeof...( Indices ) ) * size +
+                                                       ( ( same_count == 0 ) ? strided_access_bytes : size + 2.0 * strided_access_bytes ) ) };
+      if ( grouped.total() >= written.total() )
+      {
+        return false;
+      }
+      if constexpr ( same_count != 0 )
+      {
+        add_operands_in_layout< tensor_layout, false, typename Sum::value_type >( t, operands, indices );
+      }
+      add_operands_in_layout< other_layout, ( same_count != 0 ), typename Sum::value_type >( t, operands, indices );
+      return true;
+    }
+    else
+    {
+      return false;
+    }
+  }
+  else
+  {
+    return false;
+  }
+}
+
+// Assigns a sum of matrices of mixed layouts in one pass per layout, if estimated to be cheaper
+template < class Tensor, class Sum >
+[[nodiscard]] bool group_sum_by_layout( Tensor& t, const Sum& expr )
+{
+  if constexpr ( ( Sum::rank() == 2 ) && LINALG::is_commutative_v< Sum > )
+  {
+    const auto operands = ::std::tuple_cat( sum_operands< Sum >( expr.first() ), sum_operands< Sum >( expr.second() ) );
+    using operands_type = ::std::decay_t< decltype( operands ) >;
+    return group_sum_by_layout( t, expr, operands, ::std::make_index_sequence< ::std::tuple_size_v< operands_type > >() );
+  }
+  else
+  {
+    return false;
+  }
+}
+
+//---------------------------
+//  Inverse Product Solving
+//---------------------------
+
+// True for a product whose first operand is an inverse, possibly scaled, which is evaluated as a solve
+template < class Expression >
+[[nodiscard]] constexpr bool is_solvable_inverse_product() noexcept
+{
+  if constexpr ( is_matrix_product_expression_v< Expression > || is_matrix_vector_product_expression_v< Expression > )
+  {
+    using first_operand = product_operand_t< decltype( ::std::declval< const Expression& >().first() ) >;
+    return is_inverse_expression_v< typename first_operand::leaf_type > && !first_operand::transposed && !first_operand::conjugated;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+// Nodes which are rebuilt from their operands once those reading an inverse are evaluated
+template < class T >
+inline constexpr bool is_rebuildable_node_v = is_sum_expression_v< T > || is_product_expression_v< T > || is_scalar_preprod_expression_v< T > ||
+                                              is_scalar_postprod_expression_v< T > || is_scalar_division_expression_v< T > ||
+                                              is_negate_expression_v< T > || is_transpose_expression_v< T > || is_conjugate_expression_v< T >;
+
+// Node of the same kind as Expression, built from the given operands
+template < class Expression, class First, class Second >
+[[nodiscard]] constexpr auto rebuilt_node( const First& first, const Second& second )
+{
+  if constexpr ( is_addition_expression_v< Expression > )
+  {
+    return first + second;
+  }
+  else if constexpr ( is_subtraction_expression_v< Expression > )
+  {
+    return first - second;
+  }
+  else if constexpr ( is_scalar_division_expression_v< Expression > )
+  {
+    return first / second;
+  }
+  else
+  {
+    return first * second;
+  }
+}
+
+template < class Expression, class Operand >
+[[nodiscard]] constexpr auto rebuilt_node( const Operand& op )
+{
+  if constexpr ( is_negate_expression_v< Expression > )
+  {
+    return -op;
+  }
+  else if constexpr ( is_transpose_expression_v< Expression > )
+  {
+    return LINALG::trans( op );
+  }
+  else
+  {
+    return LINALG::conj( op );
+  }
+}
+
+template < class Operand >
+[[nodiscard]] auto solved_operand( const Operand& op );
+
+// Calls f with op, evaluated into a temporary with its products with an inverse solved if it reads one
+template < class Operand, class Function >
+decltype(auto) with_solved( const Operand& op, Function&& f )
+{
+  if constexpr ( reads_inverse< Operand >() )
+  {
+    const auto solved = solved_operand( op );
+    return f( solved );
+  }
+  else
+  {
+    return f( op );
+  }
+}
+
+// Calls f with the operands of a rebuildable node, each passed through with_solved
+template < class Expression, class Function >
+decltype(auto) with_solved_operands( const Expression& expr, Function&& f )
+{
+  if constexpr ( LINALG_DETAIL::has_binary_operands< Expression >::value )
+  {
+    return with_solved( expr.first(),
+                        [&]( const auto& first ) -> decltype(auto)
+                        {
+                          return with_solved( expr.second(), [&]( const auto& second ) -> decltype(auto) { return f( first, second ); } );
+                        } );
+  }
+  else
+  {
+    return with_solved( expr.underlying(), f );
+  }
+}
+
+// Evaluates an operand which reads an inverse, solving each product with the inverse against its factorization
+template < class Operand >
+[[nodiscard]] auto solved_operand( const Operand& op )
+{
+  if constexpr ( is_solvable_inverse_product< Operand >() )
+  {
+    using first_type    = decltype( op.first() );
+    using first_operand = product_operand_t< first_type >;
+    auto x = with_solved( op.second(), [&]( const auto& b ) { return ( first_operand::leaf( op.first() ) * b ).evaluate(); } );
+    if constexpr ( first_operand::scaled )
+    {
+      x *= operand_alpha< first_type, typename Operand::value_type >( op.first() );
+    }
+    return x;
+  }
+  else if constexpr ( is_rebuildable_node_v< Operand > )
+  {
+    return with_solved_operands( op, []( const auto& ... operands ) { return rebuilt_node< Operand >( operands ... ).evaluate(); } );
+  }
+  else
+  {
+    // The inverse itself, or a node which only reads it element by element
+    return op.evaluate();
+  }
+}
+
+// Assigns a tree which reads an inverse with each product with the inverse solved against its factorization,
+// so the explicit inverse is never formed: alpha * inverse( a ) * b is solved into t and scaled in place, and
+// other trees are rebuilt from their operands with those which read an inverse evaluated into temporaries
+template < class Tensor, class Expression >
+[[nodiscard]] bool solve_inverse_products( Tensor& t, const Expression& expr )
+{
+  if constexpr ( is_solvable_inverse_product< Expression >() )
+  {
+    using first_type    = decltype( expr.first() );
+    using first_operand = product_operand_t< first_type >;
+    with_solved( expr.second(), [&]( const auto& b ) { t = first_operand::leaf( expr.first() ) * b; } );
+    if constexpr ( first_operand::scaled )
+    {
+      t *= operand_alpha< first_type, typename Tensor::value_type >( expr.first() );
+    }
+    return true;
+  }
+  else if constexpr ( reads_inverse< Expression >() && is_rebuildable_node_v< Expression > )
+  {
+    with_solved_operands( expr, [&]( const auto& ... operands ) { t = rebuilt_node< Expression >( operands ... ); } );
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+LINALG_EXPRESSIONS_DETAIL_END // expressions detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//------------------------
+//  Rewritten Assignment
+//------------------------
+
+// Conversion and evaluate() construct from the binary expression base, which is rewritten as the expression itself
+template < class Tensor, class Expression, class Traits >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS_DETAIL::binary_tensor_expression_base< Expression, Traits > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS_DETAIL::binary_tensor_expression_base< Expression, Traits >& expr )
+  {
+    return rewritten_assignment< Tensor, Expression >::apply( t, static_cast< const Expression& >( expr ) );
+  }
+};
+
+#ifdef LINALG_ENABLE_CONCEPTS
+
+template < class Tensor, class FirstTensor, class SecondTensor >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::symmetric_rank_2k_sum( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::factor_common_operand( t, expr ) || LINALG_EXPRESSIONS_DETAIL::fused_epilogue( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::group_sum_by_layout( t, expr );
+  }
+};
+
+template < class Tensor, class FirstTensor, class SecondTensor >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::subtraction_tensor_expression< FirstTensor, SecondTensor > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::subtraction_tensor_expression< FirstTensor, SecondTensor >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::factor_common_operand( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::fused_epilogue( t, expr );
+  }
+};
+
+template < class Tensor, class Scalar, class Matrix >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Matrix > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Matrix >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::fused_epilogue( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix, class Scalar >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Matrix, Scalar > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Matrix, Scalar >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::fused_epilogue( t, expr );
+  }
+};
+
+template < class Tensor, class FirstMatrix, class SecondMatrix >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::symmetric_product( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::regroup_product_chain( t, expr ) || LINALG_EXPRESSIONS_DETAIL::parallel_product( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::transposed_product( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix, class Vector >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::regroup_product_chain( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::transposed_product( t, expr );
+  }
+};
+
+template < class Tensor, class Vector, class Matrix >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::regroup_product_chain( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix, class Scalar >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::scalar_division_tensor_expression< Matrix, Scalar > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::scalar_division_tensor_expression< Matrix, Scalar >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::negate_tensor_expression< Matrix > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::negate_tensor_expression< Matrix >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::transpose_tensor_expression< Matrix, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<> > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::transpose_tensor_expression< Matrix, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<> >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::conjugate_tensor_expression< Matrix, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<> > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::conjugate_tensor_expression< Matrix, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<> >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr );
+  }
+};
+
+#else
+
+template < class Tensor, class FirstTensor, class SecondTensor, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::symmetric_rank_2k_sum( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::factor_common_operand( t, expr ) || LINALG_EXPRESSIONS_DETAIL::fused_epilogue( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::group_sum_by_layout( t, expr );
+  }
+};
+
+template < class Tensor, class FirstTensor, class SecondTensor, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::subtraction_tensor_expression< FirstTensor, SecondTensor, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::subtraction_tensor_expression< FirstTensor, SecondTensor, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::factor_common_operand( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::fused_epilogue( t, expr );
+  }
+};
+
+template < class Tensor, class Scalar, class Matrix, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Matrix, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Matrix, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::fused_epilogue( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix, class Scalar, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Matrix, Scalar, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Matrix, Scalar, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::fused_epilogue( t, expr );
+  }
+};
+
+template < class Tensor, class FirstMatrix, class SecondMatrix, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::symmetric_product( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::regroup_product_chain( t, expr ) || LINALG_EXPRESSIONS_DETAIL::parallel_product( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::transposed_product( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix, class Vector, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::regroup_product_chain( t, expr ) ||
+           LINALG_EXPRESSIONS_DETAIL::transposed_product( t, expr );
+  }
+};
+
+template < class Tensor, class Vector, class Matrix, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr ) || LINALG_EXPRESSIONS_DETAIL::regroup_product_chain( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix, class Scalar, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::scalar_division_tensor_expression< Matrix, Scalar, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::scalar_division_tensor_expression< Matrix, Scalar, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::negate_tensor_expression< Matrix, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::negate_tensor_expression< Matrix, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::transpose_tensor_expression< Matrix, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<>, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::transpose_tensor_expression< Matrix, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<>, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr );
+  }
+};
+
+template < class Tensor, class Matrix, class Enable >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::conjugate_tensor_expression< Matrix, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<>, Enable > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::conjugate_tensor_expression< Matrix, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<>, Enable >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::solve_inverse_products( t, expr );
+  }
+};
+
+#endif
+
+LINALG_END // linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_TENSOR_EXPRESSION_REWRITING_HPP
@@ -0,0 +1,249 @@
+//==================================================================================================
+//  File:       simplification.hpp
+//
+//  Summary:    This header defines:
+//              LINALG_EXPRESSIONS_DETAIL::is_transpose_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_conjugate_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_negate_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_scalar_preprod_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_scalar_postprod_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_scalar_division_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_addition_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_subtraction_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_matrix_product_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_matrix_vector_product_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_vector_matrix_product_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::is_inverse_expression< T >
+//              LINALG_EXPRESSIONS_DETAIL::reads_inverse< T >()
+//              LINALG_EXPRESSIONS_DETAIL::is_real_value_v< T >
+//              LINALG_EXPRESSIONS_DETAIL::conjugate_value( const T& v )
+//              LINALG_EXPRESSIONS_DETAIL::expression_scalar< T >
+//              LINALG_EXPRESSIONS_DETAIL::scalars_are_foldable< S1, S2 >
+//              LINALG_EXPRESSIONS_DETAIL::is_reciprocal_divisible< Value, Scalar >
+//
+//              The unary and scalar operators use these to simplify the expression trees they build:
+//              involutions such as trans( trans( A ) ) collapse to their operand, chained scalar
+//              factors fold into a single scalar, conj of a real tensor is a plain transpose and, if
+//              allowed, division by a scalar becomes multiplication by its reciprocal.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_TENSOR_EXPRESSION_SIMPLIFICATION_HPP
+#define LINEAR_ALGEBRA_TENSOR_EXPRESSION_SIMPLIFICATION_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
+
+//---------------------------
+//  Expression Node Queries
+//---------------------------
+
+// Transpose of the leading two indices
+template < class T >
+struct is_transpose_expression : public ::std::false_type { };
+// Conjugate transpose of the leading two indices
+template < class T >
+struct is_conjugate_expression : public ::std::false_type { };
+template < class T >
+struct is_negate_expression : public ::std::false_type { };
+template < class T >
+struct is_scalar_preprod_expression : public ::std::false_type { };
+template < class T >
+struct is_scalar_postprod_expression : public ::std::false_type { };
+template < class T >
+struct is_scalar_division_expression : public ::std::false_type { };
+template < class T >
+struct is_addition_expression : public ::std::false_type { };
+template < class T >
+struct is_subtraction_expression : public ::std::false_type { };
+template < class T >
+struct is_matrix_product_expression : public ::std::false_type { };
+template < class T >
+struct is_matrix_vector_product_expression : public ::std::false_type { };
+template < class T >
+struct is_vector_matrix_product_expression : public ::std::false_type { };
+template < class T >
+struct is_inverse_expression : public ::std::false_type { };
+template < class Matrix >
+struct is_inverse_expression< LINALG_EXPRESSIONS::inverse_expression< Matrix > > : public ::std::true_type { };
+
+#ifdef LINALG_ENABLE_CONCEPTS
+
+template < class Tensor >
+struct is_transpose_expression< LINALG_EXPRESSIONS::transpose_tensor_expression< Tensor, transpose_indices_t<> > > : public ::std::true_type { };
+template < class Tensor >
+struct is_conjugate_expression< LINALG_EXPRESSIONS::conjugate_tensor_expression< Tensor, transpose_indices_t<> > > : public ::std::true_type { };
+template < class Tensor >
+struct is_negate_expression< LINALG_EXPRESSIONS::negate_tensor_expression< Tensor > > : public ::std::true_type { };
+template < class Scalar, class Tensor >
+struct is_scalar_preprod_expression< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Tensor > > : public ::std::true_type { };
+template < class Tensor, class Scalar >
+struct is_scalar_postprod_expression< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Tensor, Scalar > > : public ::std::true_type { };
+template < class Tensor, class Scalar >
+struct is_scalar_division_expression< LINALG_EXPRESSIONS::scalar_division_tensor_expression< Tensor, Scalar > > : public ::std::true_type { };
+template < class FirstTensor, class SecondTensor >
+struct is_addition_expression< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor > > : public ::std::true_type { };
+template < class FirstTensor, class SecondTensor >
+struct is_subtraction_expression< LINALG_EXPRESSIONS::subtraction_tensor_expression< FirstTensor, SecondTensor > > : public ::std::true_type { };
+template < class FirstMatrix, class SecondMatrix >
+struct is_matrix_product_expression< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix > > : public ::std::true_type { };
+template < class Matrix, class Vector >
+struct is_matrix_vector_product_expression< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector > > : public ::std::true_type { };
+template < class Vector, class Matrix >
+struct is_vector_matrix_product_expression< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix > > : public ::std::true_type { };
+
+#else
+
+template < class Tensor, class Enable >
+struct is_transpose_expression< LINALG_EXPRESSIONS::transpose_tensor_expression< Tensor, transpose_indices_t<>, Enable > > : public ::std::true_type { };
+template < class Tensor, class Enable >
+struct is_conjugate_expression< LINALG_EXPRESSIONS::conjugate_tensor_expression< Tensor, transpose_indices_t<>, Enable > > : public ::std::true_type { };
+template < class Tensor, class Enable >
+struct is_negate_expression< LINALG_EXPRESSIONS::negate_tensor_expression< Tensor, Enable > > : public ::std::true_type { };
+template < class Scalar, class Tensor, class Enable >
+struct is_scalar_preprod_expression< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Tensor, Enable > > : public ::std::true_type { };
+template < class Tensor, class Scalar, class Enable >
+struct is_scalar_postprod_expression< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Tensor, Scalar, Enable > > : public ::std::true_type { };
+template < class Tensor, class Scalar, class Enable >
+struct is_scalar_division_expression< LINALG_EXPRESSIONS::scalar_division_tensor_expression< Tensor, Scalar, Enable > > : public ::std::true_type { };
+template < class FirstTensor, class SecondTensor, class Enable >
+struct is_addition_expression< LINALG_EXPRESSIONS::addition_tensor_expression< FirstTensor, SecondTensor, Enable > > : public ::std::true_type { };
+template < class FirstTensor, class SecondTensor, class Enable >
+struct is_subtraction_expression< LINALG_EXPRESSIONS::subtraction_tensor_expression< FirstTensor, SecondTensor, Enable > > : public ::std::true_type { };
+template < class FirstMatrix, class SecondMatrix, class Enable >
+struct is_matrix_product_expression< LINALG_EXPRESSIONS::matrix_product_expression< FirstMatrix, SecondMatrix, Enable > > : public ::std::true_type { };
+template < class Matrix, class Vector, class Enable >
+struct is_matrix_vector_product_expression< LINALG_EXPRESSIONS::matrix_vector_product_expression< Matrix, Vector, Enable > > : public ::std::true_type { };
+template < class Vector, class Matrix, class Enable >
+struct is_vector_matrix_product_expression< LINALG_EXPRESSIONS::vector_matrix_product_expression< Vector, Matrix, Enable > > : public ::std::true_type { };
+
+#endif
+
+template < class T >
+inline constexpr bool is_transpose_expression_v = is_transpose_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_conjugate_expression_v = is_conjugate_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_negate_expression_v = is_negate_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_scalar_preprod_expression_v = is_scalar_preprod_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_scalar_postprod_expression_v = is_scalar_postprod_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_scalar_division_expression_v = is_scalar_division_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_addition_expression_v = is_addition_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_subtraction_expression_v = is_subtraction_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_matrix_product_expression_v = is_matrix_product_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_matrix_vector_product_expression_v = is_matrix_vector_product_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_vector_matrix_product_expression_v = is_vector_matrix_product_expression< ::std::decay_t< T > >::value;
+template < class T >
+inline constexpr bool is_inverse_expression_v = is_inverse_expression< ::std::decay_t< T > >::value;
+
+// Sums over which products may distribute
+template < class T >
+inline constexpr bool is_sum_expression_v = is_addition_expression_v< T > || is_subtraction_expression_v< T >;
+// Products which may be chained with one another
+template < class T >
+inline constexpr bool is_product_expression_v = is_matrix_product_expression_v< T > || is_matrix_vector_product_expression_v< T > || is_vector_matrix_product_expression_v< T >;
+
+// True if reading an element of T reads an element of an inverse, which forms the explicit inverse
+template < class T >
+[[nodiscard]] constexpr bool reads_inverse() noexcept
+{
+  using expression_type = ::std::decay_t< T >;
+  if constexpr ( is_inverse_expression_v< expression_type > )
+  {
+    return true;
+  }
+  else if constexpr ( LINALG_DETAIL::has_binary_operands< expression_type >::value )
+  {
+    return reads_inverse< decltype( ::std::declval< const expression_type& >().first() ) >() ||
+           reads_inverse< decltype( ::std::declval< const expression_type& >().second() ) >();
+  }
+  else if constexpr ( LINALG_DETAIL::has_unary_operand< expression_type >::value )
+  {
+    return reads_inverse< decltype( ::std::declval< const expression_type& >().underlying() ) >();
+  }
+  else
+  {
+    return false;
+  }
+}
+
+//--------------------
+//  Rewrite Criteria
+//--------------------
+
+// Values for which conjugation is the identity
+template < class T >
+inline constexpr bool is_real_value_v = ! LINALG_DETAIL::is_complex_v< ::std::remove_cv_t< T > >;
+
+// Conjugates a value, which is the identity for real values
+template < class T >
+[[nodiscard]] inline constexpr auto conjugate_value( const T& v ) noexcept( noexcept( ::std::conj( v ) ) )
+{
+  if constexpr ( is_real_value_v< T > )
+  {
+    return v;
+  }
+  else
+  {
+    return ::std::conj( v );
+  }
+}
+
+// Scalar factor or divisor of a scalar expression, void for any other expression
+template < class T >
+struct expression_scalar { using type = void; };
+
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class Scalar, class Tensor >
+struct expression_scalar< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Tensor > > { using type = ::std::remove_cvref_t< Scalar >; };
+template < class Tensor, class Scalar >
+struct expression_scalar< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Tensor, Scalar > > { using type = ::std::remove_cvref_t< Scalar >; };
+#else
+template < class Scalar, class Tensor, class Enable >
+struct expression_scalar< LINALG_EXPRESSIONS::scalar_preprod_tensor_expression< Scalar, Tensor, Enable > > { using type = ::std::decay_t< Scalar >; };
+template < class Tensor, class Scalar, class Enable >
+struct expression_scalar< LINALG_EXPRESSIONS::scalar_postprod_tensor_expression< Tensor, Scalar, Enable > > { using type = ::std::decay_t< Scalar >; };
+#endif
+
+template < class T >
+using expression_scalar_t = typename expression_scalar< ::std::decay_t< T > >::type;
+
+// Scalars which may be combined into a single factor of the same type.
+// Arithmetic and complex multiplication commute, so the factors may be combined in either order.
+template < class S1, class S2, class = void >
+struct scalars_are_foldable : public ::std::false_type { };
+
+template < class S1, class S2 >
+struct scalars_are_foldable< S1, S2, ::std::enable_if_t< ::std::is_same_v< ::std::decay_t< S1 >, ::std::decay_t< S2 > > &&
+                                                         ( ::std::is_arithmetic_v< ::std::decay_t< S1 > > ||
+                                                           LINALG_DETAIL::is_complex_v< ::std::decay_t< S1 > > ) > > :
+  public ::std::is_same< decltype( ::std::declval< ::std::decay_t< S1 > >() * ::std::declval< ::std::decay_t< S1 > >() ), ::std::decay_t< S1 > >
+{ };
+
+template < class S1, class S2 >
+inline constexpr bool scalars_are_foldable_v = scalars_are_foldable< S1, S2 >::value;
+
+// Division of Value by Scalar may be rewritten as multiplication by the reciprocal of Scalar
+template < class Value, class Scalar, class = void >
+struct is_reciprocal_divisible : public ::std::false_type { };
+
+template < class Value, class Scalar >
+struct is_reciprocal_divisible< Value, Scalar, ::std::enable_if_t< LINALG::allow_reciprocal_division_v< Scalar > > > :
+  public ::std::is_same< decltype( ::std::declval< Value >() / ::std::declval< ::std::decay_t< Scalar > >() ),
+                         decltype( ::std::declval< Value >() * ::std::declval< ::std::decay_t< Scalar > >() ) >
+{ };
+
+template < class Value, class Scalar >
+inline constexpr bool is_reciprocal_divisible_v = is_reciprocal_divisible< Value, Scalar >::value;
+
+LINALG_EXPRESSIONS_DETAIL_END // expressions detail namespace
+
+#endif  //- LINEAR_ALGEBRA_TENSOR_EXPRESSION_SIMPLIFICATION_HPP
@@ -0,0 +1,270 @@
+//==================================================================================================
+//  File:       symmetric_product.hpp
+//
+//  Summary:    This header defines:
+//              LINALG_DETAIL::is_symmetric< Conjugate >( const Matrix& m )
+//              LINALG_DETAIL::symmetric_rank_k_product< Conjugate, Accumulator >( Tensor& t, const Matrix& a )
+//              LINALG_DETAIL::symmetric_rank_2k_product< Conjugate, Accumulator >( Tensor& t, const Matrix& a, const Matrix& b )
+//              LINALG_DETAIL::symmetric_congruence_product< Conjugate, Accumulator >( Tensor& t, const Matrix& a, const Matrix& s )
+//              LINALG_EXPRESSIONS_DETAIL::symmetric_product( Tensor& t, const Expression& expr )
+//              LINALG_EXPRESSIONS_DETAIL::symmetric_rank_2k_sum( Tensor& t, const Sum& expr )
+//
+//              Products whose result is symmetric, or Hermitian if conjugated, are recognized when the
+//              transposed operand is the same view as the left operand: a * trans( a ), a * s * trans( a )
+//              for symmetric s, and a * trans( b ) + b * trans( a ). Only the lower triangle is computed,
+//              then mirrored into the upper triangle.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_TENSOR_EXPRESSION_SYMMETRIC_PRODUCT_HPP
+#define LINEAR_ALGEBRA_TENSOR_EXPRESSION_SYMMETRIC_PRODUCT_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//-----------------------------
+//  Symmetric Product Kernels
+//-----------------------------
+
+// Number of rows of a * s buffered at a time by the symmetric congruence product
+inline constexpr ::std::size_t symmetric_panel_extent = 8;
+
+// True if the matrix is square and equal to its transpose, or to its conjugate transpose if Conjugate
+template < bool Conjugate, class Matrix >
+[[nodiscard]] bool is_symmetric( const Matrix& m )
+{
+  using index_type = typename Matrix::index_type;
+  if ( static_cast< ::std::size_t >( m.extent(0) ) != static_cast< ::std::size_t >( m.extent(1) ) )
+  {
+    return false;
+  }
+  for ( index_type i = 0; i < m.extent(0); ++i )
+  {
+    for ( index_type j = ( Conjugate ? i : i + 1 ); j < m.extent(1); ++j )
+    {
+      if constexpr ( Conjugate )
+      {
+        if ( LINALG_DETAIL::access( m, i, j ) != LINALG_EXPRESSIONS_DETAIL::conjugate_value( LINALG_DETAIL::access( m, j, i ) ) )
+        {
+          return false;
+        }
+      }
+      else
+      {
+        if ( LINALG_DETAIL::access( m, i, j ) != LINALG_DETAIL::access( m, j, i ) )
+        {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Stores element ( i, j ) of the lower triangle and its mirror in the upper triangle
+template < bool Conjugate, class Tensor, class Accumulator, class IndexType >
+void store_symmetric( Tensor& t, IndexType i, IndexType j, const Accumulator& value )
+{
+  using value_type = typename Tensor::value_type;
+  LINALG_DETAIL::access( t, i, j ) = static_cast< value_type >( value );
+  if ( i != j )
+  {
+    if constexpr ( Conjugate )
+    {
+      LINALG_DETAIL::access( t, j, i ) = static_cast< value_type >( LINALG_EXPRESSIONS_DETAIL::conjugate_value( value ) );
+    }
+    else
+    {
+      LINALG_DETAIL::access( t, j, i ) = static_cast< value_type >( value );
+    }
+  }
+}
+
+// Element k of row j of op( a ), where op is the conjugate if Conjugate
+template < bool Conjugate, class Accumulator, class Matrix, class IndexType >
+[[nodiscard]] Accumulator transposed_element( const Matrix& a, IndexType j, IndexType k )
+{
+  if constexpr ( Conjugate )
+  {
+    return Accumulator( LINALG_EXPRESSIONS_DETAIL::conjugate_value( LINALG_DETAIL::access( a, j, k ) ) );
+  }
+  else
+  {
+    return Accumulator( LINALG_DETAIL::access( a, j, k ) );
+  }
+}
+
+// Computes t = a * trans( a ), or a * conj( a ) if Conjugate, from the lower triangle
+template < bool Conjugate, class Accumulator, class Tensor, class Matrix >
+void symmetric_rank_k_product( Tensor& t, const Matrix& a )
+{
+  using index_type = typename Matrix::index_type;
+  const index_type rows  = a.extent(0);
+  const index_type inner = a.extent(1);
+  for ( index_type i = 0; i < rows; ++i )
+  {
+    for ( index_type j = 0; j <= i; ++j )
+    {
+      Accumulator sum = Accumulator( 0 );
+      for ( index_type k = 0; k < inner; ++k )
+      {
+        sum += Accumulator( LINALG_DETAIL::access( a, i, k ) ) * transposed_element< Conjugate, Accumulator >( a, j, k );
+      }
+      store_symmetric< Conjugate >( t, i, j, sum );
+    }
+  }
+}
+
+// Computes t = a * trans( b ) + b * trans( a ), or with conjugate transposes if Conjugate, from the lower triangle
+template < bool Conjugate, class Accumulator, class Tensor, class FirstMatrix, class SecondMatrix >
+void symmetric_rank_2k_product( Tensor& t, const FirstMatrix& a, const SecondMatrix& b )
+{
+  using index_type = typename FirstMatrix::index_type;
+  const index_type rows  = a.extent(0);
+  const index_type inner = a.extent(1);
+  for ( index_type i = 0; i < rows; ++i )
+  {
+    for ( index_type j = 0; j <= i; ++j )
+    {
+      Accumulator sum = Accumulator( 0 );
+      for ( index_type k = 0; k < inner; ++k )
+      {
+        sum += Accumulator( LINALG_DETAIL::access( a, i, k ) ) * transposed_element< Conjugate, Accumulator >( b, j, k ) +
+               Accumulator( LINALG_DETAIL::access( b, i, k ) ) * transposed_element< Conjugate, Accumulator >( a, j, k );
+      }
+      store_symmetric< Conjugate >( t, i, j, sum );
+    }
+  }
+}
+
+// Computes t = a * s * trans( a ) for symmetric s, or a * s * conj( a ) for Hermitian s if Conjugate.
+// A panel of rows of a * s is evaluated once and reused for every element of the lower triangle in those rows.
+template < bool Conjugate, class Accumulator, class Tensor, class Matrix, class MiddleMatrix >
+void symmetric_congruence_product( Tensor& t, const Matrix& a, const MiddleMatrix& s )
+{
+  using index_type = typename Matrix::index_type;
+  const index_type rows  = a.extent(0);
+  const index_type inner = a.extent(1);
+  const index_type panel = static_cast< index_type >( ::std::min( static_cast< ::std::size_t >( rows ), symmetric_panel_extent ) );
+  ::std::vector< Accumulator > buffer( static_cast< ::std::size_t >( panel ) * static_cast< ::std::size_t >( inner ) );
+  for ( index_type first_row = 0; first_row < rows; first_row += panel )
+  {
+    const index_type height = ::std::min( panel, static_cast< index_type >( rows - first_row ) );
+    ::std::fill( buffer.begin(), buffer.end(), Accumulator( 0 ) );
+    // Rows of a * s
+    for ( index_type r = 0; r < height; ++r )
+    {
+      Accumulator* row = buffer.data() + static_cast< ::std::size_t >( r ) * inner;
+      for ( index_type l = 0; l < inner; ++l )
+      {
+        const Accumulator a_rl = Accumulator( LINALG_DETAIL::access( a, first_row + r, l ) );
+        for ( index_type k = 0; k < inner; ++k )
+        {
+          row[k] += a_rl * Accumulator( LINALG_DETAIL::access( s, l, k ) );
+        }
+      }
+    }
+    // Lower triangle of the panel rows of ( a * s ) * trans( a )
+    for ( index_type r = 0; r < height; ++r )
+    {
+      const index_type   i   = first_row + r;
+      const Accumulator* row = buffer.data() + static_cast< ::std::size_t >( r ) * inner;
+      for ( index_type j = 0; j <= i; ++j )
+      {
+        Accumulator sum = Accumulator( 0 );
+        for ( index_type k = 0; k < inner; ++k )
+        {
+          sum += row[k] * transposed_element< Conjugate, Accumulator >( a, j, k );
+        }
+        store_symmetric< Conjugate >( t, i, j, sum );
+      }
+    }
+  }
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
+
+//---------------------------------
+//  Symmetric Product Recognition
+//---------------------------------
+
+// Transpose or conjugate transpose of the leading two indices
+template < class T >
+inline constexpr bool is_transposed_operand_v = is_transpose_expression_v< T > || is_conjugate_expression_v< T >;
+
+// True if the expression may be evaluated directly into the tensor
+template < class Tensor, class Expression >
+[[nodiscard]] bool is_directly_assignable( const Tensor& t, const Expression& expr )
+{
+  return ( static_cast< ::std::size_t >( t.extent(0) ) == static_cast< ::std::size_t >( expr.extent(0) ) ) &&
+         ( static_cast< ::std::size_t >( t.extent(1) ) == static_cast< ::std::size_t >( expr.extent(1) ) ) &&
+         !LINALG_DETAIL::overlaps( expr, t );
+}
+
+// Assigns a * trans( a ) or a * s * trans( a ), or their conjugate forms, if the transposed operand is
+// the same view as a and s is symmetric
+template < class Tensor, class Expression >
+[[nodiscard]] bool symmetric_product( Tensor& t, const Expression& expr )
+{
+  using first_type  = ::std::decay_t< decltype( expr.first() ) >;
+  using second_type = ::std::decay_t< decltype( expr.second() ) >;
+  if constexpr ( is_transposed_operand_v< second_type > )
+  {
+    constexpr bool conjugate = is_conjugate_expression_v< second_type >;
+    using accumulator_type   = LINALG::accumulation_result_t< Expression >;
+    const auto& a = expr.second().underlying();
+    if constexpr ( is_matrix_product_expression_v< first_type > )
+    {
+      const auto& s = expr.first().second();
+      if ( LINALG_DETAIL::is_same_view( expr.first().first(), a ) && is_directly_assignable( t, expr ) &&
+           LINALG_DETAIL::is_symmetric< conjugate >( s ) )
+      {
+        LINALG_DETAIL::symmetric_congruence_product< conjugate, accumulator_type >( t, a, s );
+        return true;
+      }
+    }
+    else
+    {
+      if ( LINALG_DETAIL::is_same_view( expr.first(), a ) && is_directly_assignable( t, expr ) )
+      {
+        LINALG_DETAIL::symmetric_rank_k_product< conjugate, accumulator_type >( t, a );
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Assigns a * trans( b ) + b * trans( a ), or its conjugate form, if the operands are the same views
+template < class Tensor, class Sum >
+[[nodiscard]] bool symmetric_rank_2k_sum( Tensor& t, const Sum& expr )
+{
+  using first_type  = ::std::decay_t< decltype( expr.first() ) >;
+  using second_type = ::std::decay_t< decltype( expr.second() ) >;
+  if constexpr ( is_addition_expression_v< Sum > && is_matrix_product_expression_v< first_type > && is_matrix_product_expression_v< second_type > )
+  {
+    using first_transposed_type  = ::std::decay_t< decltype( expr.first().second() ) >;
+    using second_transposed_type = ::std::decay_t< decltype( expr.second().second() ) >;
+    if constexpr ( is_transposed_operand_v< first_transposed_type > && is_transposed_operand_v< second_transposed_type > &&
+                   ( is_conjugate_expression_v< first_transposed_type > == is_conjugate_expression_v< second_transposed_type > ) )
+    {
+      constexpr bool conjugate = is_conjugate_expression_v< first_transposed_type >;
+      using accumulator_type   = LINALG::accumulation_result_t< Sum >;
+      const auto& a = expr.first().first();
+      const auto& b = expr.first().second().underlying();
+      if ( LINALG_DETAIL::is_same_view( expr.second().first(), b ) && LINALG_DETAIL::is_same_view( expr.second().second().underlying(), a ) &&
+           is_directly_assignable( t, expr ) )
+      {
+        LINALG_DETAIL::symmetric_rank_2k_product< conjugate, accumulator_type >( t, a, b );
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+LINALG_EXPRESSIONS_DETAIL_END // expressions detail namespace
+
+#endif  //- LINEAR_ALGEBRA_TENSOR_EXPRESSION_SYMMETRIC_PRODUCT_HPP
@@ -7,9 +7,16 @@
 //              allocator_result< Tensor >
 //              layout_result< Tensor >
 //              is_alias_assignable< Tensor >
+//              accumulation_type< T >
+//              accumulation_result< Tensor >
+//              in_place_assignment< Tensor, Expression >
+//              rewritten_assignment< Tensor, Expression >
+//              allow_reciprocal_division< Scalar >
 //
 //              is_commutative< TE >
 //              is_associative< FirstTE, SecondTE >
+//              is_left_distributive< FirstTE, SecondTE >
+//              is_right_distributive< FirstTE, SecondTE >
 //              is_distributive< FirstTE, SecondTE >
 //              layout_result< Tensor >
 //              accessor_result< Tensor >
@@ -151,6 +158,108 @@ struct is_alias_assignable : public ::std::false_type { };
 template < class Tensor >
 inline constexpr bool is_alias_assignable_v = is_alias_assignable< Tensor >::value;
 
+//---------------------
+//  Accumulation Type
+//---------------------
+
+// Accumulation type defines the type in which sums of products of T are accumulated.
+// Narrow types are widened so long reductions neither lose precision nor overflow.
+template < class T >
+struct accumulation_type { using type = T; };
+
+template < >
+struct accumulation_type< float > { using type = double; };
+
+template < class T >
+struct accumulation_type< ::std::complex< T > > { using type = ::std::complex< typename accumulation_type< T >::type >; };
+
+// Plain char is distinct from signed char and unsigned char, with either signedness
+template < >
+struct accumulation_type< char > { using type = ::std::conditional_t< ::std::is_signed_v< char >, ::std::int_least32_t, ::std::uint_least32_t >; };
+
+template < >
+struct accumulation_type< signed char > { using type = ::std::int_least32_t; };
+
+template < >
+struct accumulation_type< unsigned char > { using type = ::std::uint_least32_t; };
+
+template < >
+struct accumulation_type< short > { using type = ::std::int_least32_t; };
+
+template < >
+struct accumulation_type< unsigned short > { using type = ::std::uint_least32_t; };
+
+#if defined( __STDCPP_FLOAT16_T__ )
+template < >
+struct accumulation_type< ::std::float16_t > { using type = float; };
+#endif
+
+#if defined( __STDCPP_BFLOAT16_T__ )
+template < >
+struct accumulation_type< ::std::bfloat16_t > { using type = float; };
+#endif
+
+template < class T >
+using accumulation_type_t = typename accumulation_type< T >::type;
+
+//-----------------------
+//  Accumulation Result
+//-----------------------
+
+// Accumulation result defines the type in which a product or reduction expression accumulates.
+// By default it follows the accumulation type of the expression's value type. It may be
+// specialized for any particular expression to override the default.
+template < class Tensor >
+struct accumulation_result
+{
+  using type = accumulation_type_t< typename ::std::remove_reference_t< Tensor >::value_type >;
+};
+
+template < class Tensor >
+using accumulation_result_t = typename accumulation_result< Tensor >::type;
+
+//-----------------------
+//  In Place Assignment
+//-----------------------
+
+// In place assignment evaluates an expression into a tensor which one of its operands shares storage
+// with, using less memory than a full temporary. apply returns false if it cannot, in which case the
+// caller falls back to a temporary. It may be specialized for any particular expression.
+template < class Tensor, class Expression >
+struct in_place_assignment
+{
+  [[nodiscard]] static constexpr bool apply( [[maybe_unused]] Tensor& t, [[maybe_unused]] const Expression& expr ) noexcept { return false; }
+};
+
+// Rewritten assignment evaluates an expression into a tensor through an equivalent expression tree
+// which is estimated to be cheaper, as permitted by the algebraic traits of its nodes. apply returns
+// false if no rewrite reduces the cost, in which case the caller evaluates the expression as written.
+// It may be specialized for any particular expression.
+template < class Tensor, class Expression >
+struct rewritten_assignment
+{
+  [[nodiscard]] static constexpr bool apply( [[maybe_unused]] Tensor& t, [[maybe_unused]] const Expression& expr ) noexcept { return false; }
+};
+
+//-----------------------------
+//  Allow Reciprocal Division
+//-----------------------------
+
+// Allow reciprocal division permits division by a scalar to be rewritten as multiplication by its
+// precomputed reciprocal, which may differ from true division in the last bit. It is opt in, enabled
+// for floating point scalars by defining LINALG_ENABLE_RECIPROCAL_DIVISION, and may be specialized for
+// any particular scalar type.
+template < class Scalar >
+struct allow_reciprocal_division :
+#ifdef LINALG_ENABLE_RECIPROCAL_DIVISION
+  public ::std::is_floating_point< Scalar >
+#else
+  public ::std::false_type
+#endif
+{ };
+
+template < class Scalar >
+inline constexpr bool allow_reciprocal_division_v = allow_reciprocal_division< ::std::decay_t< Scalar > >::value;
 
 
 
@@ -171,7 +280,8 @@ template < class TE, typename = ::std::enable_if_t< LINALG_CONCEPTS::binary_tens
 #endif
 inline constexpr bool is_commutative_v = is_commutative< TE >::value;
 
-// Is Associative
+// Is Associative is true if an expression TE1 with an operand TE2 may be regrouped, e.g. ( a * b ) * c
+// may be evaluated as a * ( b * c )
 #ifdef LINALG_ENABLE_CONCEPTS
 template < LINALG_CONCEPTS::binary_tensor_expression TE1, LINALG_CONCEPTS::binary_tensor_expression TE2 = TE1 >
 #else
@@ -185,7 +295,8 @@ template < class TE1, class TE2, typename = ::std::enable_if_t< LINALG_CONCEPTS:
 #endif
 inline constexpr bool is_associative_v = is_associative< TE1, TE2 >::value;
 
-// Is Distributive
+// Is Left Distributive is true if TE1 distributes over an operand TE2 from the left, e.g. a * ( b + c )
+// is equivalent to a * b + a * c, and Is Right Distributive if ( b + c ) * a is equivalent to b * a + c * a
 #ifdef LINALG_ENABLE_CONCEPTS
 template < LINALG_CONCEPTS::binary_tensor_expression TE1, LINALG_CONCEPTS::binary_tensor_expression TE2 = TE1 >
 #else
@@ -211,6 +322,8 @@ template < LINALG_CONCEPTS::binary_tensor_expression TE1, LINALG_CONCEPTS::binar
 template < class TE1, class TE2, typename = ::std::enable_if_t< LINALG_CONCEPTS::binary_tensor_expression_v< TE1 > && LINALG_CONCEPTS::binary_tensor_expression_v< TE2 > > >
 #endif
 inline constexpr bool is_right_distributive_v = is_right_distributive< TE1, TE2 >::value;
+
+// Is Distributive is true if TE1 distributes over TE2 from both sides
 #ifdef LINALG_ENABLE_CONCEPTS
 template < class TE1, LINALG_CONCEPTS::binary_tensor_expression TE2 = TE1 >
   requires ( LINALG_CONCEPTS::binary_tensor_expression< TE1 > || LINALG_CONCEPTS::unary_tensor_expression< TE1 > )
@@ -223,7 +336,7 @@ struct is_distributive : public ::std::conditional_t<
 #else
                                                       LINALG_CONCEPTS::binary_tensor_expression_v< TE1 >,
 #endif
-                                                      ::std::conditional_t< is_commutative_v< TE1, TE2 > && is_left_distributive_v< TE1, TE2 > && is_right_distributive_v< TE1, TE2 >,
+                                                      ::std::conditional_t< is_left_distributive_v< TE1, TE2 > && is_right_distributive_v< TE1, TE2 >,
                                                                             ::std::true_type,
                                                                             ::std::false_type >,
                                                       ::std::false_type >
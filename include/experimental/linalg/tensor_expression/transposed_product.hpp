@@ -0,0 +1,231 @@
+//==================================================================================================
+//  File:       transposed_product.hpp
+//
+//  Summary:    This header defines:
+//              LINALG_DETAIL::transposed_matrix_product< Accumulator >( Tensor& t, const Expression& expr )
+//              LINALG_DETAIL::transposed_matrix_vector_product< Accumulator >( Tensor& t, const Expression& expr )
+//              LINALG_EXPRESSIONS_DETAIL::transposed_product( Tensor& t, const Expression& expr )
+//
+//              A product whose first operand is a transposed row major leaf is evaluated with the
+//              loops ordered so the leaf is read along its rows: trans( a ) * b and trans( a ) * x as
+//              sums of rank one updates over the rows of a, and trans( a ) * trans( b ) one column of
+//              an output tile at a time. The element-wise dot product would read a down its columns.
+//              The result is accumulated in place, or in a stack buffer of one output tile when the
+//              accumulation type is wider than its elements, so no evaluation allocates.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_TENSOR_EXPRESSION_TRANSPOSED_PRODUCT_HPP
+#define LINEAR_ALGEBRA_TENSOR_EXPRESSION_TRANSPOSED_PRODUCT_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//------------------------------
+//  Transposed Product Kernels
+//------------------------------
+
+// Rows and columns of the output tile accumulated in a stack buffer when the accumulation type is wider
+inline constexpr ::std::size_t transposed_tile_extent = 32;
+
+/// @brief Evaluates op( a ) * op( b ) into t for a transposed first operand, reading its leaf along rows
+template < class Accumulator, class Tensor, class Expression >
+void transposed_matrix_product( Tensor& t, const Expression& expr )
+{
+  using value_type     = typename Tensor::value_type;
+  using first_type     = decltype( expr.first() );
+  using second_type    = decltype( expr.second() );
+  using first_operand  = LINALG_EXPRESSIONS_DETAIL::product_operand_t< first_type >;
+  using second_operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< second_type >;
+  const auto& a = first_operand::leaf( expr.first() );
+  const auto& b = second_operand::leaf( expr.second() );
+  const ::std::size_t rows    = static_cast< ::std::size_t >( expr.extent(0) );
+  const ::std::size_t columns = static_cast< ::std::size_t >( expr.extent(1) );
+  const ::std::size_t inner   = static_cast< ::std::size_t >( expr.first().extent(1) );
+  Accumulator alpha = Accumulator( 1 );
+  if constexpr ( first_operand::scaled || second_operand::scaled )
+  {
+    alpha = LINALG_EXPRESSIONS_DETAIL::operand_alpha< first_type, Accumulator >( expr.first() ) *
+            LINALG_EXPRESSIONS_DETAIL::operand_alpha< second_type, Accumulator >( expr.second() );
+  }
+  if constexpr ( ::std::is_same_v< Accumulator, value_type > && !second_operand::transposed )
+  {
+    // Row k of each leaf contributes a rank one update to the whole result, accumulated in place
+    for ( ::std::size_t i = 0; i < rows; ++i )
+    {
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        LINALG_DETAIL::access( t, i, j ) = value_type( 0 );
+      }
+    }
+    for ( ::std::size_t k = 0; k < inner; ++k )
+    {
+      for ( ::std::size_t i = 0; i < rows; ++i )
+      {
+        const value_type a_ik = alpha * value_type( LINALG_EXPRESSIONS_DETAIL::read_operand< first_type >( a, i, k ) );
+        for ( ::std::size_t j = 0; j < columns; ++j )
+        {
+          LINALG_DETAIL::access( t, i, j ) += a_ik * value_type( LINALG_EXPRESSIONS_DETAIL::read_operand< second_type >( b, k, j ) );
+        }
+      }
+    }
+  }
+  else
+  {
+    // Each tile of the result is accumulated from rows of the leaves: by rank one updates, or one column of
+    // the tile at a time for a transposed second operand
+    ::std::array< Accumulator, transposed_tile_extent * transposed_tile_extent > tile;
+    for ( ::std::size_t first_row = 0; first_row < rows; first_row += transposed_tile_extent )
+    {
+      const ::std::size_t height = ::std::min( transposed_tile_extent, rows - first_row );
+      for ( ::std::size_t first_col = 0; first_col < columns; first_col += transposed_tile_extent )
+      {
+        const ::std::size_t width = ::std::min( transposed_tile_extent, columns - first_col );
+        tile.fill( Accumulator( 0 ) );
+        if constexpr ( second_operand::transposed )
+        {
+          for ( ::std::size_t c = 0; c < width; ++c )
+          {
+            Accumulator* column = tile.data() + c * transposed_tile_extent;
+            for ( ::std::size_t k = 0; k < inner; ++k )
+            {
+              const Accumulator b_kj = Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< second_type >( b, k, first_col + c ) );
+              for ( ::std::size_t r = 0; r < height; ++r )
+              {
+                column[r] += Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< first_type >( a, first_row + r, k ) ) * b_kj;
+              }
+            }
+          }
+        }
+        else
+        {
+          for ( ::std::size_t k = 0; k < inner; ++k )
+          {
+            for ( ::std::size_t r = 0; r < height; ++r )
+            {
+              const Accumulator a_ik = Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< first_type >( a, first_row + r, k ) );
+              Accumulator*      row  = tile.data() + r * transposed_tile_extent;
+              for ( ::std::size_t c = 0; c < width; ++c )
+              {
+                row[c] += a_ik * Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< second_type >( b, k, first_col + c ) );
+              }
+            }
+          }
+        }
+        for ( ::std::size_t r = 0; r < height; ++r )
+        {
+          for ( ::std::size_t c = 0; c < width; ++c )
+          {
+            const Accumulator sum = second_operand::transposed ? tile[ c * transposed_tile_extent + r ] : tile[ r * transposed_tile_extent + c ];
+            LINALG_DETAIL::access( t, first_row + r, first_col + c ) = static_cast< value_type >( alpha * sum );
+          }
+        }
+      }
+    }
+  }
+}
+
+/// @brief Evaluates op( a ) * x into t for a transposed matrix operand, reading its leaf along rows
+template < class Accumulator, class Tensor, class Expression >
+void transposed_matrix_vector_product( Tensor& t, const Expression& expr )
+{
+  using value_type     = typename Tensor::value_type;
+  using matrix_type    = decltype( expr.first() );
+  using vector_type    = decltype( expr.second() );
+  using matrix_operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< matrix_type >;
+  using vector_operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< vector_type >;
+  const auto& a = matrix_operand::leaf( expr.first() );
+  const auto& x = vector_operand::leaf( expr.second() );
+  const ::std::size_t rows  = static_cast< ::std::size_t >( expr.extent(0) );
+  const ::std::size_t inner = static_cast< ::std::size_t >( expr.first().extent(1) );
+  Accumulator alpha = Accumulator( 1 );
+  if constexpr ( matrix_operand::scaled || vector_operand::scaled )
+  {
+    alpha = LINALG_EXPRESSIONS_DETAIL::operand_alpha< matrix_type, Accumulator >( expr.first() ) *
+            LINALG_EXPRESSIONS_DETAIL::operand_alpha< vector_type, Accumulator >( expr.second() );
+  }
+  if constexpr ( ::std::is_same_v< Accumulator, value_type > )
+  {
+    // Row k of the leaf is scaled by x_k and accumulated in place
+    for ( ::std::size_t i = 0; i < rows; ++i )
+    {
+      LINALG_DETAIL::access( t, i ) = value_type( 0 );
+    }
+    for ( ::std::size_t k = 0; k < inner; ++k )
+    {
+      const value_type x_k = alpha * value_type( LINALG_EXPRESSIONS_DETAIL::read_operand< vector_type >( x, k ) );
+      for ( ::std::size_t i = 0; i < rows; ++i )
+      {
+        LINALG_DETAIL::access( t, i ) += value_type( LINALG_EXPRESSIONS_DETAIL::read_operand< matrix_type >( a, i, k ) ) * x_k;
+      }
+    }
+  }
+  else
+  {
+    // Panels of the result are accumulated in a stack buffer, each from the same part of every row of the leaf
+    ::std::array< Accumulator, transposed_tile_extent * transposed_tile_extent > panel;
+    for ( ::std::size_t first_row = 0; first_row < rows; first_row += panel.size() )
+    {
+      const ::std::size_t height = ::std::min( panel.size(), rows - first_row );
+      panel.fill( Accumulator( 0 ) );
+      for ( ::std::size_t k = 0; k < inner; ++k )
+      {
+        const Accumulator x_k = Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< vector_type >( x, k ) );
+        for ( ::std::size_t r = 0; r < height; ++r )
+        {
+          panel[r] += Accumulator( LINALG_EXPRESSIONS_DETAIL::read_operand< matrix_type >( a, first_row + r, k ) ) * x_k;
+        }
+      }
+      for ( ::std::size_t r = 0; r < height; ++r )
+      {
+        LINALG_DETAIL::access( t, first_row + r ) = static_cast< value_type >( alpha * panel[r] );
+      }
+    }
+  }
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
+
+//-------------------------------
+//  Transposed Product Dispatch
+//-------------------------------
+
+// Assigns a matrix or matrix vector product whose first operand is a transposed row major leaf, unless it reads an inverse
+template < class Tensor, class Expression >
+[[nodiscard]] bool transposed_product( Tensor& t, const Expression& expr )
+{
+  using first_type    = decltype( expr.first() );
+  using first_operand = product_operand_t< first_type >;
+  if constexpr ( ( ::std::remove_reference_t< first_type >::rank() == 2 ) && first_operand::transposed &&
+                 ::std::is_same_v< operand_layout_t< typename first_operand::leaf_type >, ::std::layout_right > &&
+                 !reads_inverse< Expression >() )
+  {
+    if constexpr ( Expression::rank() == 2 )
+    {
+      if ( !is_directly_assignable( t, expr ) )
+      {
+        return false;
+      }
+      LINALG_DETAIL::transposed_matrix_product< LINALG::accumulation_result_t< Expression > >( t, expr );
+    }
+    else
+    {
+      if ( ( static_cast< ::std::size_t >( t.extent(0) ) != static_cast< ::std::size_t >( expr.extent(0) ) ) || LINALG_DETAIL::overlaps( expr, t ) )
+      {
+        return false;
+      }
+      LINALG_DETAIL::transposed_matrix_vector_product< LINALG::accumulation_result_t< Expression > >( t, expr );
+    }
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+LINALG_EXPRESSIONS_DETAIL_END // expressions detail namespace
+
+#endif  //- LINEAR_ALGEBRA_TENSOR_EXPRESSION_TRANSPOSED_PRODUCT_HPP
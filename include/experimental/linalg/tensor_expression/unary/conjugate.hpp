@@ -178,7 +178,10 @@ template < class Tensor, class Transpose >
 class conjugate_tensor_expression_traits
 {
   public:
-    using value_type   = decltype( ::std::conj( ::std::declval< typename ::std::remove_reference_t< Tensor >::value_type >() ) );
+    // Conjugation of real values is the identity so does not promote them to complex
+    using value_type   = ::std::conditional_t< is_real_value_v< typename ::std::remove_reference_t< Tensor >::value_type >,
+                                               ::std::remove_cv_t< typename ::std::remove_reference_t< Tensor >::value_type >,
+                                               decltype( ::std::conj( ::std::declval< typename ::std::remove_reference_t< Tensor >::value_type >() ) ) >;
     using index_type   = typename ::std::remove_reference_t< Tensor >::index_type;
     using size_type    = typename ::std::remove_reference_t< Tensor >::size_type;
     using extents_type = typename transpose_helper< typename ::std::remove_reference_t< Tensor >::extents_type, Transpose >::extents_type;
@@ -259,11 +262,11 @@ class conjugate_tensor_expression :
     {
       if constexpr ( ::std::remove_reference_t< Tensor >::rank() == 1 )
       {
-        return ::std::conj( LINALG_DETAIL::access( this->t_, indices ... ) );
+        return LINALG_EXPRESSIONS_DETAIL::conjugate_value( LINALG_DETAIL::access( this->t_, indices ... ) );
       }
       else
       {
-        return ::std::conj( helper_type::access( this->t_, this->indices_, indices ... ) );
+        return LINALG_EXPRESSIONS_DETAIL::conjugate_value( helper_type::access( this->t_, this->indices_, indices ... ) );
       }
     }
     #endif
@@ -276,11 +279,11 @@ class conjugate_tensor_expression :
     {
       if constexpr ( ::std::remove_reference_t< Tensor >::rank() == 1 )
       {
-        return ::std::conj( LINALG_DETAIL::access( this->t_, indices ... ) );
+        return LINALG_EXPRESSIONS_DETAIL::conjugate_value( LINALG_DETAIL::access( this->t_, indices ... ) );
       }
       else
       {
-        return ::std::conj( helper_type::access( this->t_, this->indices_, indices ... ) );
+        return LINALG_EXPRESSIONS_DETAIL::conjugate_value( helper_type::access( this->t_, this->indices_, indices ... ) );
       }
     }
     #endif
@@ -350,7 +353,19 @@ conj( const T& t ) noexcept
              ( ::std::remove_reference_t< T >::rank() < 3 ) )
 #endif
 {
-  return LINALG_EXPRESSIONS::conjugate_tensor_expression< const T&, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<> >( t, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<> {} );
+  // Conjugate transposition is an involution, and is a plain transpose of real values
+  if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_conjugate_expression_v< T > )
+  {
+    return t.underlying();
+  }
+  else if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_real_value_v< typename T::value_type > )
+  {
+    return trans( t );
+  }
+  else
+  {
+    return LINALG_EXPRESSIONS::conjugate_tensor_expression< const T&, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<> >( t, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<> {} );
+  }
 }
 
 #ifdef LINALG_ENABLE_CONCEPTS
@@ -369,7 +384,15 @@ conj( const T& t, const LINALG_EXPRESSIONS_DETAIL::transpose_indices_t< index1,
                                                                                        LINALG_EXPRESSIONS_DETAIL::transpose_indices_t< index1, index2 > >
 #endif
 {
-  return LINALG_EXPRESSIONS::conjugate_tensor_expression< const T&, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t< index1, index2 > >( t, indices );
+  // Conjugate transposition of real values is a plain transpose
+  if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_real_value_v< typename T::value_type > )
+  {
+    return trans( t, indices );
+  }
+  else
+  {
+    return LINALG_EXPRESSIONS::conjugate_tensor_expression< const T&, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t< index1, index2 > >( t, indices );
+  }
 }
 
 #ifdef LINALG_ENABLE_CONCEPTS
@@ -388,7 +411,15 @@ conj( const T& t, IndexType index1, IndexType index2 ) noexcept
                                                                                        LINALG_EXPRESSIONS_DETAIL::transpose_indices_v< IndexType, IndexType > >
 #endif
 {
-  return LINALG_EXPRESSIONS::conjugate_tensor_expression< const T&, LINALG_EXPRESSIONS_DETAIL::transpose_indices_v< IndexType, IndexType > >( t, LINALG_EXPRESSIONS_DETAIL::transpose_indices_v< IndexType, IndexType > { index1, index2 } );
+  // Conjugate transposition of real values is a plain transpose
+  if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_real_value_v< typename T::value_type > )
+  {
+    return trans( t, index1, index2 );
+  }
+  else
+  {
+    return LINALG_EXPRESSIONS::conjugate_tensor_expression< const T&, LINALG_EXPRESSIONS_DETAIL::transpose_indices_v< IndexType, IndexType > >( t, LINALG_EXPRESSIONS_DETAIL::transpose_indices_v< IndexType, IndexType > { index1, index2 } );
+  }
 }
 
 LINALG_END // linalg namespace
@@ -329,7 +329,15 @@ operator - ( const T& t ) noexcept
   requires ::std::is_constructible_v< LINALG_EXPRESSIONS::negate_tensor_expression< const T& >, const T& >
 #endif
 {
-  return LINALG_EXPRESSIONS::negate_tensor_expression< const T& >( t );
+  // Negation is an involution
+  if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_negate_expression_v< T > )
+  {
+    return t.underlying();
+  }
+  else
+  {
+    return LINALG_EXPRESSIONS::negate_tensor_expression< const T& >( t );
+  }
 }
 
 LINALG_END // linalg namespace
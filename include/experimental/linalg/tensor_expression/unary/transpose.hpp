@@ -573,7 +573,15 @@ trans( const T& t ) noexcept
              ( ::std::remove_reference_t< T >::rank() < 3 ) )
 #endif
 {
-  return LINALG_EXPRESSIONS::transpose_tensor_expression< const T& >( t, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<> {} );
+  // Transposition is an involution
+  if constexpr ( LINALG_EXPRESSIONS_DETAIL::is_transpose_expression_v< T > )
+  {
+    return t.underlying();
+  }
+  else
+  {
+    return LINALG_EXPRESSIONS::transpose_tensor_expression< const T& >( t, LINALG_EXPRESSIONS_DETAIL::transpose_indices_t<> {} );
+  }
 }
 
 #ifdef LINALG_ENABLE_CONCEPTS
@@ -0,0 +1,345 @@
+//==================================================================================================
+//  File:       triangular_solve.hpp
+//
+//  Summary:    This header defines triangular solves as lazily evaluated expressions:
+//              LINALG_EXPRESSIONS::triangular_solve_expression< Triangle, Rhs, Lower >
+//              LINALG::rewritten_assignment< Tensor, LINALG_EXPRESSIONS::triangular_solve_expression< Triangle, Rhs, Lower > >
+//              LINALG::in_place_assignment< Tensor, LINALG_EXPRESSIONS::triangular_solve_expression< Triangle, Rhs, Lower > >
+//              LINALG::solve_lower( const M& t, const B& b )
+//              LINALG::solve_upper( const M& t, const B& b )
+//
+//              solve_lower( t, b ) and solve_upper( t, b ) stand for inverse( t ) * b, reading only the
+//              lower or upper triangle of t, for a vector or a matrix of right hand sides b. Assigning
+//              the expression to a tensor copies b into it and solves in place, with no temporary when
+//              the tensor is b itself. The solve is blocked: each diagonal block is solved by
+//              substitution, then the rows yet to be solved are updated by a product with the solved
+//              block. Tiles of columns of the right hand sides are solved in parallel for large problems.
+//              The triangle may be a transpose or conjugate transpose expression, which is read through
+//              rather than evaluated.
+//==================================================================================================
+
+#ifndef LINEAR_ALGEBRA_TRIANGULAR_SOLVE_HPP
+#define LINEAR_ALGEBRA_TRIANGULAR_SOLVE_HPP
+
+#include <experimental/linear_algebra.hpp>
+
+LINALG_DETAIL_BEGIN // linalg detail namespace
+
+//-----------------------------
+//  Blocked Triangular Solves
+//-----------------------------
+
+// Rows of the diagonal block solved by substitution before the remaining rows are updated
+inline constexpr ::std::size_t triangular_block_extent = 64;
+
+/// @brief Solves op( t ) x = x in place over the columns [first, first + count) of x
+/// @tparam Lower true if op( t ) is lower triangular
+/// @tparam Triangle triangle operand type, read through its leaf t
+template < bool Lower, class Triangle, class Leaf, class X >
+void triangular_solve_columns( const Leaf& t, const matrix_block< X >& x, ::std::size_t first, ::std::size_t count )
+{
+  using value_type = typename matrix_block< X >::value_type;
+  const auto element = [&]( ::std::size_t i, ::std::size_t k ) { return LINALG_EXPRESSIONS_DETAIL::read_operand< Triangle >( t, i, k ); };
+  const ::std::size_t n    = x.extent(0);
+  const ::std::size_t last = first + count;
+  for ( ::std::size_t step = 0; step < n; step += triangular_block_extent )
+  {
+    const ::std::size_t width = ::std::min( triangular_block_extent, n - step );
+    const ::std::size_t diag  = Lower ? step : n - step - width;
+    // Substitution within the diagonal block
+    for ( ::std::size_t s = 0; s < width; ++s )
+    {
+      const ::std::size_t i     = Lower ? diag + s : diag + width - 1 - s;
+      const ::std::size_t begin = Lower ? diag : i + 1;
+      const ::std::size_t end   = Lower ? i : diag + width;
+      const value_type    t_ii  = value_type( element( i, i ) );
+      for ( ::std::size_t j = first; j < last; ++j )
+      {
+        value_type sum = x( i, j );
+        for ( ::std::size_t k = begin; k < end; ++k )
+        {
+          sum -= value_type( element( i, k ) ) * x( k, j );
+        }
+        x( i, j ) = sum / t_ii;
+      }
+    }
+    // Product of the solved block with the rows yet to be solved
+    const ::std::size_t begin = Lower ? diag + width : 0;
+    const ::std::size_t end   = Lower ? n : diag;
+    for ( ::std::size_t i = begin; i < end; ++i )
+    {
+      for ( ::std::size_t k = diag; k < diag + width; ++k )
+      {
+        const value_type t_ik = value_type( element( i, k ) );
+        for ( ::std::size_t j = first; j < last; ++j )
+        {
+          x( i, j ) -= t_ik * x( k, j );
+        }
+      }
+    }
+  }
+}
+
+/// @brief Solves op( t ) x = x in place, with tiles of columns of x solved in parallel for large problems
+template < bool Lower, class Triangle, class X >
+void triangular_solve_in_place( const Triangle& triangle, X& x )
+{
+  using operand    = LINALG_EXPRESSIONS_DETAIL::product_operand_t< Triangle >;
+  using value_type = typename matrix_block< X >::value_type;
+  const auto&         leaf    = operand::leaf( triangle );
+  const auto          block   = LINALG_DETAIL::make_block( x );
+  const ::std::size_t rows    = block.extent(0);
+  const ::std::size_t columns = block.extent(1);
+  ::std::vector< ::std::size_t > tiles( ( columns + parallel_tile_extent - 1 ) / parallel_tile_extent );
+  ::std::iota( tiles.begin(), tiles.end(), ::std::size_t( 0 ) );
+  // Cache the last exception to be thrown
+  ::std::exception_ptr eptr;
+  const auto solve_tile = [&]( ::std::size_t tile ) noexcept
+  {
+    try
+    {
+      const ::std::size_t first = tile * parallel_tile_extent;
+      triangular_solve_columns< Lower, Triangle >( leaf, block, first, ::std::min( parallel_tile_extent, columns - first ) );
+    }
+    catch ( ... ) { eptr = ::std::current_exception(); }
+  };
+  if ( rows * rows * columns < parallel_product_threshold )
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_SEQ, tiles.begin(), tiles.end(), solve_tile );
+  }
+  else
+  {
+    LINALG_DETAIL::for_each( LINALG_EXECUTION_PAR, tiles.begin(), tiles.end(), solve_tile );
+  }
+  // If exceptions were thrown, rethrow the last
+  if ( eptr ) LINALG_UNLIKELY
+  {
+    ::std::rethrow_exception( eptr );
+  }
+  if constexpr ( operand::scaled )
+  {
+    // inverse( alpha t ) = inverse( t ) / alpha
+    const value_type alpha = LINALG_EXPRESSIONS_DETAIL::operand_alpha< Triangle, value_type >( triangle );
+    for ( ::std::size_t i = 0; i < rows; ++i )
+    {
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        block( i, j ) /= alpha;
+      }
+    }
+  }
+}
+
+LINALG_DETAIL_END // linalg detail namespace
+
+LINALG_EXPRESSIONS_BEGIN // expressions namespace
+
+//-------------------------------
+//  Triangular Solve Expression
+//-------------------------------
+
+/// @brief Expression for inverse( t ) * b, with t lower triangular if Lower is true and upper triangular otherwise
+/// @tparam Triangle square matrix expression, reference qualified
+/// @tparam Rhs vector or matrix expression of right hand sides, reference qualified
+template < class Triangle, class Rhs, bool Lower >
+class triangular_solve_expression
+{
+  private:
+    using triangle_type = ::std::remove_reference_t< Triangle >;
+    using rhs_type      = ::std::remove_reference_t< Rhs >;
+  public:
+    // Aliases
+    using value_type     = ::std::remove_cv_t< decltype( ::std::declval< typename rhs_type::value_type >() / ::std::declval< typename triangle_type::value_type >() ) >;
+    using index_type     = typename rhs_type::index_type;
+    using size_type      = typename rhs_type::size_type;
+    using extents_type   = typename rhs_type::extents_type;
+    using rank_type      = typename rhs_type::rank_type;
+    using evaluated_type = LINALG_DETAIL::solution_type_t< value_type, rhs_type >;
+    // Special member functions
+    constexpr triangular_solve_expression( Triangle&& t, Rhs&& b ) : t_( t ), b_( b )
+    {
+      if ( ( static_cast< ::std::size_t >( t.extent(0) ) != static_cast< ::std::size_t >( t.extent(1) ) ) ||
+           ( static_cast< ::std::size_t >( t.extent(1) ) != static_cast< ::std::size_t >( b.extent(0) ) ) ) LINALG_UNLIKELY
+      {
+        throw ::std::length_error( "Matrix extents are incompatable." );
+      }
+    }
+    // Tensor expression functions
+    [[nodiscard]] static constexpr rank_type rank() noexcept { return rhs_type::rank(); }
+    [[nodiscard]] constexpr extents_type extents() const noexcept { return this->b_.extents(); }
+    [[nodiscard]] constexpr index_type extent( rank_type n ) const noexcept { return this->b_.extent( n ); }
+    // Binary tensor expression function
+    [[nodiscard]] constexpr const triangle_type& first() const noexcept { return this->t_; }
+    [[nodiscard]] constexpr const rhs_type& second() const noexcept { return this->b_; }
+    // Triangular solve
+    #if LINALG_USE_BRACKET_OPERATOR
+    template < class ... OtherIndexType >
+    [[nodiscard]] constexpr value_type operator[]( OtherIndexType ... indices ) const
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ( sizeof...( OtherIndexType ) == rank() ) && ( ::std::is_convertible_v< OtherIndexType, index_type > && ... )
+    #endif
+      { return this->access( indices ... ); }
+    #endif
+    #if LINALG_USE_PAREN_OPERATOR
+    template < class ... OtherIndexType >
+    [[nodiscard]] constexpr value_type operator()( OtherIndexType ... indices ) const
+    #ifdef LINALG_ENABLE_CONCEPTS
+      requires ( sizeof...( OtherIndexType ) == rank() ) && ( ::std::is_convertible_v< OtherIndexType, index_type > && ... )
+    #endif
+      { return this->access( indices ... ); }
+    #endif
+    // Implicit conversion
+    [[nodiscard]] operator evaluated_type() const { return this->evaluate(); }
+    // Evaluated expression
+    [[nodiscard]] evaluated_type evaluate() const
+    {
+      evaluated_type x = LINALG_DETAIL::make_solution< value_type >( this->b_ );
+      LINALG_DETAIL::triangular_solve_in_place< Lower >( this->t_, x );
+      return x;
+    }
+  private:
+    // Access solves for the one element by substitution, which only needs the rows it depends on
+    template < class ... IndexType >
+    [[nodiscard]] constexpr value_type access( IndexType ... indices ) const
+    {
+      using operand = LINALG_EXPRESSIONS_DETAIL::product_operand_t< Triangle >;
+      const ::std::size_t index[] = { static_cast< ::std::size_t >( indices ) ... };
+      const ::std::size_t i       = index[0];
+      const ::std::size_t n       = static_cast< ::std::size_t >( this->b_.extent(0) );
+      const auto&         leaf    = operand::leaf( this->t_ );
+      const auto rhs = [&]( ::std::size_t r ) -> value_type
+      {
+        if constexpr ( rank() == 1 ) { return value_type( LINALG_DETAIL::access( this->b_, r ) ); }
+        else                         { return value_type( LINALG_DETAIL::access( this->b_, r, index[1] ) ); }
+      };
+      const auto element = [&]( ::std::size_t r, ::std::size_t k ) { return value_type( read_operand< Triangle >( leaf, r, k ) ); };
+      // Solution of rows first to i for a lower triangle, n - 1 down to i for an upper one
+      const ::std::size_t first = Lower ? 0 : i;
+      ::std::vector< value_type > x( Lower ? i + 1 : n - i );
+      for ( ::std::size_t s = 0; s < x.size(); ++s )
+      {
+        const ::std::size_t r   = Lower ? s : n - 1 - s;
+        value_type          sum = rhs( r );
+        for ( ::std::size_t k = ( Lower ? 0 : r + 1 ); k < ( Lower ? r : n ); ++k )
+        {
+          sum -= element( r, k ) * x[ k - first ];
+        }
+        x[ r - first ] = sum / element( r, r );
+      }
+      value_type result = x[ i - first ];
+      if constexpr ( operand::scaled )
+      {
+        result /= operand_alpha< Triangle, value_type >( this->t_ );
+      }
+      return result;
+    }
+    // Data
+    Triangle& t_;
+    Rhs&      b_;
+};
+
+LINALG_EXPRESSIONS_END // end expressions namespace
+
+LINALG_EXPRESSIONS_DETAIL_BEGIN // expressions detail namespace
+
+// Copies the right hand sides into a tensor which does not overlap the expression and solves there
+template < class Tensor, class Triangle, class Rhs, bool Lower >
+[[nodiscard]] bool triangular_solve_assignment( Tensor& t, const LINALG_EXPRESSIONS::triangular_solve_expression< Triangle, Rhs, Lower >& expr )
+{
+  if ( LINALG_DETAIL::overlaps( expr, t ) )
+  {
+    return false;
+  }
+  if ( t.extents() != expr.extents() )
+  {
+    // Resize through a copy of the solution
+    t = expr.evaluate();
+    return true;
+  }
+  LINALG_DETAIL::copy_view( t, expr.second() );
+  LINALG_DETAIL::triangular_solve_in_place< Lower >( expr.first(), t );
+  return true;
+}
+
+// Solves in place when the tensor is the right hand side, or otherwise evaluates into a temporary
+template < class Tensor, class Triangle, class Rhs, bool Lower >
+[[nodiscard]] bool triangular_solve_in_place_assignment( Tensor& t, const LINALG_EXPRESSIONS::triangular_solve_expression< Triangle, Rhs, Lower >& expr )
+{
+  if ( LINALG_DETAIL::is_same_view( expr.second(), t ) && !LINALG_DETAIL::overlaps( expr.first(), t ) )
+  {
+    LINALG_DETAIL::triangular_solve_in_place< Lower >( expr.first(), t );
+    return true;
+  }
+  t = expr.evaluate();
+  return true;
+}
+
+LINALG_EXPRESSIONS_DETAIL_END // expressions detail namespace
+
+LINALG_BEGIN // linalg namespace
+
+//-------------------------------
+//  Triangular Solve Assignment
+//-------------------------------
+
+template < class Tensor, class Triangle, class Rhs, bool Lower >
+struct rewritten_assignment< Tensor, LINALG_EXPRESSIONS::triangular_solve_expression< Triangle, Rhs, Lower > >
+{
+  [[nodiscard]] static constexpr bool apply( Tensor& t, const LINALG_EXPRESSIONS::triangular_solve_expression< Triangle, Rhs, Lower >& expr )
+  {
+    if ( LINALG_IS_CONSTANT_EVALUATED() )
+    {
+      return false;
+    }
+    return LINALG_EXPRESSIONS_DETAIL::triangular_solve_assignment( t, expr );
+  }
+};
+
+template < class Tensor, class Triangle, class Rhs, bool Lower >
+struct in_place_assignment< Tensor, LINALG_EXPRESSIONS::triangular_solve_expression< Triangle, Rhs, Lower > >
+{
+  [[nodiscard]] static bool apply( Tensor& t, const LINALG_EXPRESSIONS::triangular_solve_expression< Triangle, Rhs, Lower >& expr )
+  {
+    return LINALG_EXPRESSIONS_DETAIL::triangular_solve_in_place_assignment( t, expr );
+  }
+};
+
+//---------------------
+//  Triangular Solves
+//---------------------
+
+/// @brief Returns an expression for inverse( t ) * b reading only the lower triangle of t
+/// @param t square matrix, or a transpose or conjugate transpose expression of one
+/// @param b vector or matrix of right hand sides
+/// @throw length_error if t is not square or b has the wrong number of rows
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M, class B >
+  requires ( LINALG_CONCEPTS::matrix_expression< M > && LINALG_CONCEPTS::tensor_expression< B > && ( ( B::rank() == 1 ) || ( B::rank() == 2 ) ) )
+#else
+template < class M, class B,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< M > && LINALG_CONCEPTS::tensor_expression_v< B > && ( ( B::rank() == 1 ) || ( B::rank() == 2 ) ) > >
+#endif
+[[nodiscard]] inline constexpr auto solve_lower( const M& t, const B& b )
+{
+  return LINALG_EXPRESSIONS::triangular_solve_expression< const M&, const B&, true >( t, b );
+}
+
+/// @brief Returns an expression for inverse( t ) * b reading only the upper triangle of t
+/// @param t square matrix, or a transpose or conjugate transpose expression of one
+/// @param b vector or matrix of right hand sides
+/// @throw length_error if t is not square or b has the wrong number of rows
+#ifdef LINALG_ENABLE_CONCEPTS
+template < class M, class B >
+  requires ( LINALG_CONCEPTS::matrix_expression< M > && LINALG_CONCEPTS::tensor_expression< B > && ( ( B::rank() == 1 ) || ( B::rank() == 2 ) ) )
+#else
+template < class M, class B,
+           typename = ::std::enable_if_t< LINALG_CONCEPTS::matrix_expression_v< M > && LINALG_CONCEPTS::tensor_expression_v< B > && ( ( B::rank() == 1 ) || ( B::rank() == 2 ) ) > >
+#endif
+[[nodiscard]] inline constexpr auto solve_upper( const M& t, const B& b )
+{
+  return LINALG_EXPRESSIONS::triangular_solve_expression< const M&, const B&, false >( t, b );
+}
+
+LINALG_END // end linalg namespace
+
+#endif  //- LINEAR_ALGEBRA_TRIANGULAR_SOLVE_HPP
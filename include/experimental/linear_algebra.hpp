@@ -11,11 +11,17 @@
 //- STL includes
 #include <algorithm>
 #include <array>
+#if __has_include( <bit> )
+#include <bit>
+#endif
 #if __has_include( <concepts> )
 #include <concepts>
 #endif
+#include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #if __has_include( <execution> )
 #include <execution>
 #endif
@@ -23,8 +29,12 @@
 #include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <new>
+#include <numeric>
+#include <optional>
+#include <random>
 #if __has_include( <ranges> )
 #include <ranges>
 #endif
@@ -32,9 +42,17 @@
 #include <span>
 #endif
 #include <stdexcept>
+#if __has_include( <stdfloat> )
+#include <stdfloat>
+#endif
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <valarray>
+#include <vector>
+#if defined( __F16C__ ) || defined( __AVX512BF16__ )
+#include <immintrin.h>
+#endif
 
 //- mdspan include
 #include <experimental/mdspan>
@@ -47,6 +65,7 @@
 #include "linalg/tensor_concepts.hpp"
 #include "linalg/forward_declarations.hpp"
 #include "linalg/tensor_expression/tensor_expression_traits.hpp"
+#include "linalg/tensor_expression/simplification.hpp"
 #include "linalg/subtensor.hpp"
 #include "linalg/tensor_memory.hpp"
 #include "linalg/dr_tensor.hpp"
@@ -63,11 +82,35 @@
 #include "linalg/tensor_expression/binary/scalar_postprod.hpp"
 #include "linalg/tensor_expression/binary/scalar_division.hpp"
 #include "linalg/tensor_expression/binary/scalar_modulo.hpp"
+#include "linalg/tensor_expression/product_operand.hpp"
 #include "linalg/tensor_expression/binary/matrix_product.hpp"
 #include "linalg/tensor_expression/binary/vector_matrix_product.hpp"
 #include "linalg/tensor_expression/binary/matrix_vector_product.hpp"
 #include "linalg/tensor_expression/binary/vector_product.hpp"
 #include "linalg/tensor_expression/binary_tensor_expressions.hpp"
+#include "linalg/tensor_expression/symmetric_product.hpp"
+#include "linalg/tensor_expression/parallel_product.hpp"
+#include "linalg/tensor_expression/transposed_product.hpp"
+#include "linalg/tensor_expression/epilogue.hpp"
+#include "linalg/tensor_expression/rewriting.hpp"
 #include "linalg/arithmetic_operators.hpp"
+#include "linalg/noalias.hpp"
+#include "linalg/simultaneous.hpp"
+#include "linalg/fast_product.hpp"
+#include "linalg/dense_kernels.hpp"
+#include "linalg/lu.hpp"
+#include "linalg/cholesky.hpp"
+#include "linalg/qr.hpp"
+#include "linalg/triangular_solve.hpp"
+#include "linalg/inverse.hpp"
+#include "linalg/symmetric_eigen.hpp"
+#include "linalg/svd.hpp"
+#include "linalg/linear_operator.hpp"
+#include "linalg/randomized_svd.hpp"
+#include "linalg/iterative_eigen.hpp"
+#include "linalg/krylov.hpp"
+#include "linalg/batched.hpp"
+#include "linalg/low_precision.hpp"
+#include "linalg/quantized.hpp"
 
 #endif  //- LINEAR_ALGEBRA_HPP
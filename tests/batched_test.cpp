@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+
+namespace
+{
+
+  TEST( BATCHED, PACK_UNPACK )
+  {
+    using matrix_type = LINALG::fs_matrix< double, 2, 2 >;
+    using batch_type  = LINALG::dr_matrix_batch< double, 2, 2 >;
+    // Construct
+    ::std::array< matrix_type, 3 > matrices;
+    for ( ::std::size_t n = 0; n < 3; ++n )
+    {
+      LINALG_DETAIL::access( matrices[n], 0, 0 ) = 1.0 + n;
+      LINALG_DETAIL::access( matrices[n], 0, 1 ) = 2.0 + n;
+      LINALG_DETAIL::access( matrices[n], 1, 0 ) = 3.0 + n;
+      LINALG_DETAIL::access( matrices[n], 1, 1 ) = 4.0 + n;
+    }
+    batch_type batch { ::std::extents< ::std::size_t, ::std::dynamic_extent, 2, 2 >( 3 ) };
+    // Pack
+    LINALG::batch_pack( matrices.begin(), matrices.end(), batch );
+    // Check the batch index is the unit stride index
+    EXPECT_EQ( ( batch.stride(0) ), 1 );
+    EXPECT_EQ( ( &LINALG_DETAIL::access( batch, 1, 0, 0 ) - &LINALG_DETAIL::access( batch, 0, 0, 0 ) ), 1 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( batch, 2, 1, 0 ) ), 5.0 );
+    // Unpack
+    ::std::array< matrix_type, 3 > copies;
+    LINALG::batch_unpack( batch, copies.begin() );
+    for ( ::std::size_t n = 0; n < 3; ++n )
+    {
+      EXPECT_EQ( ( LINALG_DETAIL::access( copies[n], 0, 0 ) ), 1.0 + n );
+      EXPECT_EQ( ( LINALG_DETAIL::access( copies[n], 0, 1 ) ), 2.0 + n );
+      EXPECT_EQ( ( LINALG_DETAIL::access( copies[n], 1, 0 ) ), 3.0 + n );
+      EXPECT_EQ( ( LINALG_DETAIL::access( copies[n], 1, 1 ) ), 4.0 + n );
+    }
+  }
+
+  TEST( BATCHED, TRANSPOSE )
+  {
+    using batch_type = LINALG::dr_matrix_batch< double, 2, 3 >;
+    // Construct
+    batch_type a { ::std::extents< ::std::size_t, ::std::dynamic_extent, 2, 3 >( 2 ) };
+    LINALG::dr_matrix_batch< double, 3, 2 > at { ::std::extents< ::std::size_t, ::std::dynamic_extent, 3, 2 >( 2 ) };
+    for ( ::std::size_t n = 0; n < 2; ++n )
+    {
+      for ( ::std::size_t i = 0; i < 2; ++i )
+      {
+        for ( ::std::size_t j = 0; j < 3; ++j )
+        {
+          LINALG_DETAIL::access( a, n, i, j ) = 10.0 * n + 3.0 * i + j;
+        }
+      }
+    }
+    // Transpose
+    LINALG::batch_transpose( a, at );
+    for ( ::std::size_t n = 0; n < 2; ++n )
+    {
+      for ( ::std::size_t i = 0; i < 2; ++i )
+      {
+        for ( ::std::size_t j = 0; j < 3; ++j )
+        {
+          EXPECT_EQ( ( LINALG_DETAIL::access( at, n, j, i ) ), ( LINALG_DETAIL::access( a, n, i, j ) ) );
+        }
+      }
+    }
+  }
+
+  TEST( BATCHED, MATRIX_PRODUCT )
+  {
+    using batch_type = LINALG::dr_matrix_batch< double, 2, 2 >;
+    const auto extents = ::std::extents< ::std::size_t, ::std::dynamic_extent, 2, 2 >( 2 );
+    // Construct
+    batch_type a { extents };
+    batch_type b { extents };
+    batch_type c { extents };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( a, 0, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( a, 0, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( a, 0, 1, 0 ) = 3.0;
+    LINALG_DETAIL::access( a, 0, 1, 1 ) = 4.0;
+    LINALG_DETAIL::access( a, 1, 0, 0 ) = 2.0;
+    LINALG_DETAIL::access( a, 1, 0, 1 ) = 0.0;
+    LINALG_DETAIL::access( a, 1, 1, 0 ) = 0.0;
+    LINALG_DETAIL::access( a, 1, 1, 1 ) = 2.0;
+    LINALG_DETAIL::access( b, 0, 0, 0 ) = 5.0;
+    LINALG_DETAIL::access( b, 0, 0, 1 ) = 6.0;
+    LINALG_DETAIL::access( b, 0, 1, 0 ) = 7.0;
+    LINALG_DETAIL::access( b, 0, 1, 1 ) = 8.0;
+    LINALG_DETAIL::access( b, 1, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( b, 1, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( b, 1, 1, 0 ) = 3.0;
+    LINALG_DETAIL::access( b, 1, 1, 1 ) = 4.0;
+    // Multiply
+    LINALG::batch_matrix_product( a, b, c );
+    // Check the products
+    EXPECT_EQ( ( LINALG_DETAIL::access( c, 0, 0, 0 ) ), 19.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( c, 0, 0, 1 ) ), 22.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( c, 0, 1, 0 ) ), 43.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( c, 0, 1, 1 ) ), 50.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( c, 1, 0, 0 ) ), 2.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( c, 1, 0, 1 ) ), 4.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( c, 1, 1, 0 ) ), 6.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( c, 1, 1, 1 ) ), 8.0 );
+    // Check mismatched batch sizes throw
+    batch_type d { ::std::extents< ::std::size_t, ::std::dynamic_extent, 2, 2 >( 3 ) };
+    EXPECT_THROW( ( LINALG::batch_matrix_product( a, b, d ) ), ::std::length_error );
+  }
+
+  TEST( BATCHED, MATRIX_VECTOR_PRODUCT )
+  {
+    // Construct
+    LINALG::dr_matrix_batch< double, 2, 2 > a { ::std::extents< ::std::size_t, ::std::dynamic_extent, 2, 2 >( 2 ) };
+    LINALG::dr_vector_batch< double, 2 >    x { ::std::extents< ::std::size_t, ::std::dynamic_extent, 2 >( 2 ) };
+    LINALG::dr_vector_batch< double, 2 >    y { ::std::extents< ::std::size_t, ::std::dynamic_extent, 2 >( 2 ) };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( a, 0, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( a, 0, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( a, 0, 1, 0 ) = 3.0;
+    LINALG_DETAIL::access( a, 0, 1, 1 ) = 4.0;
+    LINALG_DETAIL::access( a, 1, 0, 0 ) = 0.0;
+    LINALG_DETAIL::access( a, 1, 0, 1 ) = 1.0;
+    LINALG_DETAIL::access( a, 1, 1, 0 ) = 1.0;
+    LINALG_DETAIL::access( a, 1, 1, 1 ) = 0.0;
+    LINALG_DETAIL::access( x, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( x, 0, 1 ) = 1.0;
+    LINALG_DETAIL::access( x, 1, 0 ) = 5.0;
+    LINALG_DETAIL::access( x, 1, 1 ) = 7.0;
+    // Multiply
+    LINALG::batch_matrix_vector_product( a, x, y );
+    // Check the products
+    EXPECT_EQ( ( LINALG_DETAIL::access( y, 0, 0 ) ), 3.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( y, 0, 1 ) ), 7.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( y, 1, 0 ) ), 7.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( y, 1, 1 ) ), 5.0 );
+  }
+
+  TEST( BATCHED, INVERSE )
+  {
+    using batch_type = LINALG::dr_matrix_batch< double, 3, 3 >;
+    const auto extents = ::std::extents< ::std::size_t, ::std::dynamic_extent, 3, 3 >( 2 );
+    // Construct
+    batch_type a { extents };
+    batch_type inv { extents };
+    batch_type identity { extents };
+    // First item requires a row interchange, second is diagonal
+    const double values[2][3][3] = { { { 0.0, 2.0, 1.0 }, { 1.0, 1.0, 0.0 }, { 3.0, 0.0, 1.0 } },
+                                     { { 2.0, 0.0, 0.0 }, { 0.0, 4.0, 0.0 }, { 0.0, 0.0, 8.0 } } };
+    for ( ::std::size_t n = 0; n < 2; ++n )
+    {
+      for ( ::std::size_t i = 0; i < 3; ++i )
+      {
+        for ( ::std::size_t j = 0; j < 3; ++j )
+        {
+          LINALG_DETAIL::access( a, n, i, j ) = values[n][i][j];
+        }
+      }
+    }
+    // Invert
+    LINALG::batch_inverse( a, inv );
+    // Check a * inv(a) is the identity
+    LINALG::batch_matrix_product( a, inv, identity );
+    for ( ::std::size_t n = 0; n < 2; ++n )
+    {
+      for ( ::std::size_t i = 0; i < 3; ++i )
+      {
+        for ( ::std::size_t j = 0; j < 3; ++j )
+        {
+          EXPECT_NEAR( ( LINALG_DETAIL::access( identity, n, i, j ) ), ( i == j ? 1.0 : 0.0 ), 1.0e-12 );
+        }
+      }
+    }
+    EXPECT_EQ( ( LINALG_DETAIL::access( inv, 1, 2, 2 ) ), 0.125 );
+    // Check singular matrices throw
+    LINALG_DETAIL::access( a, 1, 2, 2 ) = 0.0;
+    EXPECT_THROW( ( LINALG::batch_inverse( a, inv ) ), ::std::domain_error );
+  }
+
+  TEST( BATCHED, CHOLESKY )
+  {
+    using batch_type = LINALG::dr_matrix_batch< double, 3, 3 >;
+    const auto extents = ::std::extents< ::std::size_t, ::std::dynamic_extent, 3, 3 >( 2 );
+    // Construct
+    batch_type a { extents };
+    batch_type l { extents };
+    const double values[2][3][3] = { { { 4.0, 2.0, 2.0 }, { 2.0, 5.0, 3.0 }, { 2.0, 3.0, 6.0 } },
+                                     { { 4.0, 0.0, 0.0 }, { 0.0, 9.0, 0.0 }, { 0.0, 0.0, 16.0 } } };
+    const double factors[2][3][3] = { { { 2.0, 0.0, 0.0 }, { 1.0, 2.0, 0.0 }, { 1.0, 1.0, 2.0 } },
+                                      { { 2.0, 0.0, 0.0 }, { 0.0, 3.0, 0.0 }, { 0.0, 0.0, 4.0 } } };
+    for ( ::std::size_t n = 0; n < 2; ++n )
+    {
+      for ( ::std::size_t i = 0; i < 3; ++i )
+      {
+        for ( ::std::size_t j = 0; j < 3; ++j )
+        {
+          LINALG_DETAIL::access( a, n, i, j ) = values[n][i][j];
+        }
+      }
+    }
+    // Factor
+    LINALG::batch_cholesky( a, l );
+    for ( ::std::size_t n = 0; n < 2; ++n )
+    {
+      for ( ::std::size_t i = 0; i < 3; ++i )
+      {
+        for ( ::std::size_t j = 0; j < 3; ++j )
+        {
+          EXPECT_EQ( ( LINALG_DETAIL::access( l, n, i, j ) ), factors[n][i][j] );
+        }
+      }
+    }
+    // Check indefinite matrices throw
+    LINALG_DETAIL::access( a, 0, 2, 2 ) = -1.0;
+    EXPECT_THROW( ( LINALG::batch_cholesky( a, l ) ), ::std::domain_error );
+  }
+
+}
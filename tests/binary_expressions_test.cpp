@@ -1504,6 +1504,36 @@ namespace
     EXPECT_EQ( val8, 8.0 / 3.0 );
   }
 
+  TEST( SIMPLIFICATION, SCALAR_FOLDING )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Construct
+    matrix_type matrix { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type result { ::std::extents< ::std::size_t, 2, 2 >() };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( matrix, 1, 0 ) = 3.0;
+    LINALG_DETAIL::access( matrix, 1, 1 ) = 4.0;
+    // Check chained scalar factors fold into a single factor of the operand
+    EXPECT_EQ( ( ( 2.0 * ( 3.0 * matrix ) ).first() ), 6.0 );
+    EXPECT_EQ( ( ::std::addressof( ( 2.0 * ( 3.0 * matrix ) ).second() ) ), ( ::std::addressof( matrix ) ) );
+    EXPECT_EQ( ( ( 2.0 * ( matrix * 3.0 ) ).first() ), 6.0 );
+    EXPECT_EQ( ( ( ( 2.0 * matrix ) * 3.0 ).first() ), 6.0 );
+    EXPECT_EQ( ( ( ( matrix * 2.0 ) * 3.0 ).second() ), 6.0 );
+    EXPECT_EQ( ( ::std::addressof( ( ( matrix * 2.0 ) * 3.0 ).first() ) ), ( ::std::addressof( matrix ) ) );
+    // Check folded expressions evaluate properly
+    result = 2.0 * ( 3.0 * matrix );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 6.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 24.0 );
+    // Check division is only rewritten when reciprocal division is allowed
+    EXPECT_EQ( ( LINALG_EXPRESSIONS_DETAIL::is_scalar_division_expression_v< decltype( matrix / 2.0 ) > ),
+               ( ! LINALG::allow_reciprocal_division_v< double > ) );
+    result = matrix / 2.0;
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 0.5 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 2.0 );
+  }
+
   TEST( SCALAR_MODULO, DR_TENSOR_INT )
   {
     using tensor_type = LINALG::dyn_tensor< int, 3 >;
@@ -1859,6 +1889,24 @@ namespace
     EXPECT_EQ( ( ::std::addressof( prod_matrix.second() ) ), ( ::std::addressof( matrix_b ) ) );
   }
 
+  TEST( MATRIX_PRODUCT, CONSTEXPR_FS_MATRIX_FS_MATRIX )
+  {
+    // Evaluate a product of small static matrices in a constant expression
+    constexpr double trace = []() constexpr
+    {
+      LINALG::fs_matrix< double, 2, 2 > matrix_a;
+      LINALG_DETAIL::access( matrix_a, 0, 0 ) = 1.0;
+      LINALG_DETAIL::access( matrix_a, 0, 1 ) = 2.0;
+      LINALG_DETAIL::access( matrix_a, 1, 0 ) = 3.0;
+      LINALG_DETAIL::access( matrix_a, 1, 1 ) = 4.0;
+      LINALG::fs_matrix< double, 2, 2 > matrix_b { trans( matrix_a ) };
+      LINALG::fs_matrix< double, 2, 2 > prod_matrix { matrix_a * matrix_b };
+      return LINALG_DETAIL::access( prod_matrix, 0, 0 ) + LINALG_DETAIL::access( prod_matrix, 1, 1 );
+    }();
+    // Check the product was evaluated properly
+    EXPECT_EQ( trace, 30.0 );
+  }
+
   TEST( MATRIX_PRODUCT, DR_MATRIX_FS_MATRIX )
   {
     // Construct
@@ -2084,6 +2132,552 @@ namespace
     EXPECT_EQ( ( matrix_a.extents().extent(1) ), 2 );
   }
 
+  TEST( MATRIX_PRODUCT_ASSIGNMENT, DISJOINT_DR_MATRIX )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type matrix_b { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type matrix_c { ::std::extents< ::std::size_t, 2, 2 >() };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_a, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix_a, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( matrix_a, 1, 0 ) = 3.0;
+    LINALG_DETAIL::access( matrix_a, 1, 1 ) = 4.0;
+    LINALG_DETAIL::access( matrix_b, 0, 0 ) = 5.0;
+    LINALG_DETAIL::access( matrix_b, 0, 1 ) = 6.0;
+    LINALG_DETAIL::access( matrix_b, 1, 0 ) = 7.0;
+    LINALG_DETAIL::access( matrix_b, 1, 1 ) = 8.0;
+    // Check overlap detection walks the operands
+    EXPECT_TRUE( ( LINALG_DETAIL::overlaps( matrix_a * matrix_b, matrix_a ) ) );
+    EXPECT_TRUE( ( LINALG_DETAIL::overlaps( matrix_a * trans( matrix_b ), matrix_b ) ) );
+    EXPECT_FALSE( ( LINALG_DETAIL::overlaps( matrix_a * matrix_b, matrix_c ) ) );
+    EXPECT_FALSE( ( LINALG_DETAIL::overlaps( 2.0 * ( matrix_a * matrix_b ), matrix_c ) ) );
+    // Disjoint destinations are written in place
+    const auto* buffer = matrix_c.data_handle();
+    matrix_c = matrix_a * matrix_b;
+    EXPECT_EQ( ( matrix_c.data_handle() ), buffer );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 0 ) ), 19.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 1 ) ), 50.0 );
+    // Explicitly unaliased assignment
+    LINALG::noalias( matrix_c ) = matrix_b * matrix_a;
+    EXPECT_EQ( ( matrix_c.data_handle() ), buffer );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 0 ) ), 23.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 1 ) ), 34.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 0 ) ), 31.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 1 ) ), 46.0 );
+    LINALG::noalias( matrix_c ) += matrix_a * matrix_b;
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 0 ) ), 42.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 1 ) ), 96.0 );
+    // Aliased destinations still produce the correct result
+    matrix_a = matrix_a * matrix_b;
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 0, 0 ) ), 19.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 0, 1 ) ), 22.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 1, 0 ) ), 43.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 1, 1 ) ), 50.0 );
+  }
+
+  TEST( MATRIX_PRODUCT_ASSIGNMENT, IN_PLACE_DR_MATRIX )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type matrix_b { ::std::extents< ::std::size_t, 2, 2 >() };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_a, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix_a, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( matrix_a, 1, 0 ) = 3.0;
+    LINALG_DETAIL::access( matrix_a, 1, 1 ) = 4.0;
+    LINALG_DETAIL::access( matrix_b, 0, 0 ) = 5.0;
+    LINALG_DETAIL::access( matrix_b, 0, 1 ) = 6.0;
+    LINALG_DETAIL::access( matrix_b, 1, 0 ) = 7.0;
+    LINALG_DETAIL::access( matrix_b, 1, 1 ) = 8.0;
+    // Right multiplication reuses the destination buffer
+    const auto* buffer = matrix_a.data_handle();
+    matrix_a *= matrix_b;
+    EXPECT_EQ( ( matrix_a.data_handle() ), buffer );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 0, 0 ) ), 19.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 0, 1 ) ), 22.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 1, 0 ) ), 43.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 1, 1 ) ), 50.0 );
+    // Left multiplication reuses the destination buffer
+    LINALG_DETAIL::access( matrix_a, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix_a, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( matrix_a, 1, 0 ) = 3.0;
+    LINALG_DETAIL::access( matrix_a, 1, 1 ) = 4.0;
+    matrix_a = matrix_b * matrix_a;
+    EXPECT_EQ( ( matrix_a.data_handle() ), buffer );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 0, 0 ) ), 23.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 0, 1 ) ), 34.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 1, 0 ) ), 31.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_a, 1, 1 ) ), 46.0 );
+    // Self products fall back to a temporary
+    matrix_b = matrix_b * matrix_b;
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_b, 0, 0 ) ), 67.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_b, 0, 1 ) ), 78.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_b, 1, 0 ) ), 91.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_b, 1, 1 ) ), 106.0 );
+  }
+
+  TEST( MATRIX_PRODUCT, FUSED_OPERAND_FLAGS )
+  {
+    using vector_type  = LINALG::dyn_vector< double >;
+    using matrix_type  = LINALG::dyn_matrix< double >;
+    using complex_type = ::std::complex< double >;
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 2, 3 >() };
+    matrix_type matrix_c { ::std::extents< ::std::size_t, 3, 3 >() };
+    vector_type vector_x { ::std::extents< ::std::size_t, 3 >() };
+    vector_type vector_y { ::std::extents< ::std::size_t, 2 >() };
+    vector_type vector_r { ::std::extents< ::std::size_t, 3 >() };
+    vector_type vector_s { ::std::extents< ::std::size_t, 2 >() };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_a, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix_a, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( matrix_a, 0, 2 ) = 3.0;
+    LINALG_DETAIL::access( matrix_a, 1, 0 ) = 4.0;
+    LINALG_DETAIL::access( matrix_a, 1, 1 ) = 5.0;
+    LINALG_DETAIL::access( matrix_a, 1, 2 ) = 6.0;
+    LINALG_DETAIL::access( vector_x, 0 ) = 1.0;
+    LINALG_DETAIL::access( vector_x, 1 ) = 2.0;
+    LINALG_DETAIL::access( vector_x, 2 ) = 3.0;
+    LINALG_DETAIL::access( vector_y, 0 ) = 1.0;
+    LINALG_DETAIL::access( vector_y, 1 ) = 2.0;
+    // Check wrappers are decomposed into op flags and scaling
+    using transposed_type = LINALG_EXPRESSIONS_DETAIL::product_operand_t< decltype( trans( matrix_a ) ) >;
+    using scaled_type     = LINALG_EXPRESSIONS_DETAIL::product_operand_t< decltype( 2.0 * trans( matrix_a ) ) >;
+    using negated_type    = LINALG_EXPRESSIONS_DETAIL::product_operand_t< decltype( -matrix_a ) >;
+    EXPECT_TRUE( ( transposed_type::transposed ) );
+    EXPECT_FALSE( ( transposed_type::scaled ) );
+    EXPECT_TRUE( ( ::std::is_same_v< typename transposed_type::leaf_type, matrix_type > ) );
+    EXPECT_TRUE( ( scaled_type::transposed ) );
+    EXPECT_TRUE( ( scaled_type::scaled ) );
+    EXPECT_FALSE( ( negated_type::transposed ) );
+    EXPECT_TRUE( ( negated_type::scaled ) );
+    // Transposed first operand
+    matrix_c = trans( matrix_a ) * matrix_a;
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 0 ) ), 17.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 1 ) ), 22.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 2 ) ), 36.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 2, 2 ) ), 45.0 );
+    // Scaled and transposed matrix vector product
+    vector_r = ( 2.0 * trans( matrix_a ) ) * vector_y;
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_r, 0 ) ), 18.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_r, 1 ) ), 24.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_r, 2 ) ), 30.0 );
+    // Negated matrix vector product
+    vector_s = -matrix_a * vector_x;
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_s, 0 ) ), -14.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_s, 1 ) ), -32.0 );
+    // Transposed vector matrix product
+    vector_s = vector_x * trans( matrix_a );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_s, 0 ) ), 14.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_s, 1 ) ), 32.0 );
+    // Conjugate transposed matrix vector product
+    LINALG::dyn_matrix< complex_type > matrix_z { ::std::extents< ::std::size_t, 2, 2 >() };
+    LINALG::dyn_vector< complex_type > vector_w { ::std::extents< ::std::size_t, 2 >() };
+    LINALG::dyn_vector< complex_type > vector_v { ::std::extents< ::std::size_t, 2 >() };
+    LINALG_DETAIL::access( matrix_z, 0, 0 ) = complex_type( 1.0, 1.0 );
+    LINALG_DETAIL::access( matrix_z, 0, 1 ) = complex_type( 2.0, 0.0 );
+    LINALG_DETAIL::access( matrix_z, 1, 0 ) = complex_type( 0.0, 0.0 );
+    LINALG_DETAIL::access( matrix_z, 1, 1 ) = complex_type( 1.0, -1.0 );
+    LINALG_DETAIL::access( vector_w, 0 ) = complex_type( 1.0, 0.0 );
+    LINALG_DETAIL::access( vector_w, 1 ) = complex_type( 0.0, 1.0 );
+    EXPECT_TRUE( ( LINALG_EXPRESSIONS_DETAIL::product_operand_t< decltype( conj( matrix_z ) ) >::conjugated ) );
+    vector_v = conj( matrix_z ) * vector_w;
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_v, 0 ) ), complex_type( 1.0, -1.0 ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_v, 1 ) ), complex_type( 1.0, 1.0 ) );
+  }
+
+  TEST( MATRIX_PRODUCT, TRANSPOSED_LEAF_ROW_ORDER )
+  {
+    using vector_type = LINALG::dyn_vector< double >;
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 2, 3 >() };
+    matrix_type matrix_b { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type matrix_c { ::std::extents< ::std::size_t, 3, 2 >() };
+    vector_type vector_y { ::std::extents< ::std::size_t, 2 >() };
+    vector_type vector_r { ::std::extents< ::std::size_t, 3 >() };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_a, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix_a, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( matrix_a, 0, 2 ) = 3.0;
+    LINALG_DETAIL::access( matrix_a, 1, 0 ) = 4.0;
+    LINALG_DETAIL::access( matrix_a, 1, 1 ) = 5.0;
+    LINALG_DETAIL::access( matrix_a, 1, 2 ) = 6.0;
+    LINALG_DETAIL::access( matrix_b, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix_b, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( matrix_b, 1, 0 ) = 3.0;
+    LINALG_DETAIL::access( matrix_b, 1, 1 ) = 4.0;
+    LINALG_DETAIL::access( vector_y, 0 ) = 1.0;
+    LINALG_DETAIL::access( vector_y, 1 ) = 2.0;
+    // Transposed first operand is evaluated as rank one updates over the rows of its leaf
+    EXPECT_TRUE( ( LINALG_EXPRESSIONS_DETAIL::transposed_product( matrix_c, trans( matrix_a ) * matrix_b ) ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 0 ) ), 13.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 1 ) ), 18.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 0 ) ), 17.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 1 ) ), 24.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 2, 0 ) ), 21.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 2, 1 ) ), 30.0 );
+    // Both operands transposed, one column of the result at a time
+    EXPECT_TRUE( ( LINALG_EXPRESSIONS_DETAIL::transposed_product( matrix_c, trans( matrix_a ) * trans( matrix_b ) ) ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 0 ) ), 9.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 1 ) ), 19.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 0 ) ), 12.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 1 ) ), 26.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 2, 0 ) ), 15.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 2, 1 ) ), 33.0 );
+    // Scaled and transposed matrix vector product
+    EXPECT_TRUE( ( LINALG_EXPRESSIONS_DETAIL::transposed_product( vector_r, ( 2.0 * trans( matrix_a ) ) * vector_y ) ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_r, 0 ) ), 18.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_r, 1 ) ), 24.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_r, 2 ) ), 30.0 );
+    // Untransposed first operands are already read along their rows
+    EXPECT_FALSE( ( LINALG_EXPRESSIONS_DETAIL::transposed_product( matrix_b, matrix_b * matrix_b ) ) );
+    // Assignment dispatches to the same evaluation
+    matrix_c = trans( matrix_a ) * matrix_b;
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 2, 1 ) ), 30.0 );
+  }
+
+  TEST( EXPRESSION_REWRITING, FACTOR_AND_REGROUP )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    using vector_type = LINALG::dyn_vector< double >;
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type matrix_x { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type matrix_y { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type result { ::std::extents< ::std::size_t, 2, 2 >() };
+    vector_type vector_v { ::std::extents< ::std::size_t, 2 >() };
+    vector_type vector_w { ::std::extents< ::std::size_t, 2 >() };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_a, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix_a, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( matrix_a, 1, 0 ) = 3.0;
+    LINALG_DETAIL::access( matrix_a, 1, 1 ) = 4.0;
+    LINALG_DETAIL::access( matrix_x, 0, 0 ) = 5.0;
+    LINALG_DETAIL::access( matrix_x, 0, 1 ) = 6.0;
+    LINALG_DETAIL::access( matrix_x, 1, 0 ) = 7.0;
+    LINALG_DETAIL::access( matrix_x, 1, 1 ) = 8.0;
+    LINALG_DETAIL::access( matrix_y, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix_y, 0, 1 ) = 0.0;
+    LINALG_DETAIL::access( matrix_y, 1, 0 ) = 0.0;
+    LINALG_DETAIL::access( matrix_y, 1, 1 ) = 1.0;
+    LINALG_DETAIL::access( vector_v, 0 ) = 1.0;
+    LINALG_DETAIL::access( vector_v, 1 ) = 1.0;
+    // Algebraic traits of the expression nodes
+    EXPECT_TRUE( ( LINALG::is_commutative_v< decltype( matrix_x + matrix_y ) > ) );
+    EXPECT_FALSE( ( LINALG::is_commutative_v< decltype( matrix_x - matrix_y ) > ) );
+    EXPECT_TRUE( ( LINALG::is_left_distributive_v< decltype( matrix_a * matrix_x ), decltype( matrix_x + matrix_y ) > ) );
+    EXPECT_TRUE( ( LINALG::is_associative_v< decltype( ( matrix_a * matrix_x ) * vector_v ), decltype( matrix_a * matrix_x ) > ) );
+    // a * x + a * y is evaluated as a * ( x + y )
+    result = matrix_a * matrix_x + matrix_a * matrix_y;
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 20.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 24.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 46.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 54.0 );
+    // x * a - y * a is evaluated as ( x - y ) * a
+    result = matrix_x * matrix_a - matrix_y * matrix_a;
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 22.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 32.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 28.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 42.0 );
+    // ( a * x ) * v is evaluated as a * ( x * v )
+    vector_w = ( matrix_a * matrix_x ) * vector_v;
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_w, 0 ) ), 41.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_w, 1 ) ), 93.0 );
+    // The operand of a product chain may be the destination
+    result = matrix_a;
+    result = result * ( matrix_x * matrix_a );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 85.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 126.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 193.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 286.0 );
+    // Check the rewrites are taken for the trees above
+    EXPECT_TRUE( ( LINALG_EXPRESSIONS_DETAIL::factor_common_operand( result, matrix_a * matrix_x + matrix_a * matrix_y ) ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 20.0 );
+    EXPECT_TRUE( ( LINALG_EXPRESSIONS_DETAIL::factor_common_operand( result, matrix_x * matrix_a - matrix_y * matrix_a ) ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 22.0 );
+    EXPECT_TRUE( ( LINALG_EXPRESSIONS_DETAIL::regroup_product_chain( vector_w, ( matrix_a * matrix_x ) * vector_v ) ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_w, 0 ) ), 41.0 );
+    // An equal copy of the shared operand is not the same view, so nothing is factored
+    matrix_type matrix_b { matrix_a };
+    EXPECT_FALSE( ( LINALG_EXPRESSIONS_DETAIL::factor_common_operand( result, matrix_a * matrix_x + matrix_b * matrix_y ) ) );
+    EXPECT_FALSE( ( LINALG_EXPRESSIONS_DETAIL::factor_common_operand( result, matrix_x * matrix_a - matrix_y * matrix_b ) ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 22.0 );
+    // A product whose operands are not products is not a chain
+    EXPECT_FALSE( ( LINALG_EXPRESSIONS_DETAIL::regroup_product_chain( result, matrix_a * matrix_x ) ) );
+    // Evaluated as written, the results are the same
+    result = matrix_a * matrix_x + matrix_b * matrix_y;
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 20.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 24.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 46.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 54.0 );
+  }
+
+  TEST( EXPRESSION_REWRITING, SUM_GROUPED_BY_LAYOUT )
+  {
+    using right_matrix_type = LINALG::fs_matrix< double, 2, 2, ::std::layout_right >;
+    using left_matrix_type  = LINALG::fs_matrix< double, 2, 2, ::std::layout_left >;
+    // Construct
+    right_matrix_type matrix_r;
+    left_matrix_type  matrix_l1;
+    left_matrix_type  matrix_l2;
+    left_matrix_type  matrix_l3;
+    right_matrix_type result;
+    // Populate via mutable index access
+    for ( ::std::size_t i = 0; i < 2; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 2; ++j )
+      {
+        const double value = static_cast< double >( 2 * i + j + 1 );
+        LINALG_DETAIL::access( matrix_r, i, j )  = 1000.0 * value;
+        LINALG_DETAIL::access( matrix_l1, i, j ) = value;
+        LINALG_DETAIL::access( matrix_l2, i, j ) = 10.0 * value;
+        LINALG_DETAIL::access( matrix_l3, i, j ) = 100.0 * value;
+      }
+    }
+    // The column major operands are summed in a separate pass
+    result = matrix_l1 + matrix_r + matrix_l2 + matrix_l3;
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 1111.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 2222.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 3333.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 4444.0 );
+    // Without operands in the layout of the destination
+    result = matrix_l1 + matrix_l2 + matrix_l3;
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 111.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 222.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 333.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 444.0 );
+    // Check the rewrite is taken for the trees above
+    EXPECT_TRUE( ( LINALG_EXPRESSIONS_DETAIL::group_sum_by_layout( result, matrix_l1 + matrix_r + matrix_l2 + matrix_l3 ) ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 4444.0 );
+    EXPECT_TRUE( ( LINALG_EXPRESSIONS_DETAIL::group_sum_by_layout( result, matrix_l1 + matrix_l2 + matrix_l3 ) ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 444.0 );
+    // Operands all in the layout of the destination are left to a single pass
+    EXPECT_FALSE( ( LINALG_EXPRESSIONS_DETAIL::group_sum_by_layout( result, matrix_r + matrix_r ) ) );
+    // A destination which is one of the operands is left to in place assignment
+    EXPECT_FALSE( ( LINALG_EXPRESSIONS_DETAIL::group_sum_by_layout( matrix_r, matrix_l1 + matrix_r + matrix_l2 ) ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_r, 1, 1 ) ), 4000.0 );
+  }
+
+  TEST( SIMULTANEOUS_EVALUATION, SHARED_OPERAND )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    using vector_type = LINALG::dyn_vector< double >;
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type matrix_x { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type matrix_xx { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type matrix_y { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type matrix_yy { ::std::extents< ::std::size_t, 2, 2 >() };
+    vector_type vector_x { ::std::extents< ::std::size_t, 2 >() };
+    vector_type vector_y { ::std::extents< ::std::size_t, 2 >() };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_a, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix_a, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( matrix_a, 1, 0 ) = 3.0;
+    LINALG_DETAIL::access( matrix_a, 1, 1 ) = 4.0;
+    LINALG_DETAIL::access( matrix_x, 0, 0 ) = 5.0;
+    LINALG_DETAIL::access( matrix_x, 0, 1 ) = 6.0;
+    LINALG_DETAIL::access( matrix_x, 1, 0 ) = 7.0;
+    LINALG_DETAIL::access( matrix_x, 1, 1 ) = 8.0;
+    LINALG_DETAIL::access( matrix_xx, 0, 0 ) = 1.0;
+    LINALG_DETAIL::access( matrix_xx, 0, 1 ) = 0.0;
+    LINALG_DETAIL::access( matrix_xx, 1, 0 ) = 0.0;
+    LINALG_DETAIL::access( matrix_xx, 1, 1 ) = 2.0;
+    LINALG_DETAIL::access( vector_x, 0 ) = 1.0;
+    LINALG_DETAIL::access( vector_x, 1 ) = 1.0;
+    // Matrix and vector outputs sharing the first operand
+    LINALG::evaluate_all( LINALG::deferred( matrix_y ) = matrix_a * matrix_x,
+                          LINALG::deferred( vector_y ) = matrix_a * vector_x,
+                          LINALG::deferred( matrix_yy ) = matrix_a * matrix_xx * trans( matrix_a ) );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_y, 0, 0 ) ), 19.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_y, 0, 1 ) ), 22.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_y, 1, 0 ) ), 43.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_y, 1, 1 ) ), 50.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_y, 0 ) ), 3.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_y, 1 ) ), 7.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_yy, 0, 0 ) ), 9.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_yy, 0, 1 ) ), 19.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_yy, 1, 0 ) ), 19.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_yy, 1, 1 ) ), 41.0 );
+    // An output which is also an operand is evaluated in turn
+    LINALG::evaluate_all( LINALG::deferred( matrix_x ) = matrix_a * matrix_x,
+                          LINALG::deferred( vector_y ) = matrix_a * vector_x );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_x, 0, 0 ) ), 19.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_x, 0, 1 ) ), 22.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_x, 1, 0 ) ), 43.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_x, 1, 1 ) ), 50.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_y, 0 ) ), 3.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( vector_y, 1 ) ), 7.0 );
+  }
+
+  TEST( SYMMETRIC_PRODUCT, SYRK_AND_CONGRUENCE )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 2, 3 >() };
+    matrix_type matrix_b { ::std::extents< ::std::size_t, 2, 3 >() };
+    matrix_type matrix_s { ::std::extents< ::std::size_t, 3, 3 >() };
+    matrix_type result { ::std::extents< ::std::size_t, 2, 2 >() };
+    // Populate via mutable index access
+    for ( ::std::size_t i = 0; i < 2; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 3; ++j )
+      {
+        LINALG_DETAIL::access( matrix_a, i, j ) = static_cast< double >( 3 * i + j + 1 );
+        LINALG_DETAIL::access( matrix_b, i, j ) = ( i == j ) ? 1.0 : 0.0;
+      }
+    }
+    for ( ::std::size_t i = 0; i < 3; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 3; ++j )
+      {
+        LINALG_DETAIL::access( matrix_s, i, j ) = ( i == j ) ? ( i < 2 ? 2.0 : 1.0 ) : ( i + j == 1 ? 1.0 : 0.0 );
+      }
+    }
+    // Gram matrix
+    result = matrix_a * trans( matrix_a );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 14.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 32.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 32.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 77.0 );
+    // Congruence with a symmetric matrix
+    result = matrix_a * matrix_s * trans( matrix_a );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 23.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 59.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 59.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 158.0 );
+    // A middle matrix which is not symmetric is multiplied out in full
+    LINALG_DETAIL::access( matrix_s, 1, 0 ) = 0.0;
+    result = matrix_a * matrix_s * trans( matrix_a );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 21.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 51.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 54.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 138.0 );
+    // Symmetric rank 2k update
+    result = matrix_a * trans( matrix_b ) + matrix_b * trans( matrix_a );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 2.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 6.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 6.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 10.0 );
+  }
+
+  TEST( PARALLEL_PRODUCT, TILED_AND_SPLIT_INNER_DIMENSION )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Partitions
+    constexpr auto square = LINALG_DETAIL::partition_product( 512, 512, 512, 16 );
+    EXPECT_EQ( square.tiles(), 64 );
+    EXPECT_EQ( square.depth_slices, 1 );
+    constexpr auto skinny = LINALG_DETAIL::partition_product( 8, 8, 4096, 16 );
+    EXPECT_EQ( skinny.tiles(), 1 );
+    EXPECT_EQ( skinny.depth_slices, 16 );
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 80, 70 >() };
+    matrix_type matrix_b { ::std::extents< ::std::size_t, 70, 60 >() };
+    matrix_type result { ::std::extents< ::std::size_t, 80, 60 >() };
+    // Populate via mutable index access
+    for ( ::std::size_t i = 0; i < 80; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 70; ++j )
+      {
+        LINALG_DETAIL::access( matrix_a, i, j ) = static_cast< double >( ( i + 2 * j ) % 7 );
+      }
+    }
+    for ( ::std::size_t i = 0; i < 70; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 60; ++j )
+      {
+        LINALG_DETAIL::access( matrix_b, i, j ) = static_cast< double >( ( 3 * i + j ) % 5 );
+      }
+    }
+    // Large enough to be evaluated in parallel
+    result = matrix_a * matrix_b;
+    for ( ::std::size_t i = 0; i < 80; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 60; ++j )
+      {
+        double expected = 0.0;
+        for ( ::std::size_t k = 0; k < 70; ++k )
+        {
+          expected += LINALG_DETAIL::access( matrix_a, i, k ) * LINALG_DETAIL::access( matrix_b, k, j );
+        }
+        EXPECT_EQ( ( LINALG_DETAIL::access( result, i, j ) ), expected );
+      }
+    }
+    // Inner dimension split between tasks and reduced
+    constexpr LINALG_DETAIL::parallel_product_partition split { 80, 60, 70, 2, 1, 3, 24 };
+    LINALG_DETAIL::parallel_matrix_product< double >( result, 2.0 * matrix_a * matrix_b, split );
+    for ( ::std::size_t i = 0; i < 80; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 60; ++j )
+      {
+        double expected = 0.0;
+        for ( ::std::size_t k = 0; k < 70; ++k )
+        {
+          expected += LINALG_DETAIL::access( matrix_a, i, k ) * LINALG_DETAIL::access( matrix_b, k, j );
+        }
+        EXPECT_EQ( ( LINALG_DETAIL::access( result, i, j ) ), 2.0 * expected );
+      }
+    }
+    // Construction and evaluation dispatch as assignment does
+    const matrix_type constructed = matrix_a * matrix_b;
+    const matrix_type evaluated   = ( matrix_a * matrix_b ).evaluate();
+    for ( ::std::size_t i = 0; i < 80; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 60; ++j )
+      {
+        EXPECT_EQ( ( LINALG_DETAIL::access( constructed, i, j ) ), 0.5 * LINALG_DETAIL::access( result, i, j ) );
+        EXPECT_EQ( ( LINALG_DETAIL::access( evaluated, i, j ) ), 0.5 * LINALG_DETAIL::access( result, i, j ) );
+      }
+    }
+  }
+
+  TEST( EPILOGUE_FUSION, SCALED_PRODUCT_PLUS_DESTINATION )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 2, 3 >() };
+    matrix_type matrix_b { ::std::extents< ::std::size_t, 3, 2 >() };
+    matrix_type matrix_c { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type bias { ::std::extents< ::std::size_t, 2, 2 >() };
+    matrix_type result { ::std::extents< ::std::size_t, 2, 2 >() };
+    // Populate via mutable index access
+    for ( ::std::size_t i = 0; i < 2; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 3; ++j )
+      {
+        LINALG_DETAIL::access( matrix_a, i, j ) = static_cast< double >( 3 * i + j + 1 );
+        LINALG_DETAIL::access( matrix_b, j, i ) = static_cast< double >( 2 * j + i + 1 );
+      }
+      for ( ::std::size_t j = 0; j < 2; ++j )
+      {
+        LINALG_DETAIL::access( matrix_c, i, j ) = 1.0;
+        LINALG_DETAIL::access( bias, i, j )     = static_cast< double >( 2 * i + j );
+      }
+    }
+    // a * b is { { 22, 28 }, { 49, 64 } }
+    result = matrix_a * matrix_b + bias;
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 0 ) ), 22.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 0, 1 ) ), 29.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 0 ) ), 51.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( result, 1, 1 ) ), 67.0 );
+    // The destination is read and written in the same pass
+    matrix_c = 2.0 * ( matrix_a * matrix_b ) + 3.0 * matrix_c;
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 0 ) ), 47.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 1 ) ), 59.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 0 ) ), 101.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 1 ) ), 131.0 );
+    matrix_c = matrix_a * matrix_b - matrix_c;
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 0 ) ), -25.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 1 ) ), -31.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 0 ) ), -52.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 1, 1 ) ), -67.0 );
+  }
+
   TEST( VECTOR_MATRIX_PRODUCT, DR_VECTOR_DR_MATRIX )
   {
     using vector_type = LINALG::dyn_vector< double >;
@@ -2730,4 +3324,93 @@ namespace
     EXPECT_EQ( val, 5.0 );
   }
 
-}
\ No newline at end of file
+  TEST( INNER_PRODUCT, WIDENED_ACCUMULATION )
+  {
+    static_assert( ::std::is_same_v< LINALG::accumulation_type_t< float >, double > );
+    static_assert( ::std::is_same_v< LINALG::accumulation_type_t< double >, double > );
+    // Plain char is widened as signed char or unsigned char would be
+    static_assert( ::std::is_same_v< LINALG::accumulation_type_t< char >,
+                                     ::std::conditional_t< ::std::is_signed_v< char >, LINALG::accumulation_type_t< signed char >, LINALG::accumulation_type_t< unsigned char > > > );
+    using vector_type = LINALG::fs_vector< float, 3 >;
+    // Construct
+    vector_type vector_a { };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( vector_a, 0 ) = 1.0e8f;
+    LINALG_DETAIL::access( vector_a, 1 ) = 1.0f;
+    LINALG_DETAIL::access( vector_a, 2 ) = -1.0e8f;
+    // Construct
+    vector_type vector_b { };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( vector_b, 0 ) = 1.0f;
+    LINALG_DETAIL::access( vector_b, 1 ) = 1.0f;
+    LINALG_DETAIL::access( vector_b, 2 ) = 1.0f;
+    // Multiply the vector and vector, the unit term is lost if accumulated in single precision
+    auto val = inner_prod( vector_a, vector_b );
+    // Check the tensors were multiplied properly
+    EXPECT_EQ( val, 1.0f );
+    // Check an explicitly provided accumulator type is honored
+    EXPECT_EQ( ( LINALG::inner_prod< float >( vector_a, vector_b ) ), 0.0f );
+  }
+
+}
+
+LINALG_BEGIN
+
+// Accumulate this particular float product in single precision, overriding the widened default
+template < >
+struct accumulation_result< decltype( ::std::declval< const LINALG::fs_matrix< float, 1, 3 >& >() * ::std::declval< const LINALG::fs_matrix< float, 3, 1 >& >() ) >
+{
+  using type = float;
+};
+
+LINALG_END
+
+namespace
+{
+
+  TEST( MATRIX_PRODUCT, WIDENED_ACCUMULATION )
+  {
+    // Construct
+    LINALG::fs_matrix< char, 1, 3 > matrix_a;
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_a, 0, 0 ) = char( 100 );
+    LINALG_DETAIL::access( matrix_a, 0, 1 ) = char( 100 );
+    LINALG_DETAIL::access( matrix_a, 0, 2 ) = char( 100 );
+    // Construct
+    LINALG::fs_matrix< char, 3, 1 > matrix_b;
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_b, 0, 0 ) = char( 100 );
+    LINALG_DETAIL::access( matrix_b, 1, 0 ) = char( 100 );
+    LINALG_DETAIL::access( matrix_b, 2, 0 ) = char( 100 );
+    // Multiply the matrices, the sum overflows if accumulated in char
+    auto prod_matrix { matrix_a * matrix_b };
+    static_assert( ::std::is_same_v< LINALG::accumulation_result_t< decltype( prod_matrix ) >, LINALG::accumulation_type_t< int > > );
+    // Check the tensors were multiplied properly
+    EXPECT_EQ( ( LINALG_DETAIL::access( prod_matrix, 0, 0 ) ), 30000 );
+  }
+
+  TEST( MATRIX_PRODUCT, OVERRIDDEN_ACCUMULATION )
+  {
+    // Construct
+    LINALG::fs_matrix< float, 1, 3 > matrix_a;
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_a, 0, 0 ) = 1.0e8f;
+    LINALG_DETAIL::access( matrix_a, 0, 1 ) = 1.0f;
+    LINALG_DETAIL::access( matrix_a, 0, 2 ) = -1.0e8f;
+    // Construct
+    LINALG::fs_matrix< float, 3, 1 > matrix_b;
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_b, 0, 0 ) = 1.0f;
+    LINALG_DETAIL::access( matrix_b, 1, 0 ) = 1.0f;
+    LINALG_DETAIL::access( matrix_b, 2, 0 ) = 1.0f;
+    // Multiply the matrices, the override accumulates in single precision so the unit term is lost
+    auto prod_matrix { matrix_a * matrix_b };
+    static_assert( ::std::is_same_v< LINALG::accumulation_result_t< decltype( prod_matrix ) >, float > );
+    // Check the overridden accumulator type is honored
+    EXPECT_EQ( ( LINALG_DETAIL::access( prod_matrix, 0, 0 ) ), 0.0f );
+    // Check the same product evaluated through a tensor honors it as well
+    LINALG::fs_matrix< float, 1, 1 > matrix_c { prod_matrix };
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix_c, 0, 0 ) ), 0.0f );
+  }
+
+}
@@ -0,0 +1,494 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+
+namespace
+{
+
+  TEST( DECOMPOSITION, LU_SOLVE_DETERMINANT_INVERSE )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    using vector_type = LINALG::dyn_vector< double >;
+    // Diagonally dominant matrix with more than one panel of columns
+    constexpr ::std::size_t n = 150;
+    matrix_type matrix { ::std::extents< ::std::size_t, n, n >() };
+    matrix_type copy { ::std::extents< ::std::size_t, n, n >() };
+    vector_type rhs { ::std::extents< ::std::size_t, n >() };
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        LINALG_DETAIL::access( matrix, i, j ) = ( i == j ) ? 2.0 * n : static_cast< double >( ( i * 7 + j * 3 ) % 11 ) - 5.0;
+        LINALG_DETAIL::access( copy, i, j )   = LINALG_DETAIL::access( matrix, i, j );
+      }
+      LINALG_DETAIL::access( rhs, i ) = static_cast< double >( i % 5 ) - 2.0;
+    }
+    // Factor in place and solve
+    auto lu = LINALG::lu_factor( matrix );
+    EXPECT_FALSE( lu.is_singular() );
+    EXPECT_EQ( ( &lu.factors() ), &matrix );
+    auto x = lu.solve( rhs );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      double sum = 0.0;
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        sum += LINALG_DETAIL::access( copy, i, j ) * LINALG_DETAIL::access( x, j );
+      }
+      EXPECT_NEAR( sum, ( LINALG_DETAIL::access( rhs, i ) ), 1e-10 );
+    }
+    // Inverse
+    auto inv = lu.inverse();
+    for ( ::std::size_t i = 0; i < n; i += 13 )
+    {
+      for ( ::std::size_t j = 0; j < n; j += 7 )
+      {
+        double sum = 0.0;
+        for ( ::std::size_t k = 0; k < n; ++k )
+        {
+          sum += LINALG_DETAIL::access( copy, i, k ) * LINALG_DETAIL::access( inv, k, j );
+        }
+        EXPECT_NEAR( sum, ( ( i == j ) ? 1.0 : 0.0 ), 1e-12 );
+      }
+    }
+    // Determinant of a permuted triangular matrix
+    matrix_type perm { ::std::extents< ::std::size_t, 3, 3 >() };
+    LINALG_DETAIL::access( perm, 0, 0 ) = 0.0; LINALG_DETAIL::access( perm, 0, 1 ) = 2.0; LINALG_DETAIL::access( perm, 0, 2 ) = 1.0;
+    LINALG_DETAIL::access( perm, 1, 0 ) = 3.0; LINALG_DETAIL::access( perm, 1, 1 ) = 1.0; LINALG_DETAIL::access( perm, 1, 2 ) = 4.0;
+    LINALG_DETAIL::access( perm, 2, 0 ) = 0.0; LINALG_DETAIL::access( perm, 2, 1 ) = 0.0; LINALG_DETAIL::access( perm, 2, 2 ) = 5.0;
+    EXPECT_DOUBLE_EQ( ( LINALG::lu_factor( perm ).determinant() ), -30.0 );
+  }
+
+  TEST( DECOMPOSITION, LU_FIXED_SIZE_AND_SINGULAR )
+  {
+    using matrix_type = LINALG::fs_matrix< double, 3, 3 >;
+    using vector_type = LINALG::fs_vector< double, 3 >;
+    // Construct
+    matrix_type matrix;
+    LINALG_DETAIL::access( matrix, 0, 0 ) = 1.0; LINALG_DETAIL::access( matrix, 0, 1 ) = 2.0; LINALG_DETAIL::access( matrix, 0, 2 ) = 3.0;
+    LINALG_DETAIL::access( matrix, 1, 0 ) = 4.0; LINALG_DETAIL::access( matrix, 1, 1 ) = 5.0; LINALG_DETAIL::access( matrix, 1, 2 ) = 6.0;
+    LINALG_DETAIL::access( matrix, 2, 0 ) = 7.0; LINALG_DETAIL::access( matrix, 2, 1 ) = 8.0; LINALG_DETAIL::access( matrix, 2, 2 ) = 10.0;
+    vector_type rhs;
+    LINALG_DETAIL::access( rhs, 0 ) = 6.0;
+    LINALG_DETAIL::access( rhs, 1 ) = 15.0;
+    LINALG_DETAIL::access( rhs, 2 ) = 25.0;
+    // Unrolled factorization of a fixed size matrix
+    auto lu = LINALG::lu_factor( matrix );
+    EXPECT_EQ( ( lu.pivots()[0] ), 2 );
+    EXPECT_NEAR( ( lu.determinant() ), -3.0, 1e-12 );
+    auto x = lu.solve( rhs );
+    EXPECT_NEAR( ( LINALG_DETAIL::access( x, 0 ) ), 1.0, 1e-12 );
+    EXPECT_NEAR( ( LINALG_DETAIL::access( x, 1 ) ), 1.0, 1e-12 );
+    EXPECT_NEAR( ( LINALG_DETAIL::access( x, 2 ) ), 1.0, 1e-12 );
+    // A singular matrix factors, but cannot be solved
+    matrix_type singular;
+    for ( ::std::size_t i = 0; i < 3; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 3; ++j )
+      {
+        LINALG_DETAIL::access( singular, i, j ) = static_cast< double >( i + j );
+      }
+    }
+    auto slu = LINALG::lu_factor( singular );
+    EXPECT_TRUE( slu.is_singular() );
+    EXPECT_EQ( ( slu.determinant() ), 0.0 );
+    EXPECT_THROW( ( (void) slu.solve( rhs ) ), ::std::domain_error );
+  }
+
+  TEST( DECOMPOSITION, LU_SUBMATRIX )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Factor the leading 2 x 2 block of a larger matrix through a view
+    matrix_type matrix { ::std::extents< ::std::size_t, 3, 3 >() };
+    LINALG_DETAIL::access( matrix, 0, 0 ) = 2.0; LINALG_DETAIL::access( matrix, 0, 1 ) = 1.0; LINALG_DETAIL::access( matrix, 0, 2 ) = 9.0;
+    LINALG_DETAIL::access( matrix, 1, 0 ) = 4.0; LINALG_DETAIL::access( matrix, 1, 1 ) = 3.0; LINALG_DETAIL::access( matrix, 1, 2 ) = 9.0;
+    LINALG_DETAIL::access( matrix, 2, 0 ) = 9.0; LINALG_DETAIL::access( matrix, 2, 1 ) = 9.0; LINALG_DETAIL::access( matrix, 2, 2 ) = 9.0;
+    auto lu = LINALG::lu_factor( submatrix( matrix, ::std::tuple(0,2), ::std::tuple(0,2) ) );
+    EXPECT_DOUBLE_EQ( ( lu.determinant() ), 2.0 );
+    // The view was factored in place: row interchange then L and U
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix, 0, 0 ) ), 4.0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix, 1, 0 ) ), 0.5 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix, 1, 1 ) ), -0.5 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( matrix, 2, 2 ) ), 9.0 );
+  }
+
+  TEST( DECOMPOSITION, CHOLESKY_SOLVE_LOG_DET_UPDATE )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    using vector_type = LINALG::dyn_vector< double >;
+    // Positive definite matrix with more than one panel of columns: B B^T + n I
+    constexpr ::std::size_t n = 100;
+    matrix_type b { ::std::extents< ::std::size_t, n, n >() };
+    matrix_type matrix { ::std::extents< ::std::size_t, n, n >() };
+    vector_type rhs { ::std::extents< ::std::size_t, n >() };
+    vector_type v { ::std::extents< ::std::size_t, n >() };
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        LINALG_DETAIL::access( b, i, j ) = static_cast< double >( ( i * 5 + j * 3 ) % 7 ) - 3.0;
+      }
+      LINALG_DETAIL::access( rhs, i ) = static_cast< double >( i % 3 ) - 1.0;
+      LINALG_DETAIL::access( v, i )   = static_cast< double >( i % 4 );
+    }
+    matrix = b * trans( b );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      LINALG_DETAIL::access( matrix, i, i ) += static_cast< double >( n );
+    }
+    matrix_type copy = matrix;
+    // Factor a copy and solve
+    auto chol = LINALG::cholesky( matrix_type( matrix ) );
+    auto x = chol.solve( rhs );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      double sum = 0.0;
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        sum += LINALG_DETAIL::access( copy, i, j ) * LINALG_DETAIL::access( x, j );
+      }
+      EXPECT_NEAR( sum, ( LINALG_DETAIL::access( rhs, i ) ), 1e-10 );
+    }
+    // Substitutions compose to the solve
+    auto y = chol.back_substitution( chol.forward_substitution( rhs ) );
+    EXPECT_NEAR( ( LINALG_DETAIL::access( y, n - 1 ) ), ( LINALG_DETAIL::access( x, n - 1 ) ), 1e-14 );
+    // The log determinant agrees with LU
+    auto   lu      = LINALG::lu_factor( copy );
+    double log_det = 0.0;
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      log_det += ::std::log( ::std::abs( LINALG_DETAIL::access( lu.factors(), i, i ) ) );
+    }
+    EXPECT_NEAR( ( chol.log_det() ), log_det, 1e-8 );
+    // Update by v v^T, then downdate back
+    matrix_type updated = matrix;
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        LINALG_DETAIL::access( updated, i, j ) += LINALG_DETAIL::access( v, i ) * LINALG_DETAIL::access( v, j );
+      }
+    }
+    chol.update( v );
+    EXPECT_NEAR( ( chol.log_det() ), ( LINALG::cholesky( updated ).log_det() ), 1e-8 );
+    chol.downdate( v );
+    auto original = LINALG::cholesky( matrix );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j <= i; ++j )
+      {
+        EXPECT_NEAR( ( LINALG_DETAIL::access( chol.factors(), i, j ) ), ( LINALG_DETAIL::access( original.factors(), i, j ) ), 1e-10 );
+      }
+    }
+    // Indefinite matrices throw
+    matrix_type indefinite { ::std::extents< ::std::size_t, 2, 2 >() };
+    LINALG_DETAIL::access( indefinite, 0, 0 ) = 1.0; LINALG_DETAIL::access( indefinite, 0, 1 ) = 2.0;
+    LINALG_DETAIL::access( indefinite, 1, 0 ) = 2.0; LINALG_DETAIL::access( indefinite, 1, 1 ) = 1.0;
+    EXPECT_THROW( ( (void) LINALG::cholesky( indefinite ) ), ::std::domain_error );
+  }
+
+  TEST( DECOMPOSITION, QR_THIN_Q_AND_LEAST_SQUARES )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    using vector_type = LINALG::dyn_vector< double >;
+    // Tall matrix with more than one panel of columns
+    constexpr ::std::size_t m = 300;
+    constexpr ::std::size_t n = 40;
+    matrix_type matrix { ::std::extents< ::std::size_t, m, n >() };
+    vector_type rhs { ::std::extents< ::std::size_t, m >() };
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        LINALG_DETAIL::access( matrix, i, j ) = static_cast< double >( ( i * 13 + j * 7 + i * j ) % 17 ) - 8.0 + ( ( i == j ) ? 20.0 : 0.0 );
+      }
+      LINALG_DETAIL::access( rhs, i ) = static_cast< double >( i % 9 ) - 4.0;
+    }
+    // Q R reproduces A and Q has orthonormal columns
+    auto qr = LINALG::qr_factor( matrix_type( matrix ) );
+    auto q  = qr.thin_q();
+    auto r  = qr.r();
+    EXPECT_EQ( ( q.extent(0) ), m );
+    EXPECT_EQ( ( q.extent(1) ), n );
+    EXPECT_EQ( ( r.extent(0) ), n );
+    for ( ::std::size_t i = 0; i < m; i += 7 )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        double sum = 0.0;
+        for ( ::std::size_t k = 0; k <= j; ++k )
+        {
+          sum += LINALG_DETAIL::access( q, i, k ) * LINALG_DETAIL::access( r, k, j );
+        }
+        EXPECT_NEAR( sum, ( LINALG_DETAIL::access( matrix, i, j ) ), 1e-10 );
+      }
+    }
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        double sum = 0.0;
+        for ( ::std::size_t k = 0; k < m; ++k )
+        {
+          sum += LINALG_DETAIL::access( q, k, i ) * LINALG_DETAIL::access( q, k, j );
+        }
+        EXPECT_NEAR( sum, ( ( i == j ) ? 1.0 : 0.0 ), 1e-12 );
+      }
+    }
+    // The least squares residual is orthogonal to the columns of A, and TSQR agrees
+    auto x    = LINALG::least_squares( matrix, rhs );
+    auto tsqr = LINALG::least_squares( matrix, rhs, LINALG::qr_mode::tsqr );
+    for ( ::std::size_t j = 0; j < n; ++j )
+    {
+      double dot = 0.0;
+      for ( ::std::size_t i = 0; i < m; ++i )
+      {
+        double residual = LINALG_DETAIL::access( rhs, i );
+        for ( ::std::size_t k = 0; k < n; ++k )
+        {
+          residual -= LINALG_DETAIL::access( matrix, i, k ) * LINALG_DETAIL::access( x, k );
+        }
+        dot += LINALG_DETAIL::access( matrix, i, j ) * residual;
+      }
+      EXPECT_NEAR( dot, 0.0, 1e-8 );
+      EXPECT_NEAR( ( LINALG_DETAIL::access( tsqr, j ) ), ( LINALG_DETAIL::access( x, j ) ), 1e-10 );
+    }
+    // TSQR R factor matches up to the signs of its rows, with one block per hardware thread, a single block,
+    // and 3 blocks whose R factors are merged whatever the hardware
+    for ( const ::std::size_t blocks : { ::std::size_t( 0 ), ::std::size_t( 1 ), ::std::size_t( 3 ) } )
+    {
+      auto tsqr_r = LINALG::tsqr_r( matrix, blocks );
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        for ( ::std::size_t j = i; j < n; ++j )
+        {
+          EXPECT_NEAR( ::std::abs( LINALG_DETAIL::access( tsqr_r, i, j ) ), ::std::abs( LINALG_DETAIL::access( r, i, j ) ), 1e-10 );
+        }
+      }
+    }
+  }
+
+  TEST( DECOMPOSITION, TRIANGULAR_SOLVE_EXPRESSIONS )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    using vector_type = LINALG::dyn_vector< double >;
+    // Lower triangle spanning more than one diagonal block, with garbage above the diagonal
+    constexpr ::std::size_t n       = 100;
+    constexpr ::std::size_t columns = 3;
+    matrix_type tri { ::std::extents< ::std::size_t, n, n >() };
+    matrix_type rhs { ::std::extents< ::std::size_t, n, columns >() };
+    vector_type vec { ::std::extents< ::std::size_t, n >() };
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        LINALG_DETAIL::access( tri, i, j ) = ( i == j ) ? 4.0 : ( ( i > j ) ? 0.01 * static_cast< double >( ( i + 2 * j ) % 7 ) : 1.0e3 );
+      }
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        LINALG_DETAIL::access( rhs, i, j ) = static_cast< double >( ( i + j ) % 5 ) - 2.0;
+      }
+      LINALG_DETAIL::access( vec, i ) = static_cast< double >( i % 3 ) - 1.0;
+    }
+    const auto lower_residual = [&]( const auto& x, const auto& b, ::std::size_t j )
+    {
+      double error = 0.0;
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        double sum = 0.0;
+        for ( ::std::size_t k = 0; k <= i; ++k )
+        {
+          sum += LINALG_DETAIL::access( tri, i, k ) * LINALG_DETAIL::access( x, k, j );
+        }
+        error = ::std::max( error, ::std::abs( sum - LINALG_DETAIL::access( b, i, j ) ) );
+      }
+      return error;
+    };
+    // Multiple right hand sides
+    matrix_type x = LINALG::solve_lower( tri, rhs );
+    for ( ::std::size_t j = 0; j < columns; ++j )
+    {
+      EXPECT_LT( lower_residual( x, rhs, j ), 1e-12 );
+    }
+    // Element access agrees with the evaluated solution
+    EXPECT_NEAR( ( LINALG::solve_lower( tri, rhs )( n - 1, 2 ) ), ( LINALG_DETAIL::access( x, n - 1, 2 ) ), 1e-12 );
+    // Single right hand side, upper triangle read through a transpose
+    vector_type y = LINALG::solve_upper( trans( tri ), vec );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      double sum = 0.0;
+      for ( ::std::size_t k = i; k < n; ++k )
+      {
+        sum += LINALG_DETAIL::access( tri, k, i ) * LINALG_DETAIL::access( y, k );
+      }
+      EXPECT_NEAR( sum, ( LINALG_DETAIL::access( vec, i ) ), 1e-12 );
+    }
+    EXPECT_NEAR( ( LINALG::solve_upper( trans( tri ), vec )( 0 ) ), ( LINALG_DETAIL::access( y, 0 ) ), 1e-12 );
+    // Solving in place over the right hand sides
+    matrix_type b = rhs;
+    b = LINALG::solve_lower( tri, b );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        EXPECT_NEAR( ( LINALG_DETAIL::access( b, i, j ) ), ( LINALG_DETAIL::access( x, i, j ) ), 1e-12 );
+      }
+    }
+    // Incompatible extents
+    EXPECT_THROW( static_cast< void >( LINALG::solve_lower( rhs, vec ) ), ::std::length_error );
+  }
+
+  TEST( DECOMPOSITION, INVERSE_PRODUCT_SOLVES )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    using vector_type = LINALG::dyn_vector< double >;
+    constexpr ::std::size_t n       = 40;
+    constexpr ::std::size_t columns = 3;
+    matrix_type general { ::std::extents< ::std::size_t, n, n >() };
+    matrix_type spd { ::std::extents< ::std::size_t, n, n >() };
+    matrix_type rhs { ::std::extents< ::std::size_t, n, columns >() };
+    vector_type vec { ::std::extents< ::std::size_t, n >() };
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        LINALG_DETAIL::access( general, i, j ) = ( i == j ) ? 10.0 : static_cast< double >( ( i * 5 + j * 3 ) % 7 ) - 3.0;
+        LINALG_DETAIL::access( spd, i, j )     = ( i == j ) ? 2.0 * n : 1.0 / static_cast< double >( 1 + i + j );
+      }
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        LINALG_DETAIL::access( rhs, i, j ) = static_cast< double >( ( 2 * i + j ) % 5 ) - 2.0;
+      }
+      LINALG_DETAIL::access( vec, i ) = static_cast< double >( i % 4 ) - 1.5;
+    }
+    const auto residual = [&]( const matrix_type& a, const auto& x, const auto& b )
+    {
+      double error = 0.0;
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        if constexpr ( ::std::remove_cvref_t< decltype( x ) >::rank() == 1 )
+        {
+          double sum = -LINALG_DETAIL::access( b, i );
+          for ( ::std::size_t k = 0; k < n; ++k )
+          {
+            sum += LINALG_DETAIL::access( a, i, k ) * LINALG_DETAIL::access( x, k );
+          }
+          error = ::std::max( error, ::std::abs( sum ) );
+        }
+        else
+        {
+          for ( ::std::size_t j = 0; j < columns; ++j )
+          {
+            double sum = -LINALG_DETAIL::access( b, i, j );
+            for ( ::std::size_t k = 0; k < n; ++k )
+            {
+              sum += LINALG_DETAIL::access( a, i, k ) * LINALG_DETAIL::access( x, k, j );
+            }
+            error = ::std::max( error, ::std::abs( sum ) );
+          }
+        }
+      }
+      return error;
+    };
+    // A general matrix is solved with LU
+    const auto general_inverse = LINALG::inverse( general );
+    matrix_type x { ::std::extents< ::std::size_t, n, columns >() };
+    x = general_inverse * rhs;
+    EXPECT_FALSE( general_inverse.is_cholesky() );
+    EXPECT_LT( residual( general, x, rhs ), 1e-12 );
+    // A symmetric positive definite matrix is solved with Cholesky, reusing the factorization
+    const auto spd_inverse = LINALG::inverse( spd );
+    vector_type y { ::std::extents< ::std::size_t, n >() };
+    y = spd_inverse * vec;
+    EXPECT_TRUE( spd_inverse.is_cholesky() );
+    EXPECT_LT( residual( spd, y, vec ), 1e-12 );
+    matrix_type z { ::std::extents< ::std::size_t, n, columns >() };
+    z = spd_inverse * rhs;
+    EXPECT_LT( residual( spd, z, rhs ), 1e-12 );
+    // Solving in place over the right hand sides
+    matrix_type b = rhs;
+    b = LINALG::inverse( general ) * b;
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        EXPECT_NEAR( ( LINALG_DETAIL::access( b, i, j ) ), ( LINALG_DETAIL::access( x, i, j ) ), 1e-12 );
+      }
+    }
+    // Construction solves as assignment does, without the explicit inverse
+    const matrix_type constructed = general_inverse * rhs;
+    const matrix_type evaluated   = ( general_inverse * rhs ).evaluate();
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        EXPECT_NEAR( ( LINALG_DETAIL::access( constructed, i, j ) ), ( LINALG_DETAIL::access( x, i, j ) ), 1e-12 );
+        EXPECT_NEAR( ( LINALG_DETAIL::access( evaluated, i, j ) ), ( LINALG_DETAIL::access( x, i, j ) ), 1e-12 );
+      }
+    }
+    EXPECT_FALSE( general_inverse.has_inverse() );
+    // Element access evaluates the explicit inverse
+    double sum = 0.0;
+    for ( ::std::size_t k = 0; k < n; ++k )
+    {
+      sum += general_inverse( 0, k ) * LINALG_DETAIL::access( rhs, k, 0 );
+    }
+    EXPECT_NEAR( sum, ( LINALG_DETAIL::access( x, 0, 0 ) ), 1e-12 );
+    EXPECT_TRUE( general_inverse.has_inverse() );
+    // Non square matrices have no inverse
+    EXPECT_THROW( static_cast< void >( LINALG::inverse( rhs ) ), ::std::length_error );
+  }
+
+  TEST( DECOMPOSITION, INVERSE_PRODUCT_IN_TREE_SOLVES )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    constexpr ::std::size_t n       = 40;
+    constexpr ::std::size_t columns = 3;
+    matrix_type a { ::std::extents< ::std::size_t, n, n >() };
+    matrix_type b { ::std::extents< ::std::size_t, n, columns >() };
+    matrix_type c { ::std::extents< ::std::size_t, n, columns >() };
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        LINALG_DETAIL::access( a, i, j ) = ( i == j ) ? 10.0 : static_cast< double >( ( i * 5 + j * 3 ) % 7 ) - 3.0;
+      }
+      for ( ::std::size_t j = 0; j < columns; ++j )
+      {
+        LINALG_DETAIL::access( b, i, j ) = static_cast< double >( ( 2 * i + j ) % 5 ) - 2.0;
+        LINALG_DETAIL::access( c, i, j ) = static_cast< double >( ( i + 3 * j ) % 4 ) - 1.0;
+      }
+    }
+    const auto a_inverse = LINALG::inverse( a );
+    matrix_type solved { ::std::extents< ::std::size_t, n, columns >() };
+    solved = a_inverse * b;
+    const auto expect_near = [&]( const matrix_type& x, double scale, double offset_scale )
+    {
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        for ( ::std::size_t j = 0; j < columns; ++j )
+        {
+          EXPECT_NEAR( ( LINALG_DETAIL::access( x, i, j ) ),
+                       scale * LINALG_DETAIL::access( solved, i, j ) + offset_scale * LINALG_DETAIL::access( c, i, j ), 1e-12 );
+        }
+      }
+    };
+    // The product is solved wherever it sits in the tree, so the explicit inverse is never formed
+    matrix_type x { ::std::extents< ::std::size_t, n, columns >() };
+    x = a_inverse * b + c;
+    expect_near( x, 1.0, 1.0 );
+    x = 2.0 * a_inverse * b;
+    expect_near( x, 2.0, 0.0 );
+    x = c - a_inverse * b * 0.5;
+    expect_near( x, -0.5, 1.0 );
+    x = -( a_inverse * b );
+    expect_near( x, -1.0, 0.0 );
+    // Terms which read the destination itself
+    x = c;
+    x = a_inverse * b + x;
+    expect_near( x, 1.0, 1.0 );
+    const matrix_type constructed = 2.0 * a_inverse * b + c;
+    expect_near( constructed, 2.0, 1.0 );
+    EXPECT_FALSE( a_inverse.has_inverse() );
+  }
+
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+
+namespace
+{
+
+  TEST( FAST_PRODUCT, STRASSEN_SQUARE )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 100, 100 >() };
+    matrix_type matrix_b { ::std::extents< ::std::size_t, 100, 100 >() };
+    matrix_type result { ::std::extents< ::std::size_t, 100, 100 >() };
+    // Populate with small integers so every sum is exact
+    for ( ::std::size_t i = 0; i < 100; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 100; ++j )
+      {
+        LINALG_DETAIL::access( matrix_a, i, j ) = static_cast< double >( ( i + 2 * j ) % 7 ) - 3.0;
+        LINALG_DETAIL::access( matrix_b, i, j ) = static_cast< double >( ( 3 * i + j ) % 5 ) - 2.0;
+      }
+    }
+    // Three levels of recursion over a padded 104 x 104 product
+    LINALG::strassen( result, LINALG::strassen_policy { 16 } ) = matrix_a * matrix_b;
+    for ( ::std::size_t i = 0; i < 100; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 100; ++j )
+      {
+        double expected = 0.0;
+        for ( ::std::size_t k = 0; k < 100; ++k )
+        {
+          expected += LINALG_DETAIL::access( matrix_a, i, k ) * LINALG_DETAIL::access( matrix_b, k, j );
+        }
+        EXPECT_EQ( ( LINALG_DETAIL::access( result, i, j ) ), expected );
+      }
+    }
+  }
+
+  TEST( FAST_PRODUCT, STRASSEN_RECTANGULAR_WITH_WORKSPACE )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Construct
+    matrix_type matrix_a { ::std::extents< ::std::size_t, 37, 53 >() };
+    matrix_type matrix_b { ::std::extents< ::std::size_t, 29, 53 >() };
+    matrix_type result;
+    for ( ::std::size_t i = 0; i < 37; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 53; ++j )
+      {
+        LINALG_DETAIL::access( matrix_a, i, j ) = static_cast< double >( ( i * j ) % 11 ) - 5.0;
+      }
+    }
+    for ( ::std::size_t i = 0; i < 29; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 53; ++j )
+      {
+        LINALG_DETAIL::access( matrix_b, i, j ) = static_cast< double >( ( i + j ) % 3 );
+      }
+    }
+    // Preallocate, then evaluate a scaled product with a transposed operand
+    LINALG::strassen_workspace< double > workspace;
+    workspace.reserve( 37, 53, 29, LINALG::strassen_policy { 8 } );
+    const ::std::size_t capacity = workspace.capacity();
+    LINALG::strassen( result, workspace, LINALG::strassen_policy { 8 } ) = 2.0 * matrix_a * trans( matrix_b );
+    EXPECT_EQ( workspace.capacity(), capacity );
+    EXPECT_EQ( ( result.extent(0) ), 37 );
+    EXPECT_EQ( ( result.extent(1) ), 29 );
+    for ( ::std::size_t i = 0; i < 37; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 29; ++j )
+      {
+        double expected = 0.0;
+        for ( ::std::size_t k = 0; k < 53; ++k )
+        {
+          expected += LINALG_DETAIL::access( matrix_a, i, k ) * LINALG_DETAIL::access( matrix_b, j, k );
+        }
+        EXPECT_EQ( ( LINALG_DETAIL::access( result, i, j ) ), 2.0 * expected );
+      }
+    }
+  }
+
+  TEST( FAST_PRODUCT, STRASSEN_ERROR_BOUND )
+  {
+    // Without recursion the bound is that of the conventional product
+    EXPECT_EQ( LINALG::strassen_error_bound( 64, LINALG::strassen_policy { 64 } ), 64.0 * 64.0 );
+    // One level: 18 ( 32^2 + 6 * 32 ) - 6 * 64
+    EXPECT_EQ( LINALG::strassen_error_bound( 64, LINALG::strassen_policy { 32 } ), 21504.0 );
+  }
+
+}
@@ -0,0 +1,289 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+
+namespace
+{
+
+  // Order of the g x g grid systems
+  constexpr ::std::size_t g = 20;
+  constexpr ::std::size_t n = g * g;
+
+  // Five point convection-diffusion stencil on the grid with Dirichlet boundaries: symmetric positive
+  // definite when convection is zero, and the diagonal grows along the grid to vary the Jacobi scaling
+  LINALG::dyn_matrix< double > grid_matrix( double convection )
+  {
+    LINALG::dyn_matrix< double > matrix { ::std::extents< ::std::size_t, n, n >() };
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        LINALG_DETAIL::access( matrix, i, j ) = 0.0;
+      }
+      const ::std::size_t row    = i / g;
+      const ::std::size_t column = i % g;
+      LINALG_DETAIL::access( matrix, i, i ) = 4.0 + 0.01 * static_cast< double >( i );
+      if ( row > 0 )          LINALG_DETAIL::access( matrix, i, i - g ) = -1.0 - convection;
+      if ( row + 1 < g )      LINALG_DETAIL::access( matrix, i, i + g ) = -1.0 + convection;
+      if ( column > 0 )       LINALG_DETAIL::access( matrix, i, i - 1 ) = -1.0 - convection;
+      if ( column + 1 < g )   LINALG_DETAIL::access( matrix, i, i + 1 ) = -1.0 + convection;
+    }
+    return matrix;
+  }
+
+  LINALG::dyn_tensor< double, 1 > grid_rhs()
+  {
+    LINALG::dyn_tensor< double, 1 > b { ::std::extents< ::std::size_t, n >() };
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      LINALG_DETAIL::access( b, i ) = static_cast< double >( ( i * 7 ) % 13 ) / 6.0 - 1.0;
+    }
+    return b;
+  }
+
+  // || b - A x || / || b ||
+  double relative_residual( const LINALG::dyn_matrix< double >& a, const LINALG::dyn_tensor< double, 1 >& b, const LINALG::dyn_tensor< double, 1 >& x )
+  {
+    double residual = 0.0;
+    double norm     = 0.0;
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      double sum = LINALG_DETAIL::access( b, i );
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        sum -= LINALG_DETAIL::access( a, i, j ) * LINALG_DETAIL::access( x, j );
+      }
+      residual += sum * sum;
+      norm     += LINALG_DETAIL::access( b, i ) * LINALG_DETAIL::access( b, i );
+    }
+    return ::std::sqrt( residual / norm );
+  }
+
+  LINALG::dyn_tensor< double, 1 > zero_vector()
+  {
+    LINALG::dyn_tensor< double, 1 > x { ::std::extents< ::std::size_t, n >() };
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      LINALG_DETAIL::access( x, i ) = 0.0;
+    }
+    return x;
+  }
+
+  TEST( ITERATIVE, CG )
+  {
+    using vector_type = LINALG::dyn_tensor< double, 1 >;
+    const auto matrix = grid_matrix( 0.0 );
+    const auto b      = grid_rhs();
+    // The same operator known only through its products
+    const auto laplacian = LINALG::make_linear_operator< double >( n, [&matrix]( const vector_type& x, vector_type& y )
+    {
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        double sum = 0.0;
+        for ( const ::std::size_t j : { ( i >= g ) ? i - g : i, ( i + g < n ) ? i + g : i, ( i % g > 0 ) ? i - 1 : i, ( i % g + 1 < g ) ? i + 1 : i } )
+        {
+          sum += ( j != i ) ? LINALG_DETAIL::access( matrix, i, j ) * LINALG_DETAIL::access( x, j ) : 0.0;
+        }
+        LINALG_DETAIL::access( y, i ) = sum + LINALG_DETAIL::access( matrix, i, i ) * LINALG_DETAIL::access( x, i );
+      }
+    } );
+    LINALG::cg_workspace< double > workspace( n );
+    const double tolerance = 1e-10;
+
+    auto x = zero_vector();
+    const auto plain = LINALG::cg( laplacian, b, x, workspace, LINALG::identity_preconditioner(), tolerance );
+    EXPECT_LE( plain.residual(), tolerance );
+    EXPECT_LE( relative_residual( matrix, b, x ), 1e-9 );
+
+    x = zero_vector();
+    const auto dense = LINALG::cg( matrix, b, x, workspace, LINALG::identity_preconditioner(), tolerance );
+    // Summation order differs between the two products, which may move convergence by an iteration
+    EXPECT_NEAR( ( static_cast< double >( dense.iterations() ) ), ( static_cast< double >( plain.iterations() ) ), 1.0 );
+    EXPECT_LE( relative_residual( matrix, b, x ), 1e-9 );
+
+    x = zero_vector();
+    const auto jacobi = LINALG::cg( laplacian, b, x, workspace, LINALG::make_jacobi_preconditioner( matrix ), tolerance );
+    EXPECT_LE( jacobi.iterations(), plain.iterations() );
+    EXPECT_LE( relative_residual( matrix, b, x ), 1e-9 );
+
+    x = zero_vector();
+    const auto ilu = LINALG::cg( laplacian, b, x, workspace, LINALG::make_ilu0_preconditioner( matrix ), tolerance );
+    EXPECT_LE( ilu.iterations() * 3, plain.iterations() * 2 );
+    EXPECT_LE( relative_residual( matrix, b, x ), 1e-9 );
+
+    // Starting from the solution takes no iteration
+    const auto again = LINALG::cg( laplacian, b, x, workspace, LINALG::identity_preconditioner(), 1e-6 );
+    EXPECT_EQ( again.iterations(), 0u );
+
+    // Too few iterations, and a workspace of the wrong order
+    x = zero_vector();
+    EXPECT_THROW( static_cast< void >( LINALG::cg( laplacian, b, x, workspace, LINALG::identity_preconditioner(), tolerance, 3 ) ), ::std::domain_error );
+    LINALG::cg_workspace< double > small( n - 1 );
+    EXPECT_THROW( static_cast< void >( LINALG::cg( laplacian, b, x, small ) ), ::std::length_error );
+  }
+
+  TEST( ITERATIVE, BICGSTAB )
+  {
+    const auto matrix = grid_matrix( 0.4 );
+    const auto b      = grid_rhs();
+    LINALG::bicgstab_workspace< double > workspace( n );
+    const double tolerance = 1e-10;
+
+    auto x = zero_vector();
+    const auto plain = LINALG::bicgstab( matrix, b, x, workspace, LINALG::identity_preconditioner(), tolerance );
+    EXPECT_LE( relative_residual( matrix, b, x ), 1e-9 );
+
+    x = zero_vector();
+    const auto jacobi = LINALG::bicgstab( matrix, b, x, workspace, LINALG::make_jacobi_preconditioner( matrix ), tolerance );
+    EXPECT_LE( relative_residual( matrix, b, x ), 1e-9 );
+    static_cast< void >( jacobi );
+
+    x = zero_vector();
+    const auto ilu = LINALG::bicgstab( matrix, b, x, workspace, LINALG::make_ilu0_preconditioner( matrix ), tolerance );
+    EXPECT_LE( ilu.iterations() * 3, plain.iterations() * 2 );
+    EXPECT_LE( relative_residual( matrix, b, x ), 1e-9 );
+  }
+
+  TEST( ITERATIVE, GMRES )
+  {
+    const auto matrix = grid_matrix( 0.4 );
+    const auto b      = grid_rhs();
+    const double tolerance = 1e-10;
+
+    // Restarted every 10 steps, then with room for the whole solve
+    for ( const ::std::size_t restart : { ::std::size_t( 10 ), ::std::size_t( 200 ) } )
+    {
+      LINALG::gmres_workspace< double > workspace( n, restart );
+
+      auto x = zero_vector();
+      const auto plain = LINALG::gmres( matrix, b, x, workspace, LINALG::identity_preconditioner(), tolerance );
+      EXPECT_LE( relative_residual( matrix, b, x ), 1e-9 );
+
+      x = zero_vector();
+      const auto jacobi = LINALG::gmres( matrix, b, x, workspace, LINALG::make_jacobi_preconditioner( matrix ), tolerance );
+      EXPECT_LE( relative_residual( matrix, b, x ), 1e-9 );
+      static_cast< void >( jacobi );
+
+      x = zero_vector();
+      const auto ilu = LINALG::gmres( matrix, b, x, workspace, LINALG::make_ilu0_preconditioner( matrix ), tolerance );
+      EXPECT_LE( ilu.iterations() * 3, plain.iterations() * 2 );
+      EXPECT_LE( relative_residual( matrix, b, x ), 1e-9 );
+    }
+  }
+
+  TEST( ITERATIVE, ZERO_RHS )
+  {
+    using vector_type = LINALG::dyn_tensor< double, 1 >;
+    const auto matrix = grid_matrix( 0.4 );
+    const auto b      = zero_vector();
+    // The operator counts its applications, and none are needed to return x = 0
+    ::std::size_t applications = 0;
+    const auto counted = LINALG::make_linear_operator< double >( n, [&matrix,&applications]( const vector_type& x, vector_type& y )
+    {
+      ++applications;
+      y = matrix * x;
+    } );
+    LINALG::cg_workspace< double >       cg_workspace( n );
+    LINALG::bicgstab_workspace< double > bicgstab_workspace( n );
+    LINALG::gmres_workspace< double >    gmres_workspace( n, 10 );
+    // Solvers started from a nonzero x return x = 0 without iterating
+    auto x = grid_rhs();
+    const auto cg = LINALG::cg( counted, b, x, cg_workspace );
+    EXPECT_EQ( cg.iterations(), 0 );
+    EXPECT_EQ( cg.residual(), 0.0 );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      EXPECT_EQ( ( LINALG_DETAIL::access( x, i ) ), 0.0 );
+    }
+    x = grid_rhs();
+    const auto bicgstab = LINALG::bicgstab( counted, b, x, bicgstab_workspace );
+    EXPECT_EQ( bicgstab.iterations(), 0 );
+    EXPECT_EQ( bicgstab.residual(), 0.0 );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      EXPECT_EQ( ( LINALG_DETAIL::access( x, i ) ), 0.0 );
+    }
+    x = grid_rhs();
+    const auto gmres = LINALG::gmres( counted, b, x, gmres_workspace );
+    EXPECT_EQ( gmres.iterations(), 0 );
+    EXPECT_EQ( gmres.residual(), 0.0 );
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      EXPECT_EQ( ( LINALG_DETAIL::access( x, i ) ), 0.0 );
+    }
+    EXPECT_EQ( applications, 0 );
+  }
+
+  TEST( ITERATIVE, GMRES_BREAKDOWN )
+  {
+    // A e0 = 0 makes the first Krylov subspace invariant with a singular Hessenberg matrix, b = e0 not in the range of A
+    constexpr ::std::size_t m = 3;
+    LINALG::dyn_matrix< double >    matrix { ::std::extents< ::std::size_t, m, m >() };
+    LINALG::dyn_tensor< double, 1 > b { ::std::extents< ::std::size_t, m >() };
+    LINALG::dyn_tensor< double, 1 > x { ::std::extents< ::std::size_t, m >() };
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t j = 0; j < m; ++j )
+      {
+        LINALG_DETAIL::access( matrix, i, j ) = ( ( i == j ) && ( i > 0 ) ) ? 1.0 : 0.0;
+      }
+      LINALG_DETAIL::access( b, i ) = ( i == 0 ) ? 1.0 : 0.0;
+      LINALG_DETAIL::access( x, i ) = 0.0;
+    }
+    LINALG::gmres_workspace< double > workspace( m, m );
+    EXPECT_THROW( static_cast< void >( LINALG::gmres( matrix, b, x, workspace ) ), ::std::domain_error );
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      EXPECT_FALSE( ::std::isnan( LINALG_DETAIL::access( x, i ) ) );
+    }
+  }
+
+  TEST( ITERATIVE, PRECONDITIONERS )
+  {
+    using vector_type = LINALG::dyn_tensor< double, 1 >;
+    // On a tridiagonal matrix ILU(0) is the exact LU factorization
+    constexpr ::std::size_t m = 6;
+    LINALG::dyn_matrix< double > matrix { ::std::extents< ::std::size_t, m, m >() };
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t j = 0; j < m; ++j )
+      {
+        LINALG_DETAIL::access( matrix, i, j ) = ( i == j ) ? 3.0 + static_cast< double >( i ) : ( ( i == j + 1 ) ? -1.0 : ( ( j == i + 1 ) ? -2.0 : 0.0 ) );
+      }
+    }
+    vector_type r { ::std::extents< ::std::size_t, m >() };
+    vector_type z { ::std::extents< ::std::size_t, m >() };
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      LINALG_DETAIL::access( r, i ) = static_cast< double >( i ) - 2.0;
+    }
+    const auto   ilu = LINALG::make_ilu0_preconditioner( matrix );
+    const double rz  = ilu.apply( r, z );
+    double       dot = 0.0;
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      double sum = 0.0;
+      for ( ::std::size_t j = 0; j < m; ++j )
+      {
+        sum += LINALG_DETAIL::access( matrix, i, j ) * LINALG_DETAIL::access( z, j );
+      }
+      EXPECT_NEAR( sum, ( LINALG_DETAIL::access( r, i ) ), 1e-12 );
+      dot += LINALG_DETAIL::access( r, i ) * LINALG_DETAIL::access( z, i );
+    }
+    EXPECT_NEAR( rz, dot, 1e-12 );
+
+    // Jacobi scales by the inverse diagonal
+    const auto jacobi = LINALG::make_jacobi_preconditioner( matrix );
+    static_cast< void >( jacobi.apply( r, z ) );
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      EXPECT_NEAR( ( LINALG_DETAIL::access( z, i ) ), ( LINALG_DETAIL::access( r, i ) / ( 3.0 + static_cast< double >( i ) ) ), 1e-15 );
+    }
+
+    // A zero on the diagonal, and a matrix which is not square
+    LINALG_DETAIL::access( matrix, 2, 2 ) = 0.0;
+    EXPECT_THROW( static_cast< void >( LINALG::make_jacobi_preconditioner( matrix ) ), ::std::domain_error );
+    LINALG::dyn_matrix< double > wide { ::std::extents< ::std::size_t, 2, 3 >() };
+    EXPECT_THROW( static_cast< void >( LINALG::make_ilu0_preconditioner( wide ) ), ::std::length_error );
+  }
+
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+
+namespace
+{
+
+  TEST( LOW_PRECISION, BFLOAT16_CONVERSION )
+  {
+    // Exactly representable values round trip
+    EXPECT_EQ( ( static_cast< float >( LINALG::bfloat16_t( 1.0f ) ) ), 1.0f );
+    EXPECT_EQ( ( static_cast< float >( LINALG::bfloat16_t( -3.5f ) ) ), -3.5f );
+    EXPECT_EQ( ( LINALG::bfloat16_t( 1.0f ).bits() ), 0x3F80u );
+    // Ties round to even
+    EXPECT_EQ( ( LINALG::bfloat16_t( LINALG_DETAIL::bit_cast< float >( 0x3F808000u ) ).bits() ), 0x3F80u );
+    EXPECT_EQ( ( LINALG::bfloat16_t( LINALG_DETAIL::bit_cast< float >( 0x3F818000u ) ).bits() ), 0x3F82u );
+    #ifdef __cpp_lib_bit_cast
+    // Usable in constant expressions
+    static_assert( static_cast< float >( LINALG::bfloat16_t( 2.0f ) ) == 2.0f );
+    #endif
+    static_assert( sizeof( LINALG::bfloat16_t ) == 2 );
+  }
+
+  TEST( LOW_PRECISION, FLOAT16_CONVERSION )
+  {
+    // Exactly representable values round trip
+    EXPECT_EQ( ( LINALG::float16_t( 1.0f ).bits() ), 0x3C00u );
+    EXPECT_EQ( ( static_cast< float >( LINALG::float16_t( -2.25f ) ) ), -2.25f );
+    EXPECT_EQ( ( static_cast< float >( LINALG::float16_t( 65504.0f ) ) ), 65504.0f );
+    // Subnormals
+    EXPECT_EQ( ( LINALG::float16_t( 5.9604645e-8f ).bits() ), 0x0001u );
+    EXPECT_EQ( ( static_cast< float >( LINALG::float16_t::from_bits( 0x0001u ) ) ), 5.9604645e-8f );
+    // Overflow saturates to infinity
+    EXPECT_EQ( ( LINALG::float16_t( 1.0e6f ).bits() ), 0x7C00u );
+    EXPECT_EQ( ( LINALG::float16_t( -1.0e6f ).bits() ), 0xFC00u );
+    // Ties round to even
+    EXPECT_EQ( ( LINALG::float16_t( 1.0f + 0.00048828125f ).bits() ), 0x3C00u );
+    static_assert( sizeof( LINALG::float16_t ) == 2 );
+  }
+
+  TEST( LOW_PRECISION, TENSOR_EXPRESSIONS )
+  {
+    using matrix_type = LINALG::fs_matrix< LINALG::bfloat16_t, 2, 2 >;
+    // Construct
+    matrix_type a { };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( a, 0, 0 ) = 1.0f;
+    LINALG_DETAIL::access( a, 0, 1 ) = 2.0f;
+    LINALG_DETAIL::access( a, 1, 0 ) = 3.0f;
+    LINALG_DETAIL::access( a, 1, 1 ) = 4.0f;
+    // Expressions compute in float
+    auto sum     = a + a;
+    auto product = a * a;
+    static_assert( ::std::is_same_v< typename decltype( product )::value_type, float > );
+    EXPECT_EQ( ( LINALG_DETAIL::access( sum, 0, 1 ) ), 4.0f );
+    EXPECT_EQ( ( LINALG_DETAIL::access( product, 0, 0 ) ), 7.0f );
+    EXPECT_EQ( ( LINALG_DETAIL::access( product, 1, 1 ) ), 22.0f );
+    // Assign back to narrow storage
+    matrix_type b { };
+    b = a * a;
+    EXPECT_EQ( ( static_cast< float >( LINALG_DETAIL::access( b, 1, 0 ) ) ), 15.0f );
+  }
+
+  TEST( LOW_PRECISION, BULK_CONVERSION )
+  {
+    // Construct
+    LINALG::dyn_vector< float >              wide       { 17 };
+    LINALG::dyn_vector< LINALG::float16_t >  narrow     { 17 };
+    LINALG::dyn_vector< LINALG::bfloat16_t > brain      { 17 };
+    LINALG::dyn_vector< float >              round_trip { 17 };
+    // Populate via mutable index access
+    for ( ::std::size_t i = 0; i < 17; ++i )
+    {
+      LINALG_DETAIL::access( wide, i ) = 0.5f * static_cast< float >( i ) - 4.0f;
+    }
+    // Convert to narrow storage and back
+    LINALG::convert( wide, narrow );
+    LINALG::convert( narrow, round_trip );
+    for ( ::std::size_t i = 0; i < 17; ++i )
+    {
+      EXPECT_EQ( ( LINALG_DETAIL::access( round_trip, i ) ), ( LINALG_DETAIL::access( wide, i ) ) );
+    }
+    LINALG::convert( wide, brain );
+    LINALG::convert( brain, round_trip );
+    for ( ::std::size_t i = 0; i < 17; ++i )
+    {
+      EXPECT_EQ( ( LINALG_DETAIL::access( round_trip, i ) ), ( LINALG_DETAIL::access( wide, i ) ) );
+    }
+    // Check mismatched extents throw
+    LINALG::dyn_vector< float > other { 3 };
+    EXPECT_THROW( ( LINALG::convert( wide, other ) ), ::std::length_error );
+  }
+
+}
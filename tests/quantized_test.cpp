@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+
+namespace
+{
+
+  TEST( QUANTIZED, PER_TENSOR )
+  {
+    // Construct
+    LINALG::dyn_matrix< float >         matrix    { ::std::extents< ::std::size_t, 2, 2 >() };
+    LINALG::dyn_matrix< ::std::int8_t > quantized { ::std::extents< ::std::size_t, 2, 2 >() };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix, 0, 0 ) = -1.0f;
+    LINALG_DETAIL::access( matrix, 0, 1 ) = 0.5f;
+    LINALG_DETAIL::access( matrix, 1, 0 ) = 1.0f;
+    LINALG_DETAIL::access( matrix, 1, 1 ) = 200.0f;
+    // Quantize
+    const LINALG::quantization_parameters< float > params { 0.5f, 2 };
+    LINALG::quantize( matrix, params, quantized );
+    EXPECT_EQ( ( LINALG_DETAIL::access( quantized, 0, 0 ) ), 0 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( quantized, 0, 1 ) ), 3 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( quantized, 1, 0 ) ), 4 );
+    // Saturates
+    EXPECT_EQ( ( LINALG_DETAIL::access( quantized, 1, 1 ) ), 127 );
+    // Dequantize on access
+    auto view = LINALG::dequantized( quantized, params );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 0, 0 ) ), -1.0f );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 0, 1 ) ), 0.5f );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 1, 0 ) ), 1.0f );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 1, 1 ) ), 62.5f );
+    // Use in expressions
+    auto sum = view + view;
+    EXPECT_EQ( ( LINALG_DETAIL::access( sum, 0, 1 ) ), 1.0f );
+  }
+
+  TEST( QUANTIZED, PER_AXIS )
+  {
+    // Construct
+    LINALG::dyn_matrix< float >         matrix    { ::std::extents< ::std::size_t, 2, 2 >() };
+    LINALG::dyn_matrix< ::std::int8_t > quantized { ::std::extents< ::std::size_t, 2, 2 >() };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix, 0, 0 ) = 1.0f;
+    LINALG_DETAIL::access( matrix, 0, 1 ) = -1.0f;
+    LINALG_DETAIL::access( matrix, 1, 0 ) = 0.5f;
+    LINALG_DETAIL::access( matrix, 1, 1 ) = 0.25f;
+    // Quantize each row with its own scale
+    const LINALG::quantization_parameters< float > params { { 0.5f, 0.25f }, { 0, 1 }, 0 };
+    LINALG::quantize( matrix, params, quantized );
+    EXPECT_EQ( ( LINALG_DETAIL::access( quantized, 0, 0 ) ), 2 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( quantized, 0, 1 ) ), -2 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( quantized, 1, 0 ) ), 3 );
+    EXPECT_EQ( ( LINALG_DETAIL::access( quantized, 1, 1 ) ), 2 );
+    // Dequantize on access
+    auto view = LINALG::dequantized( quantized, params );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 0, 1 ) ), -1.0f );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 1, 0 ) ), 0.5f );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 1, 1 ) ), 0.25f );
+    // Check mismatched parameter sizes throw
+    const LINALG::quantization_parameters< float > bad_params { { 0.5f, 0.25f, 1.0f }, { 0, 0, 0 }, 0 };
+    EXPECT_THROW( ( LINALG::quantize( matrix, bad_params, quantized ) ), ::std::length_error );
+  }
+
+  TEST( QUANTIZED, PER_AXIS_PADDED )
+  {
+    // Construct
+    LINALG::dyn_matrix< float >         matrix    { ::std::extents< ::std::size_t, 3, 3 >() };
+    LINALG::dyn_matrix< ::std::int8_t > quantized { ::std::extents< ::std::size_t, 3, 4 >() };
+    // Shrink within capacity so rows are padded
+    quantized.resize( ::std::extents< ::std::size_t, 3, 3 >() );
+    EXPECT_EQ( quantized.stride(0), 4 );
+    // Populate via mutable index access
+    for ( ::std::size_t i = 0; i < 3; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 3; ++j )
+      {
+        LINALG_DETAIL::access( matrix, i, j ) = static_cast< float >( i + 1 ) * static_cast< float >( j + 1 );
+      }
+    }
+    // Each column, then each row, with its own scale
+    for ( ::std::size_t axis : { 0, 1 } )
+    {
+      const LINALG::quantization_parameters< float > params { { 0.5f, 0.25f, 0.125f }, { 1, 0, -1 }, axis };
+      LINALG::quantize( matrix, params, quantized );
+      auto view = LINALG::dequantized( quantized, params );
+      for ( ::std::size_t i = 0; i < 3; ++i )
+      {
+        for ( ::std::size_t j = 0; j < 3; ++j )
+        {
+          EXPECT_EQ( ( LINALG_DETAIL::access( view, i, j ) ), ( LINALG_DETAIL::access( matrix, i, j ) ) );
+        }
+      }
+    }
+  }
+
+  TEST( QUANTIZED, MATRIX_PRODUCT )
+  {
+    // Construct
+    LINALG::dyn_matrix< float >         matrix_a { ::std::extents< ::std::size_t, 2, 3 >() };
+    LINALG::dyn_matrix< float >         matrix_b { ::std::extents< ::std::size_t, 3, 2 >() };
+    LINALG::dyn_matrix< ::std::int8_t > quantized_a { ::std::extents< ::std::size_t, 2, 3 >() };
+    LINALG::dyn_matrix< ::std::int8_t > quantized_b { ::std::extents< ::std::size_t, 3, 2 >() };
+    LINALG::dyn_matrix< ::std::int8_t > quantized_c { ::std::extents< ::std::size_t, 2, 2 >() };
+    // Populate via mutable index access
+    LINALG_DETAIL::access( matrix_a, 0, 0 ) = 1.0f;
+    LINALG_DETAIL::access( matrix_a, 0, 1 ) = 0.5f;
+    LINALG_DETAIL::access( matrix_a, 0, 2 ) = -1.0f;
+    LINALG_DETAIL::access( matrix_a, 1, 0 ) = 2.0f;
+    LINALG_DETAIL::access( matrix_a, 1, 1 ) = 0.0f;
+    LINALG_DETAIL::access( matrix_a, 1, 2 ) = 1.5f;
+    LINALG_DETAIL::access( matrix_b, 0, 0 ) = 0.25f;
+    LINALG_DETAIL::access( matrix_b, 0, 1 ) = -0.5f;
+    LINALG_DETAIL::access( matrix_b, 1, 0 ) = 1.0f;
+    LINALG_DETAIL::access( matrix_b, 1, 1 ) = 0.75f;
+    LINALG_DETAIL::access( matrix_b, 2, 0 ) = -0.25f;
+    LINALG_DETAIL::access( matrix_b, 2, 1 ) = 0.5f;
+    // Quantize with nonzero zero points
+    const LINALG::quantization_parameters< float > a_params { 0.5f, 1 };
+    const LINALG::quantization_parameters< float > b_params { 0.25f, -2 };
+    const LINALG::quantization_parameters< float > c_params { 0.125f, 3 };
+    LINALG::quantize( matrix_a, a_params, quantized_a );
+    LINALG::quantize( matrix_b, b_params, quantized_b );
+    // Multiply
+    LINALG::quantized_matrix_product( quantized_a, a_params, quantized_b, b_params, quantized_c, c_params );
+    // Check against the real product, which is exactly representable here
+    auto view = LINALG::dequantized( quantized_c, c_params );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 0, 0 ) ), 1.0f );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 0, 1 ) ), -0.625f );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 1, 0 ) ), 0.125f );
+    EXPECT_EQ( ( LINALG_DETAIL::access( view, 1, 1 ) ), -0.25f );
+    // Check mismatched extents throw
+    EXPECT_THROW( ( LINALG::quantized_matrix_product( quantized_a, a_params, quantized_a, b_params, quantized_c, c_params ) ), ::std::length_error );
+  }
+
+  TEST( QUANTIZED, MATRIX_PRODUCT_LONG_INNER_EXTENT )
+  {
+    // The longest inner extent whose dot products of int8 values are exact in 32 bits, 2^31 / 128^2 - 1
+    constexpr ::std::size_t inner = 131071;
+    LINALG::dyn_matrix< ::std::int8_t > quantized_a { ::std::extents< ::std::size_t, 1, inner >() };
+    LINALG::dyn_matrix< ::std::int8_t > quantized_b { ::std::extents< ::std::size_t, inner, 1 >() };
+    LINALG::dyn_matrix< ::std::int8_t > quantized_c { ::std::extents< ::std::size_t, 1, 1 >() };
+    for ( ::std::size_t k = 0; k < inner; ++k )
+    {
+      LINALG_DETAIL::access( quantized_a, 0, k ) = -128;
+      LINALG_DETAIL::access( quantized_b, k, 0 ) = -128;
+    }
+    // Each term is ( -128 - 127 )^2, and the zero point correction alone does not fit in 32 bits
+    const LINALG::quantization_parameters< double > a_params { 1.0, 127 };
+    const LINALG::quantization_parameters< double > b_params { 1.0, 127 };
+    const LINALG::quantization_parameters< double > c_params { 67108864.0, 0 };
+    LINALG::quantized_matrix_product( quantized_a, a_params, quantized_b, b_params, quantized_c, c_params );
+    // 131071 * 65025 / 2^26 rounds to 127
+    EXPECT_EQ( ( LINALG_DETAIL::access( quantized_c, 0, 0 ) ), 127 );
+    // One more element could overflow the dot products
+    LINALG::dyn_matrix< ::std::int8_t > longer_a { ::std::extents< ::std::size_t, 1, inner + 1 >() };
+    LINALG::dyn_matrix< ::std::int8_t > longer_b { ::std::extents< ::std::size_t, inner + 1, 1 >() };
+    EXPECT_THROW( ( LINALG::quantized_matrix_product( longer_a, a_params, longer_b, b_params, quantized_c, c_params ) ), ::std::length_error );
+  }
+
+}
@@ -0,0 +1,561 @@
+#include <gtest/gtest.h>
+#include <experimental/linear_algebra.hpp>
+
+namespace
+{
+
+  TEST( SPECTRAL, SYMMETRIC_EIGEN )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Symmetric matrix large enough to be divided more than once, with a repeated eigenvalue block
+    constexpr ::std::size_t n = 150;
+    matrix_type matrix { ::std::extents< ::std::size_t, n, n >() };
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j <= i; ++j )
+      {
+        const double value = ( i < 20 ) ? ( ( i == j ) ? 3.0 : 0.0 ) : static_cast< double >( ( i * 7 + j * 3 ) % 11 ) - 5.0;
+        LINALG_DETAIL::access( matrix, i, j ) = value;
+        LINALG_DETAIL::access( matrix, j, i ) = value;
+      }
+    }
+    const auto  eigen   = LINALG::symmetric_eigen( matrix );
+    const auto& values  = eigen.values();
+    const auto& vectors = eigen.vectors();
+    for ( ::std::size_t k = 0; k < n; ++k )
+    {
+      if ( k > 0 )
+      {
+        EXPECT_LE( ( LINALG_DETAIL::access( values, k - 1 ) ), ( LINALG_DETAIL::access( values, k ) ) );
+      }
+      // A v = lambda v
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        double sum = 0.0;
+        for ( ::std::size_t j = 0; j < n; ++j )
+        {
+          sum += LINALG_DETAIL::access( matrix, i, j ) * LINALG_DETAIL::access( vectors, j, k );
+        }
+        EXPECT_NEAR( sum, ( LINALG_DETAIL::access( values, k ) * LINALG_DETAIL::access( vectors, i, k ) ), 1e-10 );
+      }
+      // V^T V = I
+      for ( ::std::size_t l = 0; l <= k; ++l )
+      {
+        double dot = 0.0;
+        for ( ::std::size_t i = 0; i < n; ++i )
+        {
+          dot += LINALG_DETAIL::access( vectors, i, k ) * LINALG_DETAIL::access( vectors, i, l );
+        }
+        EXPECT_NEAR( dot, ( ( k == l ) ? 1.0 : 0.0 ), 1e-12 );
+      }
+    }
+    // The eigenvalues only path agrees
+    const auto only = LINALG::symmetric_eigenvalues( matrix );
+    for ( ::std::size_t k = 0; k < n; ++k )
+    {
+      EXPECT_NEAR( ( LINALG_DETAIL::access( only, k ) ), ( LINALG_DETAIL::access( values, k ) ), 1e-10 );
+    }
+    // Not square
+    matrix_type wide { ::std::extents< ::std::size_t, 2, 3 >() };
+    EXPECT_THROW( static_cast< void >( LINALG::symmetric_eigen( wide ) ), ::std::length_error );
+  }
+
+  TEST( SPECTRAL, SMALL_SYMMETRIC_EIGEN )
+  {
+    using matrix_type = LINALG::fs_matrix< double, 3, 3 >;
+    // Eigenvalues 2, 2 and 4
+    matrix_type matrix { 2.0, 0.0, 0.0,
+                         0.0, 3.0, 1.0,
+                         0.0, 1.0, 3.0 };
+    const auto eigen = LINALG::symmetric_eigen( matrix );
+    EXPECT_NEAR( ( LINALG_DETAIL::access( eigen.values(), 0 ) ), 2.0, 1e-14 );
+    EXPECT_NEAR( ( LINALG_DETAIL::access( eigen.values(), 1 ) ), 2.0, 1e-14 );
+    EXPECT_NEAR( ( LINALG_DETAIL::access( eigen.values(), 2 ) ), 4.0, 1e-14 );
+    for ( ::std::size_t k = 0; k < 3; ++k )
+    {
+      for ( ::std::size_t i = 0; i < 3; ++i )
+      {
+        double sum = 0.0;
+        for ( ::std::size_t j = 0; j < 3; ++j )
+        {
+          sum += LINALG_DETAIL::access( matrix, i, j ) * LINALG_DETAIL::access( eigen.vectors(), j, k );
+        }
+        EXPECT_NEAR( sum, ( LINALG_DETAIL::access( eigen.values(), k ) * LINALG_DETAIL::access( eigen.vectors(), i, k ) ), 1e-14 );
+      }
+    }
+    // Rotations which cannot converge report it rather than returning the last sweep
+    LINALG_DETAIL::access( matrix, 1, 2 ) = LINALG_DETAIL::access( matrix, 2, 1 ) = ::std::numeric_limits< double >::quiet_NaN();
+    EXPECT_THROW( static_cast< void >( LINALG::symmetric_eigen( matrix ) ), ::std::domain_error );
+  }
+
+  TEST( SPECTRAL, SVD )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Tall matrix large enough to be divided more than once, with its last columns repeating the first
+    constexpr ::std::size_t m = 120;
+    constexpr ::std::size_t n = 80;
+    matrix_type matrix { ::std::extents< ::std::size_t, m, n >() };
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        const ::std::size_t k = ( j < 70 ) ? j : j - 70;
+        LINALG_DETAIL::access( matrix, i, j ) = static_cast< double >( ( i * i * 31 + k * k * 17 + i * k * 7 + i * 3 + k ) % 101 ) / 50.0 - 1.0;
+      }
+    }
+    for ( const auto method : { LINALG::svd_method::divide_and_conquer, LINALG::svd_method::jacobi } )
+    {
+      for ( const auto mode : { LINALG::svd_mode::thin, LINALG::svd_mode::full } )
+      {
+        const auto          decomposition = LINALG::svd( matrix, mode, method );
+        const auto&         values        = decomposition.values();
+        const auto&         u             = decomposition.u();
+        const auto&         v             = decomposition.v();
+        const ::std::size_t vectors       = ( mode == LINALG::svd_mode::thin ) ? n : m;
+        EXPECT_EQ( ( static_cast< ::std::size_t >( u.extent(1) ) ), vectors );
+        EXPECT_EQ( decomposition.rank(), 70 );
+        for ( ::std::size_t k = 1; k < n; ++k )
+        {
+          EXPECT_LE( ( LINALG_DETAIL::access( values, k ) ), ( LINALG_DETAIL::access( values, k - 1 ) ) );
+        }
+        // A = U S V^T
+        for ( ::std::size_t i = 0; i < m; ++i )
+        {
+          for ( ::std::size_t j = 0; j < n; ++j )
+          {
+            double sum = 0.0;
+            for ( ::std::size_t k = 0; k < n; ++k )
+            {
+              sum += LINALG_DETAIL::access( u, i, k ) * LINALG_DETAIL::access( values, k ) * LINALG_DETAIL::access( v, j, k );
+            }
+            EXPECT_NEAR( sum, ( LINALG_DETAIL::access( matrix, i, j ) ), 1e-10 );
+          }
+        }
+        // U^T U = I and V^T V = I
+        for ( ::std::size_t k = 0; k < vectors; ++k )
+        {
+          for ( ::std::size_t l = 0; l <= k; ++l )
+          {
+            double dot = 0.0;
+            for ( ::std::size_t i = 0; i < m; ++i )
+            {
+              dot += LINALG_DETAIL::access( u, i, k ) * LINALG_DETAIL::access( u, i, l );
+            }
+            EXPECT_NEAR( dot, ( ( k == l ) ? 1.0 : 0.0 ), 1e-12 );
+          }
+        }
+        for ( ::std::size_t k = 0; k < n; ++k )
+        {
+          for ( ::std::size_t l = 0; l <= k; ++l )
+          {
+            double dot = 0.0;
+            for ( ::std::size_t i = 0; i < n; ++i )
+            {
+              dot += LINALG_DETAIL::access( v, i, k ) * LINALG_DETAIL::access( v, i, l );
+            }
+            EXPECT_NEAR( dot, ( ( k == l ) ? 1.0 : 0.0 ), 1e-12 );
+          }
+        }
+      }
+    }
+    // The singular values only path agrees
+    const auto decomposition = LINALG::svd( matrix );
+    const auto only          = LINALG::singular_values( matrix );
+    for ( ::std::size_t k = 0; k < n; ++k )
+    {
+      EXPECT_NEAR( ( LINALG_DETAIL::access( only, k ) ), ( LINALG_DETAIL::access( decomposition.values(), k ) ), 1e-10 );
+    }
+    // A A+ A = A for the rank deficient matrix
+    const auto inverse = LINALG::pinv( matrix );
+    matrix_type product { ::std::extents< ::std::size_t, m, m >() };
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t j = 0; j < m; ++j )
+      {
+        double sum = 0.0;
+        for ( ::std::size_t k = 0; k < n; ++k )
+        {
+          sum += LINALG_DETAIL::access( matrix, i, k ) * LINALG_DETAIL::access( inverse, k, j );
+        }
+        LINALG_DETAIL::access( product, i, j ) = sum;
+      }
+    }
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        double sum = 0.0;
+        for ( ::std::size_t k = 0; k < m; ++k )
+        {
+          sum += LINALG_DETAIL::access( product, i, k ) * LINALG_DETAIL::access( matrix, k, j );
+        }
+        EXPECT_NEAR( sum, ( LINALG_DETAIL::access( matrix, i, j ) ), 1e-9 );
+      }
+    }
+    // The best approximation of its rank is the matrix itself
+    const auto approximation = LINALG::low_rank_approximation( matrix, 70 );
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        EXPECT_NEAR( ( LINALG_DETAIL::access( approximation, i, j ) ), ( LINALG_DETAIL::access( matrix, i, j ) ), 1e-10 );
+      }
+    }
+  }
+
+  TEST( SPECTRAL, WIDE_SVD )
+  {
+    using matrix_type = LINALG::fs_matrix< double, 2, 3 >;
+    // Singular values 3 and 2
+    matrix_type matrix { 3.0, 0.0, 0.0,
+                         0.0, 0.0, 2.0 };
+    const auto decomposition = LINALG::svd( matrix );
+    EXPECT_NEAR( ( LINALG_DETAIL::access( decomposition.values(), 0 ) ), 3.0, 1e-14 );
+    EXPECT_NEAR( ( LINALG_DETAIL::access( decomposition.values(), 1 ) ), 2.0, 1e-14 );
+    EXPECT_EQ( ( decomposition.v().extent(0) ), 3 );
+    const auto reconstructed = decomposition.reconstruct();
+    for ( ::std::size_t i = 0; i < 2; ++i )
+    {
+      for ( ::std::size_t j = 0; j < 3; ++j )
+      {
+        EXPECT_NEAR( ( LINALG_DETAIL::access( reconstructed, i, j ) ), ( LINALG_DETAIL::access( matrix, i, j ) ), 1e-14 );
+      }
+    }
+  }
+
+  TEST( SPECTRAL, RANK_DEFICIENT_VALUES )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // X X^T and X Y^T of rank 3 leave clusters of zero eigenvalues and singular values for the value only paths
+    constexpr ::std::size_t n    = 100;
+    constexpr ::std::size_t rank = 3;
+    matrix_type gram { ::std::extents< ::std::size_t, n, n >() };
+    matrix_type outer { ::std::extents< ::std::size_t, n, n - 20 >() };
+    for ( ::std::size_t i = 0; i < n; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        double symmetric = 0.0;
+        double product   = 0.0;
+        for ( ::std::size_t k = 1; k <= rank; ++k )
+        {
+          symmetric += ::std::sin( 1.0 + 0.37 * static_cast< double >( i * k ) ) * ::std::sin( 1.0 + 0.37 * static_cast< double >( j * k ) );
+          product   += ::std::sin( 1.0 + 0.37 * static_cast< double >( i * k ) ) * ::std::cos( 0.3 + 0.11 * static_cast< double >( j * ( k + 1 ) ) );
+        }
+        LINALG_DETAIL::access( gram, i, j ) = symmetric;
+        if ( j < n - 20 )
+        {
+          LINALG_DETAIL::access( outer, i, j ) = product;
+        }
+      }
+    }
+    const auto eigenvalues = LINALG::symmetric_eigenvalues( gram );
+    const auto eigen       = LINALG::symmetric_eigen( gram );
+    for ( ::std::size_t k = 0; k < n; ++k )
+    {
+      EXPECT_NEAR( ( LINALG_DETAIL::access( eigenvalues, k ) ), ( LINALG_DETAIL::access( eigen.values(), k ) ), 1e-10 );
+      if ( k < n - rank )
+      {
+        EXPECT_NEAR( ( LINALG_DETAIL::access( eigenvalues, k ) ), 0.0, 1e-10 );
+      }
+    }
+    const auto values        = LINALG::singular_values( outer );
+    const auto decomposition = LINALG::svd( outer );
+    for ( ::std::size_t k = 0; k < n - 20; ++k )
+    {
+      EXPECT_NEAR( ( LINALG_DETAIL::access( values, k ) ), ( LINALG_DETAIL::access( decomposition.values(), k ) ), 1e-10 );
+      if ( k >= rank )
+      {
+        EXPECT_NEAR( ( LINALG_DETAIL::access( values, k ) ), 0.0, 1e-10 );
+      }
+    }
+  }
+
+  TEST( SPECTRAL, RANDOMIZED_SVD )
+  {
+    using matrix_type = LINALG::dyn_matrix< double >;
+    // Rank 8 matrix, the product of 400 x 8 and 8 x 300 factors
+    constexpr ::std::size_t m    = 400;
+    constexpr ::std::size_t n    = 300;
+    constexpr ::std::size_t rank = 8;
+    matrix_type matrix { ::std::extents< ::std::size_t, m, n >() };
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        double sum = 0.0;
+        for ( ::std::size_t k = 0; k < rank; ++k )
+        {
+          sum += ( static_cast< double >( ( i * 13 + k * k * 7 + i * k ) % 29 ) - 14.0 ) * ( static_cast< double >( ( j * 11 + k * 5 + j * k * 3 ) % 23 ) - 11.0 );
+        }
+        LINALG_DETAIL::access( matrix, i, j ) = sum / 100.0;
+      }
+    }
+    const auto exact         = LINALG::svd( matrix );
+    const auto decomposition = LINALG::randomized_svd( matrix, rank );
+    ASSERT_EQ( ( decomposition.values().extent(0) ), rank );
+    for ( ::std::size_t k = 0; k < rank; ++k )
+    {
+      EXPECT_NEAR( ( LINALG_DETAIL::access( decomposition.values(), k ) ), ( LINALG_DETAIL::access( exact.values(), k ) ), 1e-9 );
+    }
+    const auto reconstructed = decomposition.reconstruct();
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t j = 0; j < n; ++j )
+      {
+        EXPECT_NEAR( ( LINALG_DETAIL::access( reconstructed, i, j ) ), ( LINALG_DETAIL::access( matrix, i, j ) ), 1e-9 );
+      }
+    }
+    // Equal seeds give equal decompositions
+    const auto repeated = LINALG::randomized_svd( matrix, rank );
+    for ( ::std::size_t i = 0; i < m; ++i )
+    {
+      for ( ::std::size_t k = 0; k < rank; ++k )
+      {
+        EXPECT_EQ( ( LINALG_DETAIL::access( repeated.u(), i, k ) ), ( LINALG_DETAIL::access( decomposition.u(), i, k ) ) );
+      }
+    }
+    // The range basis is orthonormal and holds the columns of the matrix
+    const auto basis = LINALG::randomized_range( matrix, rank + 2, 1, 42 );
+    for ( ::std::size_t k = 0; k < rank + 2; ++k )
+    {
+      for ( ::std::size_t l = 0; l <= k; ++l )
+      {
+        double dot = 0.0;
+        for ( ::std::size_t i = 0; i < m; ++i )
+        {
+          dot += LINALG_DETAIL::access( basis, i, k ) * LINALG_DETAIL::access( basis, i, l );
+        }
+        EXPECT_NEAR( dot, ( ( k == l ) ? 1.0 : 0.0 ), 1e-12 );
+      }
+    }
+    for ( ::std::size_t j = 0; j < n; j += 37 )
+    {
+      ::std::vector< double > projection( rank + 2, 0.0 );
+      for ( ::std::size_t k = 0; k < rank + 2; ++k )
+      {
+        for ( ::std::size_t i = 0; i < m; ++i )
+        {
+          projection[k] += LINALG_DETAIL::access( basis, i, k ) * LINALG_DETAIL::access( matrix, i, j );
+        }
+      }
+      for ( ::std::size_t i = 0; i < m; ++i )
+      {
+        double sum = 0.0;
+        for ( ::std::size_t k = 0; k < rank + 2; ++k )
+        {
+          sum += LINALG_DETAIL::access( basis, i, k ) * projection[k];
+        }
+        EXPECT_NEAR( sum, ( LINALG_DETAIL::access( matrix, i, j ) ), 1e-9 );
+      }
+    }
+    // The same matrix known only through products with its factors
+    const auto left_factor  = []( ::std::size_t i, ::std::size_t k ) { return static_cast< double >( ( i * 13 + k * k * 7 + i * k ) % 29 ) - 14.0; };
+    const auto right_factor = []( ::std::size_t k, ::std::size_t j ) { return ( static_cast< double >( ( j * 11 + k * 5 + j * k * 3 ) % 23 ) - 11.0 ) / 100.0; };
+    const auto factored = LINALG::make_adjoint_linear_operator< double >( m, n,
+      [&]( const matrix_type& x, matrix_type& y )
+      {
+        for ( ::std::size_t c = 0; c < static_cast< ::std::size_t >( x.extent(1) ); ++c )
+        {
+          ::std::vector< double > inner( rank, 0.0 );
+          for ( ::std::size_t k = 0; k < rank; ++k )
+          {
+            for ( ::std::size_t j = 0; j < n; ++j )
+            {
+              inner[k] += right_factor( k, j ) * LINALG_DETAIL::access( x, j, c );
+            }
+          }
+          for ( ::std::size_t i = 0; i < m; ++i )
+          {
+            double sum = 0.0;
+            for ( ::std::size_t k = 0; k < rank; ++k )
+            {
+              sum += left_factor( i, k ) * inner[k];
+            }
+            LINALG_DETAIL::access( y, i, c ) = sum;
+          }
+        }
+      },
+      [&]( const matrix_type& y, matrix_type& x )
+      {
+        for ( ::std::size_t c = 0; c < static_cast< ::std::size_t >( y.extent(1) ); ++c )
+        {
+          ::std::vector< double > inner( rank, 0.0 );
+          for ( ::std::size_t k = 0; k < rank; ++k )
+          {
+            for ( ::std::size_t i = 0; i < m; ++i )
+            {
+              inner[k] += left_factor( i, k ) * LINALG_DETAIL::access( y, i, c );
+            }
+          }
+          for ( ::std::size_t j = 0; j < n; ++j )
+          {
+            double sum = 0.0;
+            for ( ::std::size_t k = 0; k < rank; ++k )
+            {
+              sum += right_factor( k, j ) * inner[k];
+            }
+            LINALG_DETAIL::access( x, j, c ) = sum;
+          }
+        }
+      } );
+    const auto matrix_free = LINALG::randomized_svd( factored, rank );
+    for ( ::std::size_t k = 0; k < rank; ++k )
+    {
+      EXPECT_NEAR( ( LINALG_DETAIL::access( matrix_free.values(), k ) ), ( LINALG_DETAIL::access( exact.values(), k ) ), 1e-9 );
+    }
+  }
+
+  TEST( SPECTRAL, LANCZOS_EIGEN )
+  {
+    using vector_type = LINALG::dyn_tensor< double, 1 >;
+    // Laplacian of the path graph on n vertices, with eigenvalues 4 sin^2( pi k / 2n )
+    constexpr ::std::size_t n     = 200;
+    constexpr ::std::size_t count = 4;
+    const auto laplacian = LINALG::make_linear_operator< double >( n, []( const vector_type& x, vector_type& y )
+    {
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        const double left  = ( i > 0 ) ? LINALG_DETAIL::access( x, i - 1 ) : LINALG_DETAIL::access( x, i );
+        const double right = ( i + 1 < n ) ? LINALG_DETAIL::access( x, i + 1 ) : LINALG_DETAIL::access( x, i );
+        LINALG_DETAIL::access( y, i ) = 2.0 * LINALG_DETAIL::access( x, i ) - left - right;
+      }
+    } );
+    const double pi = ::std::acos( -1.0 );
+    for ( const auto target : { LINALG::eigen_target::smallest, LINALG::eigen_target::largest } )
+    {
+      // Residuals below 1e-13 bound the error of each eigenvalue by the same
+      const auto eigen = LINALG::lanczos_eigen( laplacian, count, target, 1e-13 );
+      ASSERT_EQ( ( eigen.values().extent(0) ), count );
+      vector_type x { ::std::extents< ::std::size_t, n >() };
+      vector_type y { ::std::extents< ::std::size_t, n >() };
+      for ( ::std::size_t k = 0; k < count; ++k )
+      {
+        const ::std::size_t index = ( target == LINALG::eigen_target::smallest ) ? k : n - count + k;
+        const double        exact = 4.0 * ::std::pow( ::std::sin( pi * static_cast< double >( index ) / ( 2.0 * n ) ), 2 );
+        EXPECT_NEAR( ( LINALG_DETAIL::access( eigen.values(), k ) ), exact, 1e-12 );
+        // A v = lambda v
+        for ( ::std::size_t i = 0; i < n; ++i )
+        {
+          LINALG_DETAIL::access( x, i ) = LINALG_DETAIL::access( eigen.vectors(), i, k );
+        }
+        laplacian.apply( x, y );
+        for ( ::std::size_t i = 0; i < n; ++i )
+        {
+          EXPECT_NEAR( ( LINALG_DETAIL::access( y, i ) ), ( LINALG_DETAIL::access( eigen.values(), k ) * LINALG_DETAIL::access( x, i ) ), 1e-7 );
+        }
+      }
+    }
+  }
+
+  TEST( SPECTRAL, LANCZOS_EIGEN_WHOLE_SPECTRUM )
+  {
+    using vector_type = LINALG::dyn_tensor< double, 1 >;
+    // The basis would span the whole space of the path graph Laplacian, whether all its eigenpairs are wanted or two
+    constexpr ::std::size_t n = 6;
+    const auto laplacian = LINALG::make_linear_operator< double >( n, []( const vector_type& x, vector_type& y )
+    {
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        const double left  = ( i > 0 ) ? LINALG_DETAIL::access( x, i - 1 ) : LINALG_DETAIL::access( x, i );
+        const double right = ( i + 1 < n ) ? LINALG_DETAIL::access( x, i + 1 ) : LINALG_DETAIL::access( x, i );
+        LINALG_DETAIL::access( y, i ) = 2.0 * LINALG_DETAIL::access( x, i ) - left - right;
+      }
+    } );
+    const double pi = ::std::acos( -1.0 );
+    for ( const ::std::size_t count : { n, ::std::size_t( 2 ) } )
+    {
+      for ( const auto target : { LINALG::eigen_target::smallest, LINALG::eigen_target::largest } )
+      {
+        const auto eigen = LINALG::lanczos_eigen( laplacian, count, target );
+        ASSERT_EQ( ( eigen.values().extent(0) ), count );
+        const ::std::size_t first = ( target == LINALG::eigen_target::smallest ) ? 0 : n - count;
+        vector_type x { ::std::extents< ::std::size_t, n >() };
+        vector_type y { ::std::extents< ::std::size_t, n >() };
+        for ( ::std::size_t k = 0; k < count; ++k )
+        {
+          const double exact = 4.0 * ::std::pow( ::std::sin( pi * static_cast< double >( first + k ) / ( 2.0 * n ) ), 2 );
+          EXPECT_NEAR( ( LINALG_DETAIL::access( eigen.values(), k ) ), exact, 1e-12 );
+          for ( ::std::size_t i = 0; i < n; ++i )
+          {
+            LINALG_DETAIL::access( x, i ) = LINALG_DETAIL::access( eigen.vectors(), i, k );
+          }
+          laplacian.apply( x, y );
+          for ( ::std::size_t i = 0; i < n; ++i )
+          {
+            EXPECT_NEAR( ( LINALG_DETAIL::access( y, i ) ), ( LINALG_DETAIL::access( eigen.values(), k ) * LINALG_DETAIL::access( x, i ) ), 1e-12 );
+          }
+        }
+      }
+    }
+  }
+
+  TEST( SPECTRAL, LOBPCG_EIGEN )
+  {
+    using vector_type = LINALG::dyn_tensor< double, 1 >;
+    // Laplacian of the g x g grid graph, with eigenvalues 4 sin^2( pi a / 2g ) + 4 sin^2( pi b / 2g ), most of them double
+    constexpr ::std::size_t g     = 12;
+    constexpr ::std::size_t n     = g * g;
+    constexpr ::std::size_t count = 6;
+    const auto laplacian = LINALG::make_linear_operator< double >( n, []( const vector_type& x, vector_type& y )
+    {
+      for ( ::std::size_t i = 0; i < n; ++i )
+      {
+        const ::std::size_t row    = i / g;
+        const ::std::size_t column = i % g;
+        double              sum    = 0.0;
+        for ( const ::std::size_t j : { ( row > 0 ) ? i - g : i, ( row + 1 < g ) ? i + g : i, ( column > 0 ) ? i - 1 : i, ( column + 1 < g ) ? i + 1 : i } )
+        {
+          sum += LINALG_DETAIL::access( x, i ) - LINALG_DETAIL::access( x, j );
+        }
+        LINALG_DETAIL::access( y, i ) = sum;
+      }
+    } );
+    const double            pi = ::std::acos( -1.0 );
+    ::std::vector< double > exact;
+    for ( ::std::size_t a = 0; a < g; ++a )
+    {
+      for ( ::std::size_t b = 0; b < g; ++b )
+      {
+        exact.push_back( 4.0 * ::std::pow( ::std::sin( pi * static_cast< double >( a ) / ( 2.0 * g ) ), 2 ) +
+                         4.0 * ::std::pow( ::std::sin( pi * static_cast< double >( b ) / ( 2.0 * g ) ), 2 ) );
+      }
+    }
+    ::std::sort( exact.begin(), exact.end() );
+    const auto eigen = LINALG::lobpcg_eigen( laplacian, count, LINALG::eigen_target::smallest );
+    for ( ::std::size_t k = 0; k < count; ++k )
+    {
+      EXPECT_NEAR( ( LINALG_DETAIL::access( eigen.values(), k ) ), exact[k], 1e-12 );
+      // V^T V = I, so both eigenvectors of each double eigenvalue are found
+      for ( ::std::size_t l = 0; l <= k; ++l )
+      {
+        double dot = 0.0;
+        for ( ::std::size_t i = 0; i < n; ++i )
+        {
+          dot += LINALG_DETAIL::access( eigen.vectors(), i, k ) * LINALG_DETAIL::access( eigen.vectors(), i, l );
+        }
+        EXPECT_NEAR( dot, ( ( k == l ) ? 1.0 : 0.0 ), 1e-12 );
+      }
+    }
+    // A matrix is applied as a linear operator, and both solvers agree with the dense one
+    using matrix_type = LINALG::dyn_matrix< double >;
+    constexpr ::std::size_t order = 60;
+    matrix_type matrix { ::std::extents< ::std::size_t, order, order >() };
+    for ( ::std::size_t i = 0; i < order; ++i )
+    {
+      for ( ::std::size_t j = 0; j < order; ++j )
+      {
+        LINALG_DETAIL::access( matrix, i, j ) = ( i == j ) ? static_cast< double >( i + 1 ) : 0.01 * static_cast< double >( ( i * j ) % 7 );
+      }
+    }
+    const auto dense   = LINALG::symmetric_eigenvalues( matrix );
+    const auto lanczos = LINALG::lanczos_eigen( matrix, 3 );
+    const auto lobpcg  = LINALG::lobpcg_eigen( matrix, 3 );
+    for ( ::std::size_t k = 0; k < 3; ++k )
+    {
+      EXPECT_NEAR( ( LINALG_DETAIL::access( lanczos.values(), k ) ), ( LINALG_DETAIL::access( dense, order - 3 + k ) ), 1e-10 );
+      EXPECT_NEAR( ( LINALG_DETAIL::access( lobpcg.values(), k ) ), ( LINALG_DETAIL::access( dense, order - 3 + k ) ), 1e-10 );
+    }
+  }
+
+}
@@ -270,22 +270,14 @@ namespace
     // Conjugate the tensor
     auto conjugate_tensor = conj( tensor, 0, 2 );
     // Access elements from const tensor
-    auto real_val1 = LINALG_DETAIL::access( conjugate_tensor, 0, 0, 0 ).real();
-    auto real_val2 = LINALG_DETAIL::access( conjugate_tensor, 0, 0, 1 ).real();
-    auto real_val3 = LINALG_DETAIL::access( conjugate_tensor, 0, 1, 0 ).real();
-    auto real_val4 = LINALG_DETAIL::access( conjugate_tensor, 0, 1, 1 ).real();
-    auto real_val5 = LINALG_DETAIL::access( conjugate_tensor, 1, 0, 0 ).real();
-    auto real_val6 = LINALG_DETAIL::access( conjugate_tensor, 1, 0, 1 ).real();
-    auto real_val7 = LINALG_DETAIL::access( conjugate_tensor, 1, 1, 0 ).real();
-    auto real_val8 = LINALG_DETAIL::access( conjugate_tensor, 1, 1, 1 ).real();
-    auto imag_val1 = LINALG_DETAIL::access( conjugate_tensor, 0, 0, 0 ).imag();
-    auto imag_val2 = LINALG_DETAIL::access( conjugate_tensor, 0, 0, 1 ).imag();
-    auto imag_val3 = LINALG_DETAIL::access( conjugate_tensor, 0, 1, 0 ).imag();
-    auto imag_val4 = LINALG_DETAIL::access( conjugate_tensor, 0, 1, 1 ).imag();
-    auto imag_val5 = LINALG_DETAIL::access( conjugate_tensor, 1, 0, 0 ).imag();
-    auto imag_val6 = LINALG_DETAIL::access( conjugate_tensor, 1, 0, 1 ).imag();
-    auto imag_val7 = LINALG_DETAIL::access( conjugate_tensor, 1, 1, 0 ).imag();
-    auto imag_val8 = LINALG_DETAIL::access( conjugate_tensor, 1, 1, 1 ).imag();
+    auto real_val1 = LINALG_DETAIL::access( conjugate_tensor, 0, 0, 0 );
+    auto real_val2 = LINALG_DETAIL::access( conjugate_tensor, 0, 0, 1 );
+    auto real_val3 = LINALG_DETAIL::access( conjugate_tensor, 0, 1, 0 );
+    auto real_val4 = LINALG_DETAIL::access( conjugate_tensor, 0, 1, 1 );
+    auto real_val5 = LINALG_DETAIL::access( conjugate_tensor, 1, 0, 0 );
+    auto real_val6 = LINALG_DETAIL::access( conjugate_tensor, 1, 0, 1 );
+    auto real_val7 = LINALG_DETAIL::access( conjugate_tensor, 1, 1, 0 );
+    auto real_val8 = LINALG_DETAIL::access( conjugate_tensor, 1, 1, 1 );
     // Check the conjugate tensor provides the correct values
     EXPECT_EQ( real_val1, 1.0 );
     EXPECT_EQ( real_val2, 5.0 );
@@ -295,14 +287,8 @@ namespace
     EXPECT_EQ( real_val6, 6.0 );
     EXPECT_EQ( real_val7, 4.0 );
     EXPECT_EQ( real_val8, 8.0 );
-    EXPECT_EQ( imag_val1, 0.0 );
-    EXPECT_EQ( imag_val2, 0.0 );
-    EXPECT_EQ( imag_val3, 0.0 );
-    EXPECT_EQ( imag_val4, 0.0 );
-    EXPECT_EQ( imag_val5, 0.0 );
-    EXPECT_EQ( imag_val6, 0.0 );
-    EXPECT_EQ( imag_val7, 0.0 );
-    EXPECT_EQ( imag_val8, 0.0 );
+    // Check conjugation of real values does not promote them to complex
+    EXPECT_TRUE( ( ::std::is_same_v< decltype( real_val1 ), double > ) );
     // Check the extents
     EXPECT_EQ( ( conjugate_tensor.extent( 0 ) ), 2 );
     EXPECT_EQ( ( conjugate_tensor.extent( 1 ) ), 2 );
@@ -456,15 +442,13 @@ namespace
     // Conjugate the tensor
     auto conjugate_tensor = conj( subtensor );
     // Access elements from conj tensor
-    auto real_val1 = LINALG_DETAIL::access( conjugate_tensor, 0, 0 ).real();
-    auto imag_val1 = LINALG_DETAIL::access( conjugate_tensor, 0, 0 ).imag();
-    auto real_val2 = LINALG_DETAIL::access( conjugate_tensor, 0, 1 ).real();
-    auto imag_val2 = LINALG_DETAIL::access( conjugate_tensor, 0, 1 ).imag();
+    auto real_val1 = LINALG_DETAIL::access( conjugate_tensor, 0, 0 );
+    auto real_val2 = LINALG_DETAIL::access( conjugate_tensor, 0, 1 );
     // Check the tensor copy was populated correctly and provided the correct values
     EXPECT_EQ( real_val1, 1.0 );
-    EXPECT_EQ( imag_val1, 0.0 );
     EXPECT_EQ( real_val2, 5.0 );
-    EXPECT_EQ( imag_val2, 0.0 );
+    // Check conjugation of real values does not promote them to complex
+    EXPECT_TRUE( ( ::std::is_same_v< decltype( real_val1 ), double > ) );
     // Check the extents
     EXPECT_EQ( ( conjugate_tensor.extent( 0 ) ), 1 );
     EXPECT_EQ( ( conjugate_tensor.extent( 1 ) ), 2 );
@@ -483,15 +467,13 @@ namespace
     // Conjugate the tensor
     auto conjugate_tensor = conj( tensor );
     // Access elements from conjugate tensor
-    auto real_val1 = LINALG_DETAIL::access( conjugate_tensor, 0 ).real();
-    auto imag_val1 = LINALG_DETAIL::access( conjugate_tensor, 0 ).imag();
-    auto real_val2 = LINALG_DETAIL::access( conjugate_tensor, 1 ).real();
-    auto imag_val2 = LINALG_DETAIL::access( conjugate_tensor, 1 ).imag();
+    auto real_val1 = LINALG_DETAIL::access( conjugate_tensor, 0 );
+    auto real_val2 = LINALG_DETAIL::access( conjugate_tensor, 1 );
     // Check the tensor copy was populated correctly and provided the correct values
     EXPECT_EQ( real_val1, 1.0 );
-    EXPECT_EQ( imag_val1, 0.0 );
     EXPECT_EQ( real_val2, 2.0 );
-    EXPECT_EQ( imag_val2, 0.0 );
+    // Check conjugation of real values does not promote them to complex
+    EXPECT_TRUE( ( ::std::is_same_v< decltype( real_val1 ), double > ) );
     // Check the extents
     EXPECT_EQ( ( conjugate_tensor.extent( 0 ) ), 2 );
     EXPECT_EQ( ( conjugate_tensor.extents().extent( 0 ) ), 2 );
@@ -521,4 +503,20 @@ namespace
     EXPECT_EQ( ( conjugate_tensor.extent( 0 ) ), 2 );
     EXPECT_EQ( ( conjugate_tensor.extents().extent( 0 ) ), 2 );
   }
+
+  TEST( SIMPLIFICATION, INVOLUTIONS )
+  {
+    using matrix_type         = LINALG::dyn_matrix< double >;
+    using complex_matrix_type = LINALG::dyn_matrix< ::std::complex< double > >;
+    // Construct
+    matrix_type         matrix { ::std::extents< ::std::size_t, 2, 3 >() };
+    complex_matrix_type complex_matrix { ::std::extents< ::std::size_t, 2, 2 >() };
+    // Check repeated involutions collapse to the operand
+    EXPECT_EQ( ( ::std::addressof( trans( trans( matrix ) ) ) ), ( ::std::addressof( matrix ) ) );
+    EXPECT_EQ( ( ::std::addressof( -( -matrix ) ) ), ( ::std::addressof( matrix ) ) );
+    EXPECT_EQ( ( ::std::addressof( conj( conj( complex_matrix ) ) ) ), ( ::std::addressof( complex_matrix ) ) );
+    // Check conjugation of a real tensor is a transpose
+    EXPECT_TRUE( ( LINALG_EXPRESSIONS_DETAIL::is_transpose_expression_v< decltype( conj( matrix ) ) > ) );
+    EXPECT_EQ( ( ::std::addressof( conj( conj( matrix ) ) ) ), ( ::std::addressof( matrix ) ) );
+  }
 }
\ No newline at end of file